@@ -0,0 +1,69 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+
+#include "WString.h"
+#include "IPAddress.h"
+
+// ============================================================================
+// Arduino core subset for the native build
+// ============================================================================
+// Only what the scanner core uses. Timing goes through hal::clock().
+// ============================================================================
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+using std::min;
+using std::max;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(const uint8_t *data, size_t length) = 0;
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char *s);
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c);
+    size_t print(int value);
+    size_t print(unsigned int value);
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t println();
+    size_t println(const char *s);
+    size_t println(const String &s) { return println(s.c_str()); }
+    size_t println(int value);
+    size_t println(unsigned long value);
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Serial writes to stdout; hal::setSerialEnabled(false) silences it
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(const uint8_t *data, size_t length) override;
+    using Print::write;
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // NATIVE_ARDUINO_H
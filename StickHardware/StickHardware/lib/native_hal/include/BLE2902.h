@@ -0,0 +1,13 @@
+#ifndef NATIVE_BLE2902_H
+#define NATIVE_BLE2902_H
+
+#include "BLEDevice.h"
+
+// Client Characteristic Configuration; enabled while hal::bleConnect() is in effect
+class BLE2902 : public BLEDescriptor
+{
+public:
+    bool getNotifications();
+};
+
+#endif // NATIVE_BLE2902_H
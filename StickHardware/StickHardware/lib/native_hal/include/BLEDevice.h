@@ -0,0 +1,131 @@
+#ifndef NATIVE_BLE_DEVICE_H
+#define NATIVE_BLE_DEVICE_H
+
+#include <Arduino.h>
+#include <string>
+
+// ============================================================================
+// BLE loopback for the native build
+// ============================================================================
+// Just enough of the ESP32 BLE classes for the NUS handler. There is no
+// radio: hal::bleConnect() plays the central, writes go straight into the
+// RX characteristic callbacks and notify() hands TX data to the sink set
+// with hal::setBleNotifySink().
+// ============================================================================
+
+class BLEServer;
+class BLECharacteristic;
+
+typedef union
+{
+    struct
+    {
+        uint16_t conn_id;
+    } connect;
+} esp_ble_gatts_cb_param_t;
+
+class BLEDescriptor
+{
+public:
+    virtual ~BLEDescriptor() {}
+};
+
+class BLECharacteristicCallbacks
+{
+public:
+    virtual ~BLECharacteristicCallbacks() {}
+    virtual void onWrite(BLECharacteristic *characteristic) { (void)characteristic; }
+};
+
+class BLECharacteristic
+{
+public:
+    static const uint32_t PROPERTY_READ = 1 << 0;
+    static const uint32_t PROPERTY_WRITE = 1 << 1;
+    static const uint32_t PROPERTY_NOTIFY = 1 << 2;
+    static const uint32_t PROPERTY_BROADCAST = 1 << 3;
+    static const uint32_t PROPERTY_INDICATE = 1 << 4;
+    static const uint32_t PROPERTY_WRITE_NR = 1 << 5;
+
+    BLECharacteristic(const char *uuid, uint32_t properties) : uuid(uuid), properties(properties) {}
+
+    void setCallbacks(BLECharacteristicCallbacks *cb) { callbacks = cb; }
+    void addDescriptor(BLEDescriptor *descriptor) { (void)descriptor; }
+    void setValue(uint8_t *data, size_t length) { value.assign((const char *)data, length); }
+    void setValue(const std::string &data) { value = data; }
+    std::string getValue() { return value; }
+    void notify();
+
+    // Central side: deliver a write as the stack would
+    void write(const char *data, size_t length);
+
+    const char *getUUID() const { return uuid.c_str(); }
+    uint32_t getProperties() const { return properties; }
+
+private:
+    std::string uuid;
+    uint32_t properties;
+    std::string value;
+    BLECharacteristicCallbacks *callbacks = nullptr;
+};
+
+class BLEService
+{
+public:
+    BLECharacteristic *createCharacteristic(const char *uuid, uint32_t properties);
+    BLECharacteristic *getCharacteristic(const char *uuid);
+    void start() {}
+
+private:
+    static const int MAX_CHARACTERISTICS = 4;
+    BLECharacteristic *characteristics[MAX_CHARACTERISTICS] = {nullptr};
+    int characteristicCount = 0;
+};
+
+class BLEServerCallbacks
+{
+public:
+    virtual ~BLEServerCallbacks() {}
+    virtual void onConnect(BLEServer *server, esp_ble_gatts_cb_param_t *param)
+    {
+        (void)server;
+        (void)param;
+    }
+    virtual void onDisconnect(BLEServer *server) { (void)server; }
+};
+
+class BLEAdvertising
+{
+public:
+    void addServiceUUID(const char *uuid) { (void)uuid; }
+    void setScanResponse(bool enable) { (void)enable; }
+    void setMinPreferred(uint16_t interval) { (void)interval; }
+    void start() {}
+    void stop() {}
+};
+
+class BLEServer
+{
+public:
+    void setCallbacks(BLEServerCallbacks *cb) { callbacks = cb; }
+    BLEServerCallbacks *getCallbacks() const { return callbacks; }
+    BLEService *createService(const char *uuid);
+    BLEService *getService() { return service; }
+    BLEAdvertising *getAdvertising() { return &advertising; }
+    uint16_t getPeerMTU(uint16_t connId);
+
+private:
+    BLEServerCallbacks *callbacks = nullptr;
+    BLEService *service = nullptr;
+    BLEAdvertising advertising;
+};
+
+class BLEDevice
+{
+public:
+    static void init(const char *deviceName);
+    static BLEServer *createServer();
+    static void startAdvertising() {}
+};
+
+#endif // NATIVE_BLE_DEVICE_H
@@ -0,0 +1,64 @@
+#ifndef NATIVE_FS_H
+#define NATIVE_FS_H
+
+#include <Arduino.h>
+#include <stdio.h>
+
+// ============================================================================
+// Arduino FS API over host files
+// ============================================================================
+
+namespace fs
+{
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class File
+{
+public:
+    File(FILE *handle = nullptr) : handle(handle) {}
+
+    size_t write(const uint8_t *data, size_t length);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t read(uint8_t *data, size_t length);
+    int read();
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void flush();
+    void close();
+    operator bool() const { return handle != nullptr; }
+
+private:
+    FILE *handle;
+};
+
+class FS
+{
+public:
+    File open(const char *path, const char *mode = "r", bool create = false);
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *pathFrom, const char *pathTo);
+    bool mkdir(const char *path);
+    bool rmdir(const char *path);
+
+protected:
+    // Host path for an FS path ("/scan.ckpt" -> "<root>/scan.ckpt")
+    virtual const char *root() const = 0;
+
+private:
+    void hostPath(const char *path, char *out, size_t outSize) const;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // NATIVE_FS_H
@@ -0,0 +1,39 @@
+#ifndef NATIVE_IPADDRESS_H
+#define NATIVE_IPADDRESS_H
+
+#include <stdint.h>
+#include "WString.h"
+
+// ============================================================================
+// IPv4 address with the ESP32 core semantics: octets in wire order, and the
+// uint32_t conversion yields the address in network byte order
+// ============================================================================
+
+class IPAddress
+{
+public:
+    IPAddress() { bytes.dword = 0; }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d);
+    IPAddress(uint32_t address) { bytes.dword = address; }
+
+    uint8_t operator[](int index) const { return bytes.octets[index & 3]; }
+    uint8_t &operator[](int index) { return bytes.octets[index & 3]; }
+    operator uint32_t() const { return bytes.dword; }
+
+    bool operator==(const IPAddress &other) const { return bytes.dword == other.bytes.dword; }
+    bool operator!=(const IPAddress &other) const { return bytes.dword != other.bytes.dword; }
+    bool operator==(uint32_t address) const { return bytes.dword == address; }
+
+    bool fromString(const char *address);
+    bool fromString(const String &address) { return fromString(address.c_str()); }
+    String toString() const;
+
+private:
+    union
+    {
+        uint8_t octets[4];
+        uint32_t dword;
+    } bytes;
+};
+
+#endif // NATIVE_IPADDRESS_H
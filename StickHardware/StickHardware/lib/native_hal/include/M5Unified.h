@@ -0,0 +1,96 @@
+#ifndef NATIVE_M5UNIFIED_H
+#define NATIVE_M5UNIFIED_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// Headless M5Unified for the native build
+// ============================================================================
+// Drawing calls are accepted and dropped; only the cursor and text state are
+// tracked. Buttons never fire and the battery reads full.
+// ============================================================================
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED 0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_BLUE 0x001F
+#define TFT_CYAN 0x07FF
+#define TFT_YELLOW 0xFFE0
+#define TFT_ORANGE 0xFDA0
+#define TFT_DARKGREY 0x7BEF
+
+class M5HeadlessDisplay : public Print
+{
+public:
+    size_t write(const uint8_t *data, size_t length) override
+    {
+        (void)data;
+        cursorX += (int32_t)length * 6 * textSize;
+        return length;
+    }
+    using Print::write;
+
+    void startWrite() {}
+    void endWrite() {}
+    void setRotation(uint8_t rotation) { (void)rotation; }
+    void setBrightness(uint8_t brightness) { (void)brightness; }
+    void setTextSize(float size) { textSize = (int)size; }
+    void setTextColor(uint16_t fg) { (void)fg; }
+    void setTextColor(uint16_t fg, uint16_t bg) { (void)fg; (void)bg; }
+    void setTextDatum(uint8_t datum) { (void)datum; }
+    void setCursor(int32_t x, int32_t y) { cursorX = x; cursorY = y; }
+    int32_t getCursorX() const { return cursorX; }
+    int32_t getCursorY() const { return cursorY; }
+    int32_t width() const { return 240; }
+    int32_t height() const { return 135; }
+    int32_t textWidth(const char *text) const { return (int32_t)strlen(text) * 6 * textSize; }
+
+    void fillScreen(uint16_t color) { (void)color; }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) { (void)x; (void)y; (void)w; (void)h; (void)color; }
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) { (void)x; (void)y; (void)w; (void)h; (void)color; }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color) { (void)x; (void)y; (void)w; (void)color; }
+    void drawString(const char *text, int32_t x, int32_t y) { setCursor(x, y); print(text); }
+
+private:
+    int32_t cursorX = 0;
+    int32_t cursorY = 0;
+    int textSize = 1;
+};
+
+class M5HeadlessButton
+{
+public:
+    bool wasPressed() const { return false; }
+    bool isPressed() const { return false; }
+};
+
+class M5HeadlessPower
+{
+public:
+    int32_t getBatteryLevel() const { return 100; }
+    bool isCharging() const { return false; }
+    void powerOff() { exit(0); }
+};
+
+struct M5HeadlessConfig
+{
+};
+
+class M5HeadlessUnified
+{
+public:
+    M5HeadlessConfig config() const { return M5HeadlessConfig(); }
+    void begin(const M5HeadlessConfig &cfg) { (void)cfg; }
+    void update() {}
+
+    M5HeadlessDisplay Display;
+    M5HeadlessDisplay &Lcd = Display;
+    M5HeadlessButton BtnA;
+    M5HeadlessButton BtnB;
+    M5HeadlessPower Power;
+};
+
+extern M5HeadlessUnified M5;
+
+#endif // NATIVE_M5UNIFIED_H
@@ -0,0 +1,72 @@
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+#include <stddef.h>
+#include <string>
+
+// ============================================================================
+// Arduino String for the native build (std::string underneath)
+// ============================================================================
+
+class String
+{
+public:
+    String(const char *s = "") : str(s ? s : "") {}
+    String(const std::string &s) : str(s) {}
+    explicit String(char c) : str(1, c) {}
+    explicit String(int value);
+    explicit String(unsigned int value);
+    explicit String(long value);
+    explicit String(unsigned long value);
+
+    const char *c_str() const { return str.c_str(); }
+    unsigned int length() const { return (unsigned int)str.length(); }
+    bool reserve(unsigned int size) { str.reserve(size); return true; }
+
+    // A null pointer clears the string (ArduinoJson relies on this)
+    String &operator=(const char *s);
+    String &operator+=(const String &s) { str += s.str; return *this; }
+    String &operator+=(const char *s) { if (s) str += s; return *this; }
+    String &operator+=(char c) { str += c; return *this; }
+    bool concat(const char *s) { if (s) str += s; return true; }
+    bool concat(const char *s, unsigned int len) { if (s) str.append(s, len); return true; }
+    bool concat(char c) { str += c; return true; }
+    bool concat(const String &s) { str += s.str; return true; }
+
+    char operator[](unsigned int index) const { return index < str.length() ? str[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool operator==(const String &s) const { return str == s.str; }
+    bool operator==(const char *s) const { return s && str == s; }
+    bool operator!=(const String &s) const { return !(*this == s); }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool equals(const String &s) const { return *this == s; }
+
+    bool startsWith(const String &prefix) const { return str.compare(0, prefix.str.length(), prefix.str) == 0; }
+    bool endsWith(const String &suffix) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &s, unsigned int from = 0) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    long toInt() const;
+
+private:
+    std::string str;
+};
+
+// ESP32 core returns this from operator+; ArduinoJson checks for the type
+class StringSumHelper : public String
+{
+public:
+    StringSumHelper(const String &s) : String(s) {}
+};
+
+StringSumHelper operator+(const String &a, const String &b);
+StringSumHelper operator+(const String &a, const char *b);
+StringSumHelper operator+(const char *a, const String &b);
+
+#endif // NATIVE_WSTRING_H
@@ -0,0 +1,38 @@
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// WiFi station view for the native build
+// ============================================================================
+// "Connected" means hal::net() reports a station interface; addresses come
+// from the same call so a simulator can place the scanner on any subnet.
+// ============================================================================
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class WiFiClass
+{
+public:
+    wl_status_t status();
+    IPAddress localIP();
+    IPAddress subnetMask();
+    IPAddress gatewayIP();
+    IPAddress dnsIP(uint8_t index = 0);
+    String SSID() { return String("native"); }
+    int32_t RSSI() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // NATIVE_WIFI_H
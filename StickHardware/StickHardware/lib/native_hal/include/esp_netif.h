@@ -0,0 +1,6 @@
+#ifndef NATIVE_ESP_NETIF_H
+#define NATIVE_ESP_NETIF_H
+
+// Nothing from esp_netif is used by the scanner core on the host
+
+#endif // NATIVE_ESP_NETIF_H
@@ -0,0 +1,9 @@
+#ifndef NATIVE_ESP_SYSTEM_H
+#define NATIVE_ESP_SYSTEM_H
+
+#include <stdint.h>
+
+// Backed by hal::random32() (seedable for reproducible runs)
+uint32_t esp_random(void);
+
+#endif // NATIVE_ESP_SYSTEM_H
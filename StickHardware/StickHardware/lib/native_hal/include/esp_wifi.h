@@ -0,0 +1,6 @@
+#ifndef NATIVE_ESP_WIFI_H
+#define NATIVE_ESP_WIFI_H
+
+// Nothing from esp_wifi is used by the scanner core on the host
+
+#endif // NATIVE_ESP_WIFI_H
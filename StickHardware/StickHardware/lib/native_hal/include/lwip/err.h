@@ -0,0 +1,13 @@
+#ifndef NATIVE_LWIP_ERR_H
+#define NATIVE_LWIP_ERR_H
+
+#include <stdint.h>
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_MEM -1
+#define ERR_RTE -4
+#define ERR_ARG -16
+
+#endif // NATIVE_LWIP_ERR_H
@@ -0,0 +1,22 @@
+#ifndef NATIVE_LWIP_ETHARP_H
+#define NATIVE_LWIP_ETHARP_H
+
+#include "lwip/netif.h"
+
+// ============================================================================
+// lwIP ARP entry points backed by hal::net()->arpRequest()/arpLookup()
+// ============================================================================
+
+struct eth_addr
+{
+    uint8_t addr[6];
+};
+
+err_t etharp_request(struct netif *netif, const ip4_addr_t *ipaddr);
+
+// Returns a non-negative table index when the address is resolved. The
+// returned pointers stay valid until the next call.
+int8_t etharp_find_addr(struct netif *netif, const ip4_addr_t *ipaddr,
+                        struct eth_addr **eth_ret, const ip4_addr_t **ip_ret);
+
+#endif // NATIVE_LWIP_ETHARP_H
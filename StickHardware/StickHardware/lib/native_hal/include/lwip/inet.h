@@ -0,0 +1,7 @@
+#ifndef NATIVE_LWIP_INET_H
+#define NATIVE_LWIP_INET_H
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#endif // NATIVE_LWIP_INET_H
@@ -0,0 +1,22 @@
+#ifndef NATIVE_LWIP_IP4_ADDR_H
+#define NATIVE_LWIP_IP4_ADDR_H
+
+#include <stdint.h>
+
+// ============================================================================
+// lwIP IPv4 address type (network byte order, as in lwIP)
+// ============================================================================
+
+typedef struct ip4_addr
+{
+    uint32_t addr;
+} ip4_addr_t;
+
+#define IP4_ADDR(ipaddr, a, b, c, d)                                             \
+    ((ipaddr)->addr = ((uint32_t)((d) & 0xFF) << 24) | ((uint32_t)((c) & 0xFF) << 16) | \
+                      ((uint32_t)((b) & 0xFF) << 8) | (uint32_t)((a) & 0xFF))
+
+#define ip4_addr_isany_val(ipaddr) ((ipaddr).addr == 0)
+#define ip4_addr_isany(ipaddr) ((ipaddr) == nullptr || ip4_addr_isany_val(*(ipaddr)))
+
+#endif // NATIVE_LWIP_IP4_ADDR_H
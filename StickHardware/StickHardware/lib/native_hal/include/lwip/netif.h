@@ -0,0 +1,38 @@
+#ifndef NATIVE_LWIP_NETIF_H
+#define NATIVE_LWIP_NETIF_H
+
+#include <stdint.h>
+#include "lwip/err.h"
+#include "lwip/ip4_addr.h"
+#include "lwip/pbuf.h"
+
+// ============================================================================
+// lwIP netif list on the host: a single station interface whose address is
+// refreshed from hal::net() whenever the list is walked. Its input function
+// receives the ARP replies hal::net() reports (see NetBackend::arpReply).
+// ============================================================================
+
+#define NETIF_FLAG_UP 0x01U
+
+struct netif;
+typedef err_t (*netif_input_fn)(struct pbuf *p, struct netif *inp);
+
+struct netif
+{
+    struct netif *next;
+    ip4_addr_t ip_addr;
+    ip4_addr_t netmask;
+    ip4_addr_t gw;
+    uint8_t hwaddr[6];
+    uint8_t flags;
+    netif_input_fn input;
+};
+
+// Access through the macro keeps the address current
+struct netif *native_netif_list();
+#define netif_list (native_netif_list())
+
+#define netif_is_up(n) (((n)->flags & NETIF_FLAG_UP) != 0)
+#define netif_ip4_addr(n) ((const ip4_addr_t *)&((n)->ip_addr))
+
+#endif // NATIVE_LWIP_NETIF_H
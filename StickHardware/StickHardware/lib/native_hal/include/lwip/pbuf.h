@@ -0,0 +1,18 @@
+#ifndef NATIVE_LWIP_PBUF_H
+#define NATIVE_LWIP_PBUF_H
+
+#include <stdint.h>
+
+// ============================================================================
+// lwIP packet buffer (the fields netif input hooks read)
+// ============================================================================
+
+struct pbuf
+{
+    struct pbuf *next;
+    void *payload;
+    uint16_t tot_len;
+    uint16_t len;
+};
+
+#endif // NATIVE_LWIP_PBUF_H
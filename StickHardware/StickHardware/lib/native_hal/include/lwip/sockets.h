@@ -0,0 +1,20 @@
+#ifndef NATIVE_LWIP_SOCKETS_H
+#define NATIVE_LWIP_SOCKETS_H
+
+// ============================================================================
+// lwIP socket API on the host: the POSIX headers provide the same names and
+// constants. Calls reach hal::net() through the --wrap linker flags.
+// ============================================================================
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#endif // NATIVE_LWIP_SOCKETS_H
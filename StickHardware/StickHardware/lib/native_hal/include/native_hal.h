@@ -0,0 +1,158 @@
+#ifndef NATIVE_HAL_H
+#define NATIVE_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <vector>
+
+// ============================================================================
+// Native HAL - Host-side seams for the scanner core (env:native only)
+// ============================================================================
+// The scanner sources are compiled unchanged against the shim headers in
+// this library (Arduino.h, WiFi.h, lwip/*, BLE*, FS.h, M5Unified.h). Every
+// call that touches hardware or the network ends up in one of two objects:
+//
+//   Clock       millis()/micros()/delay()/yield()
+//   NetBackend  BSD sockets, the station interface, ARP requests, the ARP
+//               table and received ARP replies
+//
+// Both default to the host (steady clock, POSIX sockets, /proc/net/arp).
+// Socket calls are routed with the linker (-Wl,--wrap=socket,... in
+// env:native), so the scanner keeps calling plain socket()/select()/recv()
+// exactly as it does against lwIP. A benchmark or simulator installs its
+// own Clock/NetBackend before starting a scan.
+// ============================================================================
+
+namespace hal
+{
+
+class Clock
+{
+public:
+    virtual ~Clock() {}
+    virtual uint32_t millis() = 0;
+    virtual uint32_t micros() = 0;
+    virtual void delay(uint32_t ms) = 0;
+    virtual void yield() {}
+};
+
+class NetBackend
+{
+public:
+    virtual ~NetBackend() {}
+
+    // BSD socket calls, same contract as POSIX (return -1 and set errno)
+    virtual int socket(int domain, int type, int protocol) = 0;
+    virtual int bind(int fd, const struct sockaddr *addr, socklen_t len) = 0;
+    virtual int connect(int fd, const struct sockaddr *addr, socklen_t len) = 0;
+    virtual int select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+                       struct timeval *timeout) = 0;
+    virtual ssize_t send(int fd, const void *buf, size_t len, int flags) = 0;
+    virtual ssize_t sendto(int fd, const void *buf, size_t len, int flags,
+                           const struct sockaddr *addr, socklen_t addrLen) = 0;
+    virtual ssize_t recv(int fd, void *buf, size_t len, int flags) = 0;
+    virtual ssize_t recvfrom(int fd, void *buf, size_t len, int flags,
+                             struct sockaddr *addr, socklen_t *addrLen) = 0;
+    virtual int getsockopt(int fd, int level, int name, void *value, socklen_t *len) = 0;
+    virtual int setsockopt(int fd, int level, int name, const void *value, socklen_t len) = 0;
+    virtual int getsockname(int fd, struct sockaddr *addr, socklen_t *len) = 0;
+    virtual int fcntl(int fd, int cmd, long arg) = 0;
+    virtual int close(int fd) = 0;
+
+    // Station interface; addresses in network byte order.
+    // Returning false reports WiFi as disconnected.
+    virtual bool stationInterface(uint32_t &ip, uint32_t &netmask, uint32_t &gateway) = 0;
+
+    // DNS server handed out with the address (network order); the gateway
+    // unless overridden, as on most home routers
+    virtual uint32_t dnsServer()
+    {
+        uint32_t ip = 0, netmask = 0, gateway = 0;
+        return stationInterface(ip, netmask, gateway) ? gateway : 0;
+    }
+
+    // ARP: ask for a resolution, then poll the table
+    virtual bool arpRequest(uint32_t ip) = 0;
+    virtual bool arpLookup(uint32_t ip, uint8_t mac[6]) = 0;
+
+    // Next ARP reply received since the last call, in arrival order. The
+    // HAL turns each one into an Ethernet frame for the station netif's
+    // input function whenever the scanner delays or yields.
+    virtual bool arpReply(uint32_t &ip, uint8_t mac[6]) = 0;
+};
+
+// Host implementations, also usable as a base for partial overrides
+class SystemClock : public Clock
+{
+public:
+    uint32_t millis() override;
+    uint32_t micros() override;
+    void delay(uint32_t ms) override;
+};
+
+class PosixNetBackend : public NetBackend
+{
+public:
+    int socket(int domain, int type, int protocol) override;
+    int bind(int fd, const struct sockaddr *addr, socklen_t len) override;
+    int connect(int fd, const struct sockaddr *addr, socklen_t len) override;
+    int select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+               struct timeval *timeout) override;
+    ssize_t send(int fd, const void *buf, size_t len, int flags) override;
+    ssize_t sendto(int fd, const void *buf, size_t len, int flags,
+                   const struct sockaddr *addr, socklen_t addrLen) override;
+    ssize_t recv(int fd, void *buf, size_t len, int flags) override;
+    ssize_t recvfrom(int fd, void *buf, size_t len, int flags,
+                     struct sockaddr *addr, socklen_t *addrLen) override;
+    int getsockopt(int fd, int level, int name, void *value, socklen_t *len) override;
+    int setsockopt(int fd, int level, int name, const void *value, socklen_t len) override;
+    int getsockname(int fd, struct sockaddr *addr, socklen_t *len) override;
+    int fcntl(int fd, int cmd, long arg) override;
+    int close(int fd) override;
+
+    // First IPv4 interface that is up and not loopback, or the one named
+    // by $NETSTICK_IFACE
+    bool stationInterface(uint32_t &ip, uint32_t &netmask, uint32_t &gateway) override;
+    uint32_t dnsServer() override;
+
+    // A datagram to the discard port makes the kernel resolve the address;
+    // lookups read /proc/net/arp. Replies are requested addresses that have
+    // since resolved there (the kernel does not expose the frames).
+    bool arpRequest(uint32_t ip) override;
+    bool arpLookup(uint32_t ip, uint8_t mac[6]) override;
+    bool arpReply(uint32_t &ip, uint8_t mac[6]) override;
+
+private:
+    std::vector<uint32_t> arpAwaited;
+};
+
+// Active implementations (nullptr restores the host default)
+void setClock(Clock *clock);
+Clock &clock();
+void setNetBackend(NetBackend *backend);
+NetBackend &net();
+
+// esp_random() source; seeding makes SYN ports/ISNs reproducible
+void seedRandom(uint32_t seed);
+uint32_t random32();
+
+// BLE loopback: every notify() on the TX characteristic lands here.
+// Defaults to printing nothing (the handler already logs TX to Serial).
+typedef void (*BleNotifySink)(const uint8_t *data, size_t length);
+void setBleNotifySink(BleNotifySink sink);
+// Simulate a central connecting with notifications enabled
+void bleConnect(uint16_t connId = 0, uint16_t mtu = 185);
+void bleDisconnect();
+
+// Serial output can be silenced for benchmarks
+void setSerialEnabled(bool enabled);
+
+// LittleFS is a directory on the host ($NETSTICK_FS_ROOT or ./.littlefs)
+const char *fsRoot();
+
+} // namespace hal
+
+#endif // NATIVE_HAL_H
@@ -0,0 +1,417 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <M5Unified.h>
+#include <esp_system.h>
+#include <lwip/etharp.h>
+#include "native_hal.h"
+#include <ctype.h>
+
+// ============================================================================
+// Arduino core subset - timing, Serial, String, IPAddress, WiFi, lwIP glue
+// ============================================================================
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+M5HeadlessUnified M5;
+
+static bool serialEnabled = true;
+
+void hal::setSerialEnabled(bool enabled)
+{
+    serialEnabled = enabled;
+}
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+unsigned long millis()
+{
+    return hal::clock().millis();
+}
+
+unsigned long micros()
+{
+    return hal::clock().micros();
+}
+
+// Frames "arrive" while the caller sleeps, as the WiFi task would deliver them
+static void receiveFrames();
+
+void delay(unsigned long ms)
+{
+    hal::clock().delay((uint32_t)ms);
+    receiveFrames();
+}
+
+void yield()
+{
+    hal::clock().yield();
+    receiveFrames();
+}
+
+uint32_t esp_random(void)
+{
+    return hal::random32();
+}
+
+// ============================================================================
+// Print / Serial
+// ============================================================================
+
+size_t HardwareSerial::write(const uint8_t *data, size_t length)
+{
+    if (!serialEnabled)
+        return length;
+    return fwrite(data, 1, length, stdout);
+}
+
+size_t Print::print(const char *s)
+{
+    return s ? write((const uint8_t *)s, strlen(s)) : 0;
+}
+
+size_t Print::print(char c)
+{
+    return write((const uint8_t *)&c, 1);
+}
+
+size_t Print::print(int value)
+{
+    return printf("%d", value);
+}
+
+size_t Print::print(unsigned int value)
+{
+    return printf("%u", value);
+}
+
+size_t Print::print(long value)
+{
+    return printf("%ld", value);
+}
+
+size_t Print::print(unsigned long value)
+{
+    return printf("%lu", value);
+}
+
+size_t Print::println()
+{
+    return print("\r\n");
+}
+
+size_t Print::println(const char *s)
+{
+    size_t n = print(s);
+    return n + println();
+}
+
+size_t Print::println(int value)
+{
+    size_t n = print(value);
+    return n + println();
+}
+
+size_t Print::println(unsigned long value)
+{
+    size_t n = print(value);
+    return n + println();
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0)
+        return 0;
+    if ((size_t)len < sizeof(buffer))
+        return write((const uint8_t *)buffer, len);
+
+    // Rare long line: format again into a heap buffer
+    char *big = (char *)malloc(len + 1);
+    if (!big)
+        return 0;
+    va_start(args, format);
+    vsnprintf(big, len + 1, format, args);
+    va_end(args);
+    size_t n = write((const uint8_t *)big, len);
+    free(big);
+    return n;
+}
+
+// ============================================================================
+// String
+// ============================================================================
+
+String::String(int value) : str(std::to_string(value)) {}
+String::String(unsigned int value) : str(std::to_string(value)) {}
+String::String(long value) : str(std::to_string(value)) {}
+String::String(unsigned long value) : str(std::to_string(value)) {}
+
+String &String::operator=(const char *s)
+{
+    if (s)
+        str = s;
+    else
+        str.clear();
+    return *this;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+    return str.length() >= suffix.str.length() &&
+           str.compare(str.length() - suffix.str.length(), suffix.str.length(), suffix.str) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+    size_t pos = str.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &s, unsigned int from) const
+{
+    size_t pos = str.find(s.str, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const
+{
+    return from < str.length() ? String(str.substr(from)) : String();
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (from > to)
+        std::swap(from, to);
+    if (from >= str.length())
+        return String();
+    return String(str.substr(from, to - from));
+}
+
+void String::trim()
+{
+    size_t start = 0;
+    while (start < str.length() && isspace((unsigned char)str[start]))
+        start++;
+    size_t end = str.length();
+    while (end > start && isspace((unsigned char)str[end - 1]))
+        end--;
+    str = str.substr(start, end - start);
+}
+
+void String::toLowerCase()
+{
+    for (char &c : str)
+        c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+    for (char &c : str)
+        c = (char)toupper((unsigned char)c);
+}
+
+long String::toInt() const
+{
+    return strtol(str.c_str(), nullptr, 10);
+}
+
+StringSumHelper operator+(const String &a, const String &b)
+{
+    String sum(a);
+    sum += b;
+    return StringSumHelper(sum);
+}
+
+StringSumHelper operator+(const String &a, const char *b)
+{
+    String sum(a);
+    sum += b;
+    return StringSumHelper(sum);
+}
+
+StringSumHelper operator+(const char *a, const String &b)
+{
+    String sum(a);
+    sum += b;
+    return StringSumHelper(sum);
+}
+
+// ============================================================================
+// IPAddress
+// ============================================================================
+
+IPAddress::IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+{
+    bytes.octets[0] = a;
+    bytes.octets[1] = b;
+    bytes.octets[2] = c;
+    bytes.octets[3] = d;
+}
+
+bool IPAddress::fromString(const char *address)
+{
+    if (!address)
+        return false;
+
+    uint8_t parsed[4];
+    int part = 0;
+    int value = -1;
+    for (const char *p = address;; p++)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            value = (value < 0 ? 0 : value * 10) + (*p - '0');
+            if (value > 255)
+                return false;
+        }
+        else if (*p == '.' || *p == '\0')
+        {
+            if (value < 0 || part > 3)
+                return false;
+            parsed[part++] = (uint8_t)value;
+            value = -1;
+            if (*p == '\0')
+                break;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (part != 4)
+        return false;
+
+    memcpy(bytes.octets, parsed, 4);
+    return true;
+}
+
+String IPAddress::toString() const
+{
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u",
+             bytes.octets[0], bytes.octets[1], bytes.octets[2], bytes.octets[3]);
+    return String(buf);
+}
+
+// ============================================================================
+// WiFi
+// ============================================================================
+
+wl_status_t WiFiClass::status()
+{
+    uint32_t ip, mask, gw;
+    return hal::net().stationInterface(ip, mask, gw) ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+IPAddress WiFiClass::localIP()
+{
+    uint32_t ip = 0, mask = 0, gw = 0;
+    hal::net().stationInterface(ip, mask, gw);
+    return IPAddress(ip);
+}
+
+IPAddress WiFiClass::subnetMask()
+{
+    uint32_t ip = 0, mask = 0, gw = 0;
+    hal::net().stationInterface(ip, mask, gw);
+    return IPAddress(mask);
+}
+
+IPAddress WiFiClass::gatewayIP()
+{
+    uint32_t ip = 0, mask = 0, gw = 0;
+    hal::net().stationInterface(ip, mask, gw);
+    return IPAddress(gw);
+}
+
+IPAddress WiFiClass::dnsIP(uint8_t index)
+{
+    return index == 0 ? IPAddress(hal::net().dnsServer()) : IPAddress();
+}
+
+// ============================================================================
+// lwIP netif / etharp
+// ============================================================================
+
+// The stack end of the input path; frames are consumed by the hook (if any)
+static err_t stackInput(struct pbuf *p, struct netif *inp)
+{
+    (void)p;
+    (void)inp;
+    return ERR_OK;
+}
+
+static struct netif stationNetif = {nullptr, {0}, {0}, {0}, {0}, 0, stackInput};
+
+struct netif *native_netif_list()
+{
+    uint32_t ip = 0, mask = 0, gw = 0;
+    if (hal::net().stationInterface(ip, mask, gw))
+    {
+        stationNetif.ip_addr.addr = ip;
+        stationNetif.netmask.addr = mask;
+        stationNetif.gw.addr = gw;
+        stationNetif.flags = NETIF_FLAG_UP;
+    }
+    else
+    {
+        stationNetif.ip_addr.addr = 0;
+        stationNetif.netmask.addr = 0;
+        stationNetif.gw.addr = 0;
+        stationNetif.flags = 0;
+    }
+    return &stationNetif;
+}
+
+// Ethernet header + ARP reply addressed to the station. Replies stay queued
+// in the backend until something hooks the input path.
+static void receiveFrames()
+{
+    uint32_t ip;
+    uint8_t mac[6];
+    while (stationNetif.input != stackInput && hal::net().arpReply(ip, mac))
+    {
+        uint8_t frame[42];
+        memset(frame, 0xFF, 6);             // Destination (unused by receivers)
+        memcpy(frame + 6, mac, 6);          // Source
+        frame[12] = 0x08;                   // EtherType ARP
+        frame[13] = 0x06;
+        static const uint8_t arpHeader[8] = {0x00, 0x01, 0x08, 0x00, 6, 4, 0x00, 0x02};
+        memcpy(frame + 14, arpHeader, 8);   // Ethernet/IPv4, opcode reply
+        memcpy(frame + 22, mac, 6);         // Sender MAC
+        memcpy(frame + 28, &ip, 4);         // Sender IP
+        memcpy(frame + 32, stationNetif.hwaddr, 6);
+        memcpy(frame + 38, &stationNetif.ip_addr.addr, 4);
+
+        struct pbuf p = {nullptr, frame, sizeof(frame), sizeof(frame)};
+        stationNetif.input(&p, &stationNetif);
+    }
+}
+
+err_t etharp_request(struct netif *netif, const ip4_addr_t *ipaddr)
+{
+    (void)netif;
+    return hal::net().arpRequest(ipaddr->addr) ? ERR_OK : ERR_RTE;
+}
+
+int8_t etharp_find_addr(struct netif *netif, const ip4_addr_t *ipaddr,
+                        struct eth_addr **eth_ret, const ip4_addr_t **ip_ret)
+{
+    (void)netif;
+    static struct eth_addr foundMac;
+    static ip4_addr_t foundIp;
+
+    if (!hal::net().arpLookup(ipaddr->addr, foundMac.addr))
+        return -1;
+
+    foundIp = *ipaddr;
+    *eth_ret = &foundMac;
+    *ip_ret = &foundIp;
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <BLEDevice.h>
+#include <BLE2902.h>
+#include "native_hal.h"
+
+// ============================================================================
+// BLE loopback - one server, one central, no radio
+// ============================================================================
+
+static BLEServer *theServer = nullptr;
+static hal::BleNotifySink notifySink = nullptr;
+static bool centralConnected = false;
+static uint16_t centralMtu = 23;
+
+void hal::setBleNotifySink(BleNotifySink sink)
+{
+    notifySink = sink;
+}
+
+void hal::bleConnect(uint16_t connId, uint16_t mtu)
+{
+    centralConnected = true;
+    centralMtu = mtu;
+    if (theServer && theServer->getCallbacks())
+    {
+        esp_ble_gatts_cb_param_t param;
+        param.connect.conn_id = connId;
+        theServer->getCallbacks()->onConnect(theServer, &param);
+    }
+}
+
+void hal::bleDisconnect()
+{
+    centralConnected = false;
+    if (theServer && theServer->getCallbacks())
+    {
+        theServer->getCallbacks()->onDisconnect(theServer);
+    }
+}
+
+void BLEDevice::init(const char *deviceName)
+{
+    (void)deviceName;
+}
+
+BLEServer *BLEDevice::createServer()
+{
+    if (!theServer)
+    {
+        theServer = new BLEServer();
+    }
+    return theServer;
+}
+
+BLEService *BLEServer::createService(const char *uuid)
+{
+    (void)uuid;
+    if (!service)
+    {
+        service = new BLEService();
+    }
+    return service;
+}
+
+uint16_t BLEServer::getPeerMTU(uint16_t connId)
+{
+    (void)connId;
+    return centralMtu;
+}
+
+BLECharacteristic *BLEService::createCharacteristic(const char *uuid, uint32_t properties)
+{
+    if (characteristicCount >= MAX_CHARACTERISTICS)
+        return nullptr;
+    BLECharacteristic *c = new BLECharacteristic(uuid, properties);
+    characteristics[characteristicCount++] = c;
+    return c;
+}
+
+BLECharacteristic *BLEService::getCharacteristic(const char *uuid)
+{
+    for (int i = 0; i < characteristicCount; i++)
+    {
+        if (strcasecmp(characteristics[i]->getUUID(), uuid) == 0)
+            return characteristics[i];
+    }
+    return nullptr;
+}
+
+void BLECharacteristic::notify()
+{
+    if (notifySink && centralConnected)
+    {
+        notifySink((const uint8_t *)value.data(), value.size());
+    }
+}
+
+void BLECharacteristic::write(const char *data, size_t length)
+{
+    value.assign(data, length);
+    if (callbacks)
+    {
+        callbacks->onWrite(this);
+    }
+}
+
+bool BLE2902::getNotifications()
+{
+    return centralConnected;
+}
@@ -0,0 +1,143 @@
+#include <LittleFS.h>
+#include "native_hal.h"
+#include <sys/stat.h>
+#include <errno.h>
+#include <unistd.h>
+
+// ============================================================================
+// FS over host files - LittleFS lives in a directory on the build host
+// ============================================================================
+
+LittleFSFS LittleFS;
+
+const char *hal::fsRoot()
+{
+    const char *root = getenv("NETSTICK_FS_ROOT");
+    return root && *root ? root : ".littlefs";
+}
+
+namespace fs
+{
+
+size_t File::write(const uint8_t *data, size_t length)
+{
+    return handle ? fwrite(data, 1, length, handle) : 0;
+}
+
+size_t File::read(uint8_t *data, size_t length)
+{
+    return handle ? fread(data, 1, length, handle) : 0;
+}
+
+int File::read()
+{
+    return handle ? fgetc(handle) : -1;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+    static const int whence[] = {SEEK_SET, SEEK_CUR, SEEK_END};
+    return handle && fseek(handle, (long)pos, whence[mode]) == 0;
+}
+
+size_t File::position() const
+{
+    return handle ? (size_t)ftell(handle) : 0;
+}
+
+size_t File::size() const
+{
+    if (!handle)
+        return 0;
+    struct stat st;
+    fflush(handle);
+    return fstat(fileno(handle), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::flush()
+{
+    if (handle)
+        fflush(handle);
+}
+
+void File::close()
+{
+    if (handle)
+    {
+        fclose(handle);
+        handle = nullptr;
+    }
+}
+
+void FS::hostPath(const char *path, char *out, size_t outSize) const
+{
+    snprintf(out, outSize, "%s%s%s", root(), path[0] == '/' ? "" : "/", path);
+}
+
+File FS::open(const char *path, const char *mode, bool create)
+{
+    (void)create;
+    char host[512];
+    hostPath(path, host, sizeof(host));
+
+    // Arduino modes are text-like ("r", "w", "a"); host files are binary
+    char hostMode[4] = {mode[0], 'b', 0, 0};
+    if (mode[1] == '+')
+        hostMode[2] = '+';
+    return File(fopen(host, hostMode));
+}
+
+bool FS::exists(const char *path)
+{
+    char host[512];
+    hostPath(path, host, sizeof(host));
+    struct stat st;
+    return stat(host, &st) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+    char host[512];
+    hostPath(path, host, sizeof(host));
+    return ::remove(host) == 0;
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo)
+{
+    char from[512];
+    char to[512];
+    hostPath(pathFrom, from, sizeof(from));
+    hostPath(pathTo, to, sizeof(to));
+    return ::rename(from, to) == 0;
+}
+
+bool FS::mkdir(const char *path)
+{
+    char host[512];
+    hostPath(path, host, sizeof(host));
+    return ::mkdir(host, 0755) == 0 || errno == EEXIST;
+}
+
+bool FS::rmdir(const char *path)
+{
+    char host[512];
+    hostPath(path, host, sizeof(host));
+    return ::rmdir(host) == 0;
+}
+
+} // namespace fs
+
+bool LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles,
+                       const char *partitionLabel)
+{
+    (void)basePath;
+    (void)maxOpenFiles;
+    (void)partitionLabel;
+    (void)formatOnFail; // Nothing to format: the root directory is created on demand
+    return ::mkdir(root(), 0755) == 0 || errno == EEXIST;
+}
+
+const char *LittleFSFS::root() const
+{
+    return hal::fsRoot();
+}
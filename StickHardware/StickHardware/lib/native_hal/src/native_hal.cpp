@@ -0,0 +1,439 @@
+#include "native_hal.h"
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <ifaddrs.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+
+// ============================================================================
+// Native HAL - Clock, socket routing and the host network backend
+// ============================================================================
+
+// The libc originals, reachable because env:native links with --wrap
+extern "C"
+{
+    int __real_socket(int domain, int type, int protocol);
+    int __real_bind(int fd, const struct sockaddr *addr, socklen_t len);
+    int __real_connect(int fd, const struct sockaddr *addr, socklen_t len);
+    int __real_select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+                      struct timeval *timeout);
+    ssize_t __real_send(int fd, const void *buf, size_t len, int flags);
+    ssize_t __real_sendto(int fd, const void *buf, size_t len, int flags,
+                          const struct sockaddr *addr, socklen_t addrLen);
+    ssize_t __real_recv(int fd, void *buf, size_t len, int flags);
+    ssize_t __real_recvfrom(int fd, void *buf, size_t len, int flags,
+                            struct sockaddr *addr, socklen_t *addrLen);
+    int __real_getsockopt(int fd, int level, int name, void *value, socklen_t *len);
+    int __real_setsockopt(int fd, int level, int name, const void *value, socklen_t len);
+    int __real_getsockname(int fd, struct sockaddr *addr, socklen_t *len);
+    int __real_fcntl(int fd, int cmd, ...);
+    int __real_close(int fd);
+}
+
+namespace hal
+{
+
+// ============================================================================
+// Active implementations
+// ============================================================================
+
+static SystemClock systemClock;
+static PosixNetBackend posixNet;
+static Clock *activeClock = &systemClock;
+static NetBackend *activeNet = &posixNet;
+
+void setClock(Clock *c)
+{
+    activeClock = c ? c : &systemClock;
+}
+
+Clock &clock()
+{
+    return *activeClock;
+}
+
+void setNetBackend(NetBackend *backend)
+{
+    activeNet = backend ? backend : &posixNet;
+}
+
+NetBackend &net()
+{
+    return *activeNet;
+}
+
+// ============================================================================
+// Random (xorshift32, seeded from the OS unless seedRandom() is called)
+// ============================================================================
+
+static uint32_t randomState = 0;
+
+void seedRandom(uint32_t seed)
+{
+    randomState = seed ? seed : 0x9E3779B9;
+}
+
+uint32_t random32()
+{
+    if (randomState == 0)
+    {
+        std::random_device device;
+        seedRandom(device());
+    }
+    uint32_t x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+// ============================================================================
+// SystemClock
+// ============================================================================
+
+static const std::chrono::steady_clock::time_point clockEpoch = std::chrono::steady_clock::now();
+
+uint32_t SystemClock::millis()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - clockEpoch)
+        .count();
+}
+
+uint32_t SystemClock::micros()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - clockEpoch)
+        .count();
+}
+
+void SystemClock::delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ============================================================================
+// PosixNetBackend - sockets
+// ============================================================================
+
+int PosixNetBackend::socket(int domain, int type, int protocol)
+{
+    return __real_socket(domain, type, protocol);
+}
+
+int PosixNetBackend::bind(int fd, const struct sockaddr *addr, socklen_t len)
+{
+    return __real_bind(fd, addr, len);
+}
+
+int PosixNetBackend::connect(int fd, const struct sockaddr *addr, socklen_t len)
+{
+    return __real_connect(fd, addr, len);
+}
+
+int PosixNetBackend::select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+                            struct timeval *timeout)
+{
+    return __real_select(nfds, readSet, writeSet, errorSet, timeout);
+}
+
+ssize_t PosixNetBackend::send(int fd, const void *buf, size_t len, int flags)
+{
+    // Host sockets raise SIGPIPE on a reset peer; lwIP just returns an error
+    return __real_send(fd, buf, len, flags | MSG_NOSIGNAL);
+}
+
+ssize_t PosixNetBackend::sendto(int fd, const void *buf, size_t len, int flags,
+                                const struct sockaddr *addr, socklen_t addrLen)
+{
+    return __real_sendto(fd, buf, len, flags | MSG_NOSIGNAL, addr, addrLen);
+}
+
+ssize_t PosixNetBackend::recv(int fd, void *buf, size_t len, int flags)
+{
+    return __real_recv(fd, buf, len, flags);
+}
+
+ssize_t PosixNetBackend::recvfrom(int fd, void *buf, size_t len, int flags,
+                                  struct sockaddr *addr, socklen_t *addrLen)
+{
+    return __real_recvfrom(fd, buf, len, flags, addr, addrLen);
+}
+
+int PosixNetBackend::getsockopt(int fd, int level, int name, void *value, socklen_t *len)
+{
+    return __real_getsockopt(fd, level, name, value, len);
+}
+
+int PosixNetBackend::setsockopt(int fd, int level, int name, const void *value, socklen_t len)
+{
+    return __real_setsockopt(fd, level, name, value, len);
+}
+
+int PosixNetBackend::getsockname(int fd, struct sockaddr *addr, socklen_t *len)
+{
+    return __real_getsockname(fd, addr, len);
+}
+
+int PosixNetBackend::fcntl(int fd, int cmd, long arg)
+{
+    return __real_fcntl(fd, cmd, arg);
+}
+
+int PosixNetBackend::close(int fd)
+{
+    return __real_close(fd);
+}
+
+// ============================================================================
+// PosixNetBackend - interface and ARP
+// ============================================================================
+
+// Default route of an interface from /proc/net/route (network order)
+static uint32_t readGateway(const char *ifname)
+{
+    FILE *f = fopen("/proc/net/route", "r");
+    if (!f)
+        return 0;
+
+    char line[256];
+    char name[IFNAMSIZ + 1];
+    unsigned int destination = 0;
+    unsigned int gateway = 0;
+    uint32_t result = 0;
+
+    fgets(line, sizeof(line), f); // Header
+    while (fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%16s %x %x", name, &destination, &gateway) == 3 &&
+            destination == 0 && strcmp(name, ifname) == 0)
+        {
+            result = gateway; // Already in network order
+            break;
+        }
+    }
+    fclose(f);
+    return result;
+}
+
+bool PosixNetBackend::stationInterface(uint32_t &ip, uint32_t &netmask, uint32_t &gateway)
+{
+    struct ifaddrs *list = nullptr;
+    if (getifaddrs(&list) < 0)
+        return false;
+
+    const char *wanted = getenv("NETSTICK_IFACE");
+    bool found = false;
+
+    for (struct ifaddrs *ifa = list; ifa; ifa = ifa->ifa_next)
+    {
+        if (!ifa->ifa_addr || ifa->ifa_addr->sa_family != AF_INET || !ifa->ifa_netmask)
+            continue;
+        if (wanted ? strcmp(ifa->ifa_name, wanted) != 0
+                   : (!(ifa->ifa_flags & IFF_UP) || (ifa->ifa_flags & IFF_LOOPBACK)))
+            continue;
+
+        ip = ((struct sockaddr_in *)ifa->ifa_addr)->sin_addr.s_addr;
+        netmask = ((struct sockaddr_in *)ifa->ifa_netmask)->sin_addr.s_addr;
+        gateway = readGateway(ifa->ifa_name);
+        found = true;
+        break;
+    }
+
+    freeifaddrs(list);
+    return found;
+}
+
+// First IPv4 nameserver in /etc/resolv.conf
+uint32_t PosixNetBackend::dnsServer()
+{
+    FILE *f = fopen("/etc/resolv.conf", "r");
+    if (!f)
+        return NetBackend::dnsServer();
+
+    char line[256];
+    char address[64];
+    uint32_t result = 0;
+    while (fgets(line, sizeof(line), f))
+    {
+        struct in_addr parsed;
+        if (sscanf(line, " nameserver %63s", address) == 1 && inet_pton(AF_INET, address, &parsed) == 1)
+        {
+            result = parsed.s_addr;
+            break;
+        }
+    }
+    fclose(f);
+    return result ? result : NetBackend::dnsServer();
+}
+
+bool PosixNetBackend::arpRequest(uint32_t ip)
+{
+    int fd = __real_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0)
+        return false;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(9); // discard
+    addr.sin_addr.s_addr = ip;
+
+    bool ok = __real_sendto(fd, "", 0, MSG_DONTWAIT | MSG_NOSIGNAL,
+                            (struct sockaddr *)&addr, sizeof(addr)) >= 0;
+    __real_close(fd);
+
+    if (ok && std::find(arpAwaited.begin(), arpAwaited.end(), ip) == arpAwaited.end())
+        arpAwaited.push_back(ip);
+    return ok;
+}
+
+// First resolved /proc/net/arp entry whose address is in wanted[]
+static bool findResolved(const uint32_t *wanted, size_t count, uint32_t &ip, uint8_t mac[6])
+{
+    FILE *f = fopen("/proc/net/arp", "r");
+    if (!f)
+        return false;
+
+    char line[256];
+    char ipStr[32];
+    char macStr[32];
+    unsigned int hwType = 0;
+    unsigned int flags = 0;
+    bool found = false;
+
+    fgets(line, sizeof(line), f); // Header
+    while (!found && fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%31s 0x%x 0x%x %31s", ipStr, &hwType, &flags, macStr) != 4)
+            continue;
+
+        struct in_addr entry;
+        if (inet_pton(AF_INET, ipStr, &entry) != 1 ||
+            std::find(wanted, wanted + count, entry.s_addr) == wanted + count)
+            continue;
+
+        unsigned int b[6];
+        if ((flags & 0x2) && // ATF_COM: resolved
+            sscanf(macStr, "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) == 6)
+        {
+            for (int i = 0; i < 6; i++)
+                mac[i] = (uint8_t)b[i];
+            ip = entry.s_addr;
+            found = true;
+        }
+    }
+    fclose(f);
+    return found;
+}
+
+bool PosixNetBackend::arpLookup(uint32_t ip, uint8_t mac[6])
+{
+    uint32_t resolved;
+    return findResolved(&ip, 1, resolved, mac);
+}
+
+bool PosixNetBackend::arpReply(uint32_t &ip, uint8_t mac[6])
+{
+    if (arpAwaited.empty() || !findResolved(arpAwaited.data(), arpAwaited.size(), ip, mac))
+        return false;
+    arpAwaited.erase(std::find(arpAwaited.begin(), arpAwaited.end(), ip));
+    return true;
+}
+
+} // namespace hal
+
+// ============================================================================
+// Linker-wrapped socket calls from the scanner core
+// ============================================================================
+
+extern "C"
+{
+    int __wrap_socket(int domain, int type, int protocol)
+    {
+        return hal::net().socket(domain, type, protocol);
+    }
+
+    int __wrap_bind(int fd, const struct sockaddr *addr, socklen_t len)
+    {
+        return hal::net().bind(fd, addr, len);
+    }
+
+    int __wrap_connect(int fd, const struct sockaddr *addr, socklen_t len)
+    {
+        return hal::net().connect(fd, addr, len);
+    }
+
+    int __wrap_select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+                      struct timeval *timeout)
+    {
+        return hal::net().select(nfds, readSet, writeSet, errorSet, timeout);
+    }
+
+    ssize_t __wrap_send(int fd, const void *buf, size_t len, int flags)
+    {
+        return hal::net().send(fd, buf, len, flags);
+    }
+
+    ssize_t __wrap_sendto(int fd, const void *buf, size_t len, int flags,
+                          const struct sockaddr *addr, socklen_t addrLen)
+    {
+        return hal::net().sendto(fd, buf, len, flags, addr, addrLen);
+    }
+
+    ssize_t __wrap_recv(int fd, void *buf, size_t len, int flags)
+    {
+        return hal::net().recv(fd, buf, len, flags);
+    }
+
+    ssize_t __wrap_recvfrom(int fd, void *buf, size_t len, int flags,
+                            struct sockaddr *addr, socklen_t *addrLen)
+    {
+        return hal::net().recvfrom(fd, buf, len, flags, addr, addrLen);
+    }
+
+    int __wrap_getsockopt(int fd, int level, int name, void *value, socklen_t *len)
+    {
+        return hal::net().getsockopt(fd, level, name, value, len);
+    }
+
+    int __wrap_setsockopt(int fd, int level, int name, const void *value, socklen_t len)
+    {
+        return hal::net().setsockopt(fd, level, name, value, len);
+    }
+
+    int __wrap_getsockname(int fd, struct sockaddr *addr, socklen_t *len)
+    {
+        return hal::net().getsockname(fd, addr, len);
+    }
+
+    int __wrap_fcntl(int fd, int cmd, ...)
+    {
+        // Only the setters carry an argument (the core uses F_GETFL/F_SETFL)
+        long arg = 0;
+        if (cmd == F_SETFL || cmd == F_SETFD || cmd == F_DUPFD || cmd == F_SETOWN)
+        {
+            va_list args;
+            va_start(args, cmd);
+            arg = va_arg(args, long);
+            va_end(args);
+        }
+        return hal::net().fcntl(fd, cmd, arg);
+    }
+
+    int __wrap_close(int fd)
+    {
+        return hal::net().close(fd);
+    }
+}
@@ -0,0 +1,247 @@
+#ifndef SIM_NETWORK_H
+#define SIM_NETWORK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include "native_hal.h"
+
+// ============================================================================
+// Simulated Network - Deterministic virtual LAN for scan benchmarks
+// ============================================================================
+// Installs itself as the native HAL's Clock and NetBackend, so the scanner
+// core runs unchanged against a modelled subnet:
+//
+//   - Hosts with MACs, per-host latency, jitter and packet loss
+//   - TCP ports that are open (optionally with a greeting or a reply to a
+//     request), closed (RST / ECONNREFUSED) or filtered (silence)
+//   - UDP ports that answer, raise ICMP port-unreachable or stay silent
+//   - Raw TCP and ICMP sockets, so SYN discovery, echo sweeps and UDP
+//     closed-port detection see real-looking IPv4 packets
+//   - ARP resolution for live hosts, through a table as small as lwIP's
+//   - mDNS chatter: named hosts periodically multicast their A record to
+//     UDP sockets bound to port 5353
+//
+// Time is virtual: select() and delay() jump straight to the next event, and
+// every socket call or yield() costs a fixed amount of simulated CPU time. The same
+// seed always produces the same network and the same scan.
+// ============================================================================
+
+namespace sim
+{
+
+enum class PortKind : uint8_t
+{
+    CLOSED,
+    OPEN,
+    FILTERED
+};
+
+struct SimPort
+{
+    uint16_t port;
+    bool udp;
+    PortKind kind;
+    const char *banner;    // Sent after connect (greeting) or as the reply
+    size_t bannerLength;   // 0 = strlen(banner)
+    bool waitsForRequest;  // Banner is a reply to the first request (HTTP-style)
+};
+
+struct SimHost
+{
+    uint32_t ip;           // Network byte order
+    uint8_t mac[6];
+    uint32_t latencyUs;    // One-way delay
+    uint32_t jitterUs;     // Uniform extra delay per packet
+    float loss;            // Per-packet drop probability
+    PortKind defaultTcp;   // Ports not listed below
+    PortKind defaultUdp;
+    bool answersEcho;      // Open hosts and some firewalled ones answer ICMP echo
+    std::vector<SimPort> ports;
+    std::string name;      // mDNS hostname without ".local" (empty = silent)
+
+    const SimPort *findPort(uint16_t port, bool udp) const;
+    PortKind tcpState(uint16_t port) const;
+};
+
+struct SimConfig
+{
+    uint32_t seed = 1;
+    uint32_t network = 0x0A000000;   // 10.0.0.0 (host order)
+    uint8_t prefixLength = 24;
+    uint32_t localHost = 2;          // Host part of the scanner's address
+    int hostCount = 40;              // Live hosts besides the scanner
+    uint32_t minLatencyUs = 2000;
+    uint32_t maxLatencyUs = 30000;
+    uint32_t jitterUs = 5000;
+    float loss = 0.01f;
+    float firewalledFraction = 0.25f;  // Hosts whose unlisted ports are filtered
+    int maxOpenPorts = 6;              // Per host, drawn from the service catalog
+    uint32_t callCostUs = 20;          // Simulated CPU time per socket call or yield()
+    int arpTableSize = 10;             // ESP-IDF CONFIG_LWIP_ARP_TABLE_SIZE; newest replies win
+    float announceFraction = 0.5f;     // Hosts that announce themselves over mDNS
+    uint32_t announceIntervalUs = 30000000;
+};
+
+class VirtualClock : public hal::Clock
+{
+public:
+    uint32_t millis() override { return (uint32_t)(nowUs / 1000); }
+    uint32_t micros() override { return (uint32_t)nowUs; }
+    void delay(uint32_t ms) override { nowUs += (uint64_t)ms * 1000; }
+    // A busy loop that only polls millis() must still see time pass
+    void yield() override { nowUs += yieldCostUs; }
+
+    uint64_t now() const { return nowUs; }
+    void advanceTo(uint64_t us)
+    {
+        if (us > nowUs)
+            nowUs = us;
+    }
+    void advance(uint64_t us) { nowUs += us; }
+    void setYieldCost(uint32_t us) { yieldCostUs = us; }
+
+private:
+    uint64_t nowUs = 1000000; // Start at 1 s so "0 ms" never means "never"
+    uint32_t yieldCostUs = 20;
+};
+
+// Counters for a benchmark report
+struct SimStats
+{
+    uint32_t socketCalls;
+    uint32_t tcpConnects;
+    uint32_t synSent;
+    uint32_t udpSent;
+    uint32_t echoSent;
+    uint32_t arpRequests;
+    uint32_t announcements;
+    uint32_t dropped;
+};
+
+class SimNetwork : public hal::NetBackend
+{
+public:
+    // Build a network from the config; replaces any previous hosts
+    void generate(const SimConfig &config);
+    void addHost(const SimHost &host);
+    // Unplug a host: it stops answering and leaves the ARP table
+    void removeHost(uint32_t ip);
+    const std::vector<SimHost> &getHosts() const { return hosts; }
+    const SimHost *findHost(uint32_t ip) const;
+    uint32_t localIp() const { return stationIp; }
+
+    // Route the HAL (clock, sockets, ARP) into the simulation, or back out
+    void install();
+    void uninstall();
+
+    VirtualClock &clock() { return vclock; }
+    const SimStats &getStats() const { return stats; }
+    void resetStats();
+
+    // hal::NetBackend
+    int socket(int domain, int type, int protocol) override;
+    int bind(int fd, const struct sockaddr *addr, socklen_t len) override;
+    int connect(int fd, const struct sockaddr *addr, socklen_t len) override;
+    int select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+               struct timeval *timeout) override;
+    ssize_t send(int fd, const void *buf, size_t len, int flags) override;
+    ssize_t sendto(int fd, const void *buf, size_t len, int flags,
+                   const struct sockaddr *addr, socklen_t addrLen) override;
+    ssize_t recv(int fd, void *buf, size_t len, int flags) override;
+    ssize_t recvfrom(int fd, void *buf, size_t len, int flags,
+                     struct sockaddr *addr, socklen_t *addrLen) override;
+    int getsockopt(int fd, int level, int name, void *value, socklen_t *len) override;
+    int setsockopt(int fd, int level, int name, const void *value, socklen_t len) override;
+    int getsockname(int fd, struct sockaddr *addr, socklen_t *len) override;
+    int fcntl(int fd, int cmd, long arg) override;
+    int close(int fd) override;
+    bool stationInterface(uint32_t &ip, uint32_t &netmask, uint32_t &gateway) override;
+    bool arpRequest(uint32_t ip) override;
+    bool arpLookup(uint32_t ip, uint8_t mac[6]) override;
+    bool arpReply(uint32_t &ip, uint8_t mac[6]) override;
+
+private:
+    enum class SocketKind : uint8_t
+    {
+        TCP,
+        UDP,
+        RAW_TCP,
+        RAW_ICMP
+    };
+
+    // Something that becomes readable at readyUs
+    struct Delivery
+    {
+        uint64_t readyUs;
+        uint32_t fromIp;
+        uint16_t fromPort;
+        std::vector<uint8_t> data;
+    };
+
+    struct Socket
+    {
+        bool used;
+        SocketKind kind;
+        int fileFlags;
+        uint16_t localPort;
+        uint32_t remoteIp;
+        uint16_t remotePort;
+        bool connecting;
+        uint64_t connectDoneUs;  // UINT64_MAX while the SYN is unanswered
+        int soError;             // Reported once through SO_ERROR
+        bool refused;
+        bool requestSent;
+        const SimPort *service;
+        std::vector<Delivery> inbox; // Kept sorted by readyUs
+    };
+
+    struct ArpEntry
+    {
+        uint32_t ip;
+        uint64_t readyUs;   // Reply arrival
+        bool reported;      // Handed to arpReply()
+    };
+
+    std::vector<SimHost> hosts;
+    std::vector<Socket> sockets;
+    std::vector<ArpEntry> arpTable;
+    std::vector<uint64_t> nextAnnounceUs;  // Per host, UINT64_MAX = silent
+    VirtualClock vclock;
+    SimStats stats = {};
+    uint32_t stationIp = 0;
+    uint32_t stationMask = 0;
+    uint32_t gatewayIp = 0;
+    uint16_t nextEphemeralPort = 49152;
+    uint32_t callCostUs = 20;
+    int arpTableSize = 10;
+    uint32_t announceIntervalUs = 30000000;
+    uint64_t rngState = 1;
+
+    // Simulated descriptors start above anything the host process has open
+    static const int FD_BASE = 64;
+    Socket *lookup(int fd);
+    void charge();  // One socket call's worth of CPU time
+
+    uint64_t random64();
+    bool roll(float probability);
+    uint64_t oneWayDelay(const SimHost &host);
+
+    void deliver(Socket &sock, uint64_t readyUs, uint32_t fromIp, uint16_t fromPort,
+                 const uint8_t *data, size_t len);
+    void deliverRaw(SocketKind kind, uint64_t readyUs, const uint8_t *packet, size_t len);
+    bool readable(const Socket &sock) const;
+    bool writable(const Socket &sock) const;
+    uint64_t nextEvent(const Socket &sock, bool wantRead, bool wantWrite) const;
+
+    void answerSyn(const uint8_t *segment, size_t len, uint32_t dstIp);
+    void answerUdp(Socket &sock, uint32_t dstIp, uint16_t dstPort);
+    void answerEcho(const uint8_t *request, size_t len, uint32_t dstIp);
+    void learnArp(uint32_t ip, uint64_t readyUs);  // Resolved as a side effect of unicast traffic
+    void announce(uint64_t untilUs);  // Queue mDNS announcements due by untilUs
+};
+
+} // namespace sim
+
+#endif // SIM_NETWORK_H
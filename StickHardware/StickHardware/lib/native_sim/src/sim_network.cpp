@@ -0,0 +1,1081 @@
+#include "sim_network.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+
+// ============================================================================
+// Simulated Network - Implementation
+// ============================================================================
+
+namespace sim
+{
+
+// ============================================================================
+// Service catalog (open ports are drawn from here)
+// ============================================================================
+
+static const SimPort TCP_SERVICES[] = {
+    {21, false, PortKind::OPEN, "220 (vsFTPd 3.0.3)\r\n", 0, false},
+    {22, false, PortKind::OPEN, "SSH-2.0-OpenSSH_8.9p1 Ubuntu-3ubuntu0.6\r\n", 0, false},
+    {23, false, PortKind::OPEN, "\r\nUbuntu 22.04.3 LTS\r\nlogin: ", 0, false},
+    {25, false, PortKind::OPEN, "220 mail.lan ESMTP Postfix (Ubuntu)\r\n", 0, false},
+    {53, false, PortKind::OPEN, nullptr, 0, false},
+    {80, false, PortKind::OPEN, "HTTP/1.1 200 OK\r\nServer: nginx/1.18.0 (Ubuntu)\r\nContent-Length: 0\r\n\r\n", 0, true},
+    {110, false, PortKind::OPEN, "+OK Dovecot (Ubuntu) ready.\r\n", 0, false},
+    {139, false, PortKind::OPEN, nullptr, 0, false},
+    {443, false, PortKind::OPEN, nullptr, 0, false},
+    {445, false, PortKind::OPEN, nullptr, 0, false},
+    {554, false, PortKind::OPEN, nullptr, 0, false},
+    {631, false, PortKind::OPEN, "HTTP/1.1 200 OK\r\nServer: CUPS/2.4 IPP/2.1\r\n\r\n", 0, true},
+    {1883, false, PortKind::OPEN, nullptr, 0, false},
+    {3306, false, PortKind::OPEN, "J\0\0\0\n5.7.42-log\0", 17, false},
+    {3389, false, PortKind::OPEN, nullptr, 0, false},
+    {5900, false, PortKind::OPEN, "RFB 003.008\n", 0, false},
+    {8080, false, PortKind::OPEN, "HTTP/1.1 401 Unauthorized\r\nServer: lighttpd/1.4.59\r\n\r\n", 0, true},
+    {8443, false, PortKind::OPEN, nullptr, 0, false},
+    {9100, false, PortKind::OPEN, nullptr, 0, false},
+    {62078, false, PortKind::OPEN, nullptr, 0, false},
+};
+
+static const SimPort UDP_SERVICES[] = {
+    {53, true, PortKind::OPEN, "\x12\x34\x81\x80 dns", 9, false},
+    {123, true, PortKind::OPEN, "\x24\x02\x00\xe7 ntp", 8, false},
+    {161, true, PortKind::OPEN, "0) public sysDescr Linux", 0, false},
+    {1900, true, PortKind::OPEN, "HTTP/1.1 200 OK\r\nST: upnp:rootdevice\r\n\r\n", 0, false},
+    {5353, true, PortKind::OPEN, "\x00\x00\x84\x00 mdns", 9, false},
+};
+
+// Ports a non-firewalled host commonly drops anyway
+static const uint16_t BLOCKED_PORTS[] = {135, 137, 445, 1433, 5060};
+
+// Vendor prefixes (first ones are in the built-in OUI table)
+static const uint8_t SIM_OUIS[][3] = {
+    {0xB4, 0xE6, 0x2D}, {0x24, 0x0A, 0xC4}, {0x00, 0x17, 0xF2}, {0xAC, 0xBC, 0x32},
+    {0x00, 0x0C, 0x43}, {0x3C, 0x22, 0xFB}, {0xDC, 0xA6, 0x32}, {0x50, 0xC7, 0xBF},
+};
+
+// mDNS hostnames for announcing hosts (suffixed with the host number)
+static const char *const HOST_NAMES[] = {
+    "macbook", "iphone", "printer", "nas", "livingroom-tv", "raspberrypi", "esp32", "chromecast",
+};
+
+static const size_t IP_HEADER_SIZE = 20;
+static const uint16_t MDNS_PORT = 5353;
+static const uint8_t TCP_FLAG_SYN = 0x02;
+static const uint8_t TCP_FLAG_RST = 0x04;
+static const uint8_t TCP_FLAG_ACK = 0x10;
+
+static void writeBe16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static void writeBe32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static uint16_t readBe16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint32_t readBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Stateless variant of random64() for per-host traits that must not shift
+// the draws the scans depend on
+static uint64_t mixBits(uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Minimal IPv4 header (checksum is not verified by the receivers)
+static void writeIpHeader(uint8_t *p, uint8_t protocol, uint32_t src, uint32_t dst, size_t totalLen)
+{
+    memset(p, 0, IP_HEADER_SIZE);
+    p[0] = 0x45;
+    writeBe16(p + 2, (uint16_t)totalLen);
+    p[8] = 64; // TTL
+    p[9] = protocol;
+    memcpy(p + 12, &src, 4);
+    memcpy(p + 16, &dst, 4);
+}
+
+// ============================================================================
+// SimHost
+// ============================================================================
+
+const SimPort *SimHost::findPort(uint16_t port, bool udp) const
+{
+    for (const SimPort &p : ports)
+    {
+        if (p.port == port && p.udp == udp)
+            return &p;
+    }
+    return nullptr;
+}
+
+PortKind SimHost::tcpState(uint16_t port) const
+{
+    const SimPort *p = findPort(port, false);
+    return p ? p->kind : defaultTcp;
+}
+
+// ============================================================================
+// Network construction
+// ============================================================================
+
+uint64_t SimNetwork::random64()
+{
+    // splitmix64: independent of the HAL's esp_random() stream
+    uint64_t z = (rngState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+bool SimNetwork::roll(float probability)
+{
+    if (probability <= 0.0f)
+        return false;
+    return (random64() >> 40) < (uint64_t)(probability * (float)(1ULL << 24));
+}
+
+uint64_t SimNetwork::oneWayDelay(const SimHost &host)
+{
+    uint64_t jitter = host.jitterUs ? random64() % host.jitterUs : 0;
+    return host.latencyUs + jitter;
+}
+
+void SimNetwork::generate(const SimConfig &config)
+{
+    hosts.clear();
+    arpTable.clear();
+    nextAnnounceUs.clear();
+    for (Socket &sock : sockets)
+    {
+        sock.used = false;
+        sock.inbox.clear();
+    }
+    rngState = config.seed;
+    callCostUs = config.callCostUs;
+    vclock.setYieldCost(config.callCostUs);
+    arpTableSize = config.arpTableSize;
+    announceIntervalUs = config.announceIntervalUs;
+    resetStats();
+
+    uint32_t hostBits = 32 - config.prefixLength;
+    uint32_t size = hostBits >= 31 ? 0x80000000u : (1u << hostBits);
+    uint32_t maskHost = hostBits >= 32 ? 0 : ~(size - 1);
+    uint32_t base = config.network & maskHost;
+    stationIp = htonl(base | config.localHost);
+    stationMask = htonl(maskHost);
+    gatewayIp = htonl(base | 1);
+
+    // Live host numbers: the gateway plus hostCount distinct others
+    std::vector<uint32_t> picked;
+    picked.push_back(1);
+    int wanted = std::min<int>(config.hostCount, (int)size - 4);
+    while ((int)picked.size() < wanted + 1)
+    {
+        uint32_t h = 1 + (uint32_t)(random64() % (size - 2));
+        if (h == config.localHost || std::find(picked.begin(), picked.end(), h) != picked.end())
+            continue;
+        picked.push_back(h);
+    }
+    std::sort(picked.begin(), picked.end());
+
+    const size_t tcpCount = sizeof(TCP_SERVICES) / sizeof(TCP_SERVICES[0]);
+    const size_t udpCount = sizeof(UDP_SERVICES) / sizeof(UDP_SERVICES[0]);
+    const size_t blockedCount = sizeof(BLOCKED_PORTS) / sizeof(BLOCKED_PORTS[0]);
+    const size_t ouiCount = sizeof(SIM_OUIS) / sizeof(SIM_OUIS[0]);
+    const size_t nameCount = sizeof(HOST_NAMES) / sizeof(HOST_NAMES[0]);
+
+    for (uint32_t h : picked)
+    {
+        SimHost host;
+        host.ip = htonl(base | h);
+        const uint8_t *oui = SIM_OUIS[random64() % ouiCount];
+        uint64_t tail = random64();
+        host.mac[0] = oui[0];
+        host.mac[1] = oui[1];
+        host.mac[2] = oui[2];
+        host.mac[3] = (uint8_t)tail;
+        host.mac[4] = (uint8_t)(tail >> 8);
+        host.mac[5] = (uint8_t)(tail >> 16);
+
+        uint32_t span = config.maxLatencyUs > config.minLatencyUs ? config.maxLatencyUs - config.minLatencyUs : 0;
+        host.latencyUs = config.minLatencyUs + (span ? (uint32_t)(random64() % span) : 0);
+        host.jitterUs = config.jitterUs;
+        host.loss = config.loss;
+
+        bool firewalled = h != 1 && roll(config.firewalledFraction);
+        host.defaultTcp = firewalled ? PortKind::FILTERED : PortKind::CLOSED;
+        host.defaultUdp = firewalled ? PortKind::FILTERED : PortKind::CLOSED;
+
+        int openCount = config.maxOpenPorts > 0 ? 1 + (int)(random64() % config.maxOpenPorts) : 0;
+        for (int i = 0; i < openCount; i++)
+        {
+            const SimPort &svc = TCP_SERVICES[random64() % tcpCount];
+            if (!host.findPort(svc.port, false))
+                host.ports.push_back(svc);
+        }
+        if (!firewalled)
+        {
+            const SimPort &udp = UDP_SERVICES[random64() % udpCount];
+            host.ports.push_back(udp);
+            uint16_t blocked = BLOCKED_PORTS[random64() % blockedCount];
+            if (!host.findPort(blocked, false))
+                host.ports.push_back({blocked, false, PortKind::FILTERED, nullptr, 0, false});
+        }
+        else
+        {
+            // Firewalls usually still reset ident
+            host.ports.push_back({113, false, PortKind::CLOSED, nullptr, 0, false});
+        }
+
+        // Names and echo policy come from their own hash so the draws above
+        // stay the same. Many firewalls that drop TCP still allow ping.
+        uint64_t traits = mixBits(((uint64_t)config.seed << 32) + h);
+        if ((traits >> 40) < (uint64_t)(config.announceFraction * (float)(1ULL << 24)))
+            host.name = std::string(HOST_NAMES[traits % nameCount]) + "-" + std::to_string(h);
+        host.answersEcho = !firewalled || (traits & 0x100) != 0;
+        addHost(host);
+    }
+}
+
+void SimNetwork::addHost(const SimHost &host)
+{
+    hosts.push_back(host);
+
+    // First announcement at a per-host phase within one interval
+    uint64_t first = UINT64_MAX;
+    if (!host.name.empty() && announceIntervalUs > 0)
+        first = vclock.now() + mixBits(host.ip) % announceIntervalUs;
+    nextAnnounceUs.push_back(first);
+}
+
+void SimNetwork::removeHost(uint32_t ip)
+{
+    for (size_t i = 0; i < hosts.size(); i++)
+    {
+        if (hosts[i].ip == ip)
+        {
+            hosts.erase(hosts.begin() + i);
+            nextAnnounceUs.erase(nextAnnounceUs.begin() + i);
+            break;
+        }
+    }
+    arpTable.erase(std::remove_if(arpTable.begin(), arpTable.end(),
+                                  [ip](const ArpEntry &entry) { return entry.ip == ip; }),
+                   arpTable.end());
+}
+
+const SimHost *SimNetwork::findHost(uint32_t ip) const
+{
+    for (const SimHost &host : hosts)
+    {
+        if (host.ip == ip)
+            return &host;
+    }
+    return nullptr;
+}
+
+void SimNetwork::install()
+{
+    hal::setClock(&vclock);
+    hal::setNetBackend(this);
+}
+
+void SimNetwork::uninstall()
+{
+    hal::setClock(nullptr);
+    hal::setNetBackend(nullptr);
+}
+
+void SimNetwork::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+// ============================================================================
+// Socket table
+// ============================================================================
+
+SimNetwork::Socket *SimNetwork::lookup(int fd)
+{
+    int index = fd - FD_BASE;
+    if (index < 0 || index >= (int)sockets.size() || !sockets[index].used)
+    {
+        errno = EBADF;
+        return nullptr;
+    }
+    return &sockets[index];
+}
+
+void SimNetwork::charge()
+{
+    stats.socketCalls++;
+    vclock.advance(callCostUs);
+}
+
+int SimNetwork::socket(int domain, int type, int protocol)
+{
+    charge();
+    if (domain != AF_INET)
+    {
+        errno = EAFNOSUPPORT;
+        return -1;
+    }
+
+    SocketKind kind;
+    if (type == SOCK_STREAM)
+        kind = SocketKind::TCP;
+    else if (type == SOCK_DGRAM)
+        kind = SocketKind::UDP;
+    else if (type == SOCK_RAW && protocol == IPPROTO_TCP)
+        kind = SocketKind::RAW_TCP;
+    else if (type == SOCK_RAW && protocol == IPPROTO_ICMP)
+        kind = SocketKind::RAW_ICMP;
+    else
+    {
+        errno = EPROTONOSUPPORT;
+        return -1;
+    }
+
+    // Lowest free descriptor, like POSIX
+    size_t index = 0;
+    while (index < sockets.size() && sockets[index].used)
+        index++;
+    if (index == sockets.size())
+    {
+        if (FD_BASE + (int)index >= FD_SETSIZE)
+        {
+            errno = EMFILE;
+            return -1;
+        }
+        sockets.emplace_back();
+    }
+
+    Socket &sock = sockets[index];
+    sock.used = true;
+    sock.kind = kind;
+    sock.fileFlags = 0;
+    sock.localPort = 0;
+    sock.remoteIp = 0;
+    sock.remotePort = 0;
+    sock.connecting = false;
+    sock.connectDoneUs = 0;
+    sock.soError = 0;
+    sock.refused = false;
+    sock.requestSent = false;
+    sock.service = nullptr;
+    sock.inbox.clear();
+    return FD_BASE + (int)index;
+}
+
+int SimNetwork::bind(int fd, const struct sockaddr *addr, socklen_t len)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (len < (socklen_t)sizeof(struct sockaddr_in))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    uint16_t port = ntohs(((const struct sockaddr_in *)addr)->sin_port);
+    sock->localPort = port ? port : nextEphemeralPort++;
+    return 0;
+}
+
+int SimNetwork::getsockname(int fd, struct sockaddr *addr, socklen_t *len)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (sock->localPort == 0)
+        sock->localPort = nextEphemeralPort++;
+
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(sock->localPort);
+    local.sin_addr.s_addr = stationIp;
+    memcpy(addr, &local, std::min<size_t>(*len, sizeof(local)));
+    *len = sizeof(local);
+    return 0;
+}
+
+int SimNetwork::fcntl(int fd, int cmd, long arg)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (cmd == F_GETFL)
+        return sock->fileFlags | O_RDWR;
+    if (cmd == F_SETFL)
+    {
+        sock->fileFlags = (int)arg;
+        return 0;
+    }
+    return 0;
+}
+
+int SimNetwork::close(int fd)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    sock->used = false;
+    sock->inbox.clear();
+    return 0;
+}
+
+int SimNetwork::setsockopt(int fd, int level, int name, const void *value, socklen_t len)
+{
+    (void)level;
+    (void)name;
+    (void)value;
+    (void)len;
+    charge();
+    // Reuse, broadcast and group membership need no modelling: every UDP
+    // socket on 5353 hears the announcements
+    return lookup(fd) ? 0 : -1;
+}
+
+int SimNetwork::getsockopt(int fd, int level, int name, void *value, socklen_t *len)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (level == SOL_SOCKET && name == SO_ERROR && *len >= (socklen_t)sizeof(int))
+    {
+        int error = 0;
+        if (!sock->connecting || sock->connectDoneUs <= vclock.now())
+        {
+            error = sock->soError;
+            sock->soError = 0;
+        }
+        memcpy(value, &error, sizeof(int));
+        *len = sizeof(int);
+        return 0;
+    }
+    errno = ENOPROTOOPT;
+    return -1;
+}
+
+bool SimNetwork::stationInterface(uint32_t &ip, uint32_t &netmask, uint32_t &gateway)
+{
+    ip = stationIp;
+    netmask = stationMask;
+    gateway = gatewayIp;
+    return stationIp != 0;
+}
+
+// ============================================================================
+// Delivery and readiness
+// ============================================================================
+
+void SimNetwork::deliver(Socket &sock, uint64_t readyUs, uint32_t fromIp, uint16_t fromPort,
+                         const uint8_t *data, size_t len)
+{
+    Delivery d;
+    d.readyUs = readyUs;
+    d.fromIp = fromIp;
+    d.fromPort = fromPort;
+    d.data.assign(data, data + len);
+
+    auto pos = std::upper_bound(sock.inbox.begin(), sock.inbox.end(), readyUs,
+                                [](uint64_t t, const Delivery &x) { return t < x.readyUs; });
+    sock.inbox.insert(pos, std::move(d));
+}
+
+void SimNetwork::deliverRaw(SocketKind kind, uint64_t readyUs, const uint8_t *packet, size_t len)
+{
+    for (Socket &sock : sockets)
+    {
+        if (sock.used && sock.kind == kind)
+        {
+            uint32_t src;
+            memcpy(&src, packet + 12, 4);
+            deliver(sock, readyUs, src, 0, packet, len);
+        }
+    }
+}
+
+bool SimNetwork::readable(const Socket &sock) const
+{
+    return !sock.inbox.empty() && sock.inbox.front().readyUs <= vclock.now();
+}
+
+bool SimNetwork::writable(const Socket &sock) const
+{
+    if (sock.kind != SocketKind::TCP)
+        return true;
+    return !sock.connecting || sock.connectDoneUs <= vclock.now();
+}
+
+uint64_t SimNetwork::nextEvent(const Socket &sock, bool wantRead, bool wantWrite) const
+{
+    uint64_t next = UINT64_MAX;
+    if (wantRead && !sock.inbox.empty())
+        next = std::min(next, sock.inbox.front().readyUs);
+    if (wantWrite && sock.kind == SocketKind::TCP && sock.connecting)
+        next = std::min(next, sock.connectDoneUs);
+    return next;
+}
+
+int SimNetwork::select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *errorSet,
+                       struct timeval *timeout)
+{
+    charge();
+
+    fd_set wantRead;
+    fd_set wantWrite;
+    FD_ZERO(&wantRead);
+    FD_ZERO(&wantWrite);
+    if (readSet)
+        wantRead = *readSet;
+    if (writeSet)
+        wantWrite = *writeSet;
+    if (errorSet)
+        FD_ZERO(errorSet);
+
+    uint64_t deadline = UINT64_MAX;
+    if (timeout)
+        deadline = vclock.now() + (uint64_t)timeout->tv_sec * 1000000 + timeout->tv_usec;
+    announce(deadline != UINT64_MAX ? deadline : vclock.now() + announceIntervalUs);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int ready = 0;
+        uint64_t next = UINT64_MAX;
+        if (readSet)
+            FD_ZERO(readSet);
+        if (writeSet)
+            FD_ZERO(writeSet);
+
+        for (int fd = FD_BASE; fd < nfds; fd++)
+        {
+            bool r = FD_ISSET(fd, &wantRead);
+            bool w = FD_ISSET(fd, &wantWrite);
+            if (!r && !w)
+                continue;
+            Socket *sock = lookup(fd);
+            if (!sock)
+                continue;
+
+            if (r && readable(*sock))
+            {
+                FD_SET(fd, readSet);
+                ready++;
+            }
+            if (w && writable(*sock))
+            {
+                FD_SET(fd, writeSet);
+                ready++;
+            }
+            next = std::min(next, nextEvent(*sock, r, w));
+        }
+
+        if (ready > 0 || pass == 1)
+            return ready;
+
+        // Nothing yet: jump to the next event, or to the deadline
+        if (next == UINT64_MAX && deadline == UINT64_MAX)
+            return 0;
+        vclock.advanceTo(std::min(next, deadline));
+    }
+    return 0;
+}
+
+// ============================================================================
+// TCP
+// ============================================================================
+
+int SimNetwork::connect(int fd, const struct sockaddr *addr, socklen_t len)
+{
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (sock->kind != SocketKind::TCP || len < (socklen_t)sizeof(struct sockaddr_in))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    const struct sockaddr_in *in = (const struct sockaddr_in *)addr;
+    sock->remoteIp = in->sin_addr.s_addr;
+    sock->remotePort = ntohs(in->sin_port);
+    sock->localPort = nextEphemeralPort++;
+    if (nextEphemeralPort < 49152)
+        nextEphemeralPort = 49152;
+    sock->connecting = true;
+    sock->connectDoneUs = UINT64_MAX;
+    sock->soError = 0;
+    sock->refused = false;
+    stats.tcpConnects++;
+
+    const SimHost *host = findHost(sock->remoteIp);
+    PortKind kind = host ? host->tcpState(sock->remotePort) : PortKind::FILTERED;
+    if (kind != PortKind::FILTERED)
+    {
+        // The stack retransmits a lost SYN after 1 s, then 2 s more
+        static const uint64_t RETRY_US[] = {0, 1000000, 3000000};
+        for (uint64_t retry : RETRY_US)
+        {
+            if (roll(host->loss) || roll(host->loss))
+            {
+                stats.dropped++;
+                continue;
+            }
+            uint64_t sentUs = vclock.now() + retry;
+            sock->connectDoneUs = sentUs + oneWayDelay(*host) + oneWayDelay(*host);
+            break;
+        }
+    }
+
+    if (sock->connectDoneUs != UINT64_MAX)
+    {
+        if (kind == PortKind::OPEN)
+        {
+            sock->service = host->findPort(sock->remotePort, false);
+            if (sock->service && sock->service->banner && !sock->service->waitsForRequest)
+            {
+                size_t n = sock->service->bannerLength ? sock->service->bannerLength
+                                                        : strlen(sock->service->banner);
+                // Server greets once our ACK arrives
+                uint64_t at = sock->connectDoneUs + oneWayDelay(*host) + oneWayDelay(*host);
+                deliver(*sock, at, sock->remoteIp, sock->remotePort,
+                        (const uint8_t *)sock->service->banner, n);
+            }
+        }
+        else
+        {
+            sock->soError = ECONNREFUSED;
+            sock->refused = true;
+        }
+    }
+
+    errno = EINPROGRESS;
+    return -1;
+}
+
+ssize_t SimNetwork::send(int fd, const void *buf, size_t len, int flags)
+{
+    (void)buf;
+    (void)flags;
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (sock->kind != SocketKind::TCP)
+    {
+        errno = EDESTADDRREQ;
+        return -1;
+    }
+    if (sock->connecting && sock->connectDoneUs > vclock.now())
+    {
+        errno = ENOTCONN;
+        return -1;
+    }
+    sock->connecting = false;
+    if (sock->refused)
+    {
+        errno = ECONNRESET;
+        return -1;
+    }
+
+    if (len > 0 && !sock->requestSent && sock->service && sock->service->banner &&
+        sock->service->waitsForRequest)
+    {
+        const SimHost *host = findHost(sock->remoteIp);
+        size_t n = sock->service->bannerLength ? sock->service->bannerLength
+                                                : strlen(sock->service->banner);
+        uint64_t at = vclock.now() + oneWayDelay(*host) + oneWayDelay(*host);
+        deliver(*sock, at, sock->remoteIp, sock->remotePort,
+                (const uint8_t *)sock->service->banner, n);
+    }
+    sock->requestSent = true;
+    return (ssize_t)len;
+}
+
+ssize_t SimNetwork::recv(int fd, void *buf, size_t len, int flags)
+{
+    return recvfrom(fd, buf, len, flags, nullptr, nullptr);
+}
+
+ssize_t SimNetwork::recvfrom(int fd, void *buf, size_t len, int flags,
+                             struct sockaddr *addr, socklen_t *addrLen)
+{
+    (void)flags; // Everything is non-blocking here
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    announce(vclock.now());
+    if (!readable(*sock))
+    {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    Delivery &d = sock->inbox.front();
+    size_t n = std::min(len, d.data.size());
+    memcpy(buf, d.data.data(), n);
+
+    if (addr && addrLen)
+    {
+        struct sockaddr_in from;
+        memset(&from, 0, sizeof(from));
+        from.sin_family = AF_INET;
+        from.sin_port = htons(d.fromPort);
+        from.sin_addr.s_addr = d.fromIp;
+        memcpy(addr, &from, std::min<size_t>(*addrLen, sizeof(from)));
+        *addrLen = sizeof(from);
+    }
+
+    // Streams keep the unread tail; datagrams are consumed whole
+    if (sock->kind == SocketKind::TCP && n < d.data.size())
+        d.data.erase(d.data.begin(), d.data.begin() + n);
+    else
+        sock->inbox.erase(sock->inbox.begin());
+    return (ssize_t)n;
+}
+
+// ============================================================================
+// Datagrams and raw sockets
+// ============================================================================
+
+ssize_t SimNetwork::sendto(int fd, const void *buf, size_t len, int flags,
+                           const struct sockaddr *addr, socklen_t addrLen)
+{
+    (void)flags;
+    charge();
+    Socket *sock = lookup(fd);
+    if (!sock)
+        return -1;
+    if (!addr || addrLen < (socklen_t)sizeof(struct sockaddr_in))
+    {
+        errno = EDESTADDRREQ;
+        return -1;
+    }
+
+    const struct sockaddr_in *in = (const struct sockaddr_in *)addr;
+    switch (sock->kind)
+    {
+    case SocketKind::UDP:
+        if (sock->localPort == 0)
+            sock->localPort = nextEphemeralPort++;
+        stats.udpSent++;
+        answerUdp(*sock, in->sin_addr.s_addr, ntohs(in->sin_port));
+        return (ssize_t)len;
+    case SocketKind::RAW_TCP:
+        stats.synSent++;
+        answerSyn((const uint8_t *)buf, len, in->sin_addr.s_addr);
+        return (ssize_t)len;
+    case SocketKind::RAW_ICMP:
+        stats.echoSent++;
+        answerEcho((const uint8_t *)buf, len, in->sin_addr.s_addr);
+        return (ssize_t)len;
+    default:
+        errno = EISCONN;
+        return -1;
+    }
+}
+
+void SimNetwork::answerSyn(const uint8_t *segment, size_t len, uint32_t dstIp)
+{
+    if (len < 20 || !(segment[13] & TCP_FLAG_SYN))
+        return;
+
+    const SimHost *host = findHost(dstIp);
+    if (!host)
+        return;
+    if (roll(host->loss) || roll(host->loss))
+    {
+        stats.dropped++;
+        return;
+    }
+
+    uint16_t srcPort = readBe16(segment);
+    uint16_t dstPort = readBe16(segment + 2);
+    uint32_t seq = readBe32(segment + 4);
+    PortKind kind = host->tcpState(dstPort);
+    if (kind == PortKind::FILTERED)
+        return;
+
+    uint8_t packet[IP_HEADER_SIZE + 20];
+    writeIpHeader(packet, IPPROTO_TCP, dstIp, stationIp, sizeof(packet));
+    uint8_t *tcp = packet + IP_HEADER_SIZE;
+    memset(tcp, 0, 20);
+    writeBe16(tcp + 0, dstPort);
+    writeBe16(tcp + 2, srcPort);
+    writeBe32(tcp + 4, kind == PortKind::OPEN ? (uint32_t)random64() : 0);
+    writeBe32(tcp + 8, seq + 1);
+    tcp[12] = 5 << 4;
+    tcp[13] = kind == PortKind::OPEN ? (TCP_FLAG_SYN | TCP_FLAG_ACK) : (TCP_FLAG_RST | TCP_FLAG_ACK);
+    writeBe16(tcp + 14, kind == PortKind::OPEN ? 64240 : 0);
+
+    uint64_t at = vclock.now() + oneWayDelay(*host) + oneWayDelay(*host);
+    deliverRaw(SocketKind::RAW_TCP, at, packet, sizeof(packet));
+}
+
+void SimNetwork::answerUdp(Socket &sock, uint32_t dstIp, uint16_t dstPort)
+{
+    const SimHost *host = findHost(dstIp);
+    if (!host)
+        return;
+    if (roll(host->loss) || roll(host->loss))
+    {
+        stats.dropped++;
+        return;
+    }
+
+    const SimPort *port = host->findPort(dstPort, true);
+    PortKind kind = port ? port->kind : host->defaultUdp;
+    uint64_t at = vclock.now() + oneWayDelay(*host) + oneWayDelay(*host);
+
+    if (kind == PortKind::OPEN && port && port->banner)
+    {
+        size_t n = port->bannerLength ? port->bannerLength : strlen(port->banner);
+        deliver(sock, at, dstIp, dstPort, (const uint8_t *)port->banner, n);
+    }
+    else if (kind == PortKind::CLOSED)
+    {
+        // Outer IP | ICMP 3/3 | quoted IP header | quoted UDP header
+        uint8_t packet[IP_HEADER_SIZE + 8 + IP_HEADER_SIZE + 8];
+        writeIpHeader(packet, IPPROTO_ICMP, dstIp, stationIp, sizeof(packet));
+        uint8_t *icmp = packet + IP_HEADER_SIZE;
+        memset(icmp, 0, 8);
+        icmp[0] = 3;
+        icmp[1] = 3;
+        writeIpHeader(icmp + 8, IPPROTO_UDP, stationIp, dstIp, IP_HEADER_SIZE + 8);
+        uint8_t *udp = icmp + 8 + IP_HEADER_SIZE;
+        writeBe16(udp + 0, sock.localPort);
+        writeBe16(udp + 2, dstPort);
+        writeBe16(udp + 4, 8);
+        writeBe16(udp + 6, 0);
+        deliverRaw(SocketKind::RAW_ICMP, at, packet, sizeof(packet));
+    }
+}
+
+void SimNetwork::answerEcho(const uint8_t *request, size_t len, uint32_t dstIp)
+{
+    if (len < 8 || request[0] != 8)
+        return;
+
+    const SimHost *host = findHost(dstIp);
+    if (!host)
+        return;
+    if (roll(host->loss) || roll(host->loss))
+    {
+        stats.dropped++;
+        return;
+    }
+
+    // Sending at all resolved the host, whether or not it answers
+    uint64_t at = vclock.now() + oneWayDelay(*host) + oneWayDelay(*host);
+    learnArp(dstIp, at);
+    if (!host->answersEcho)
+        return;
+
+    // Outer IP | the request echoed back as type 0
+    std::vector<uint8_t> packet(IP_HEADER_SIZE + len);
+    writeIpHeader(packet.data(), IPPROTO_ICMP, dstIp, stationIp, packet.size());
+    memcpy(packet.data() + IP_HEADER_SIZE, request, len);
+    packet[IP_HEADER_SIZE] = 0;
+    deliverRaw(SocketKind::RAW_ICMP, at, packet.data(), packet.size());
+}
+
+// ============================================================================
+// mDNS announcements
+// ============================================================================
+
+// Unsolicited response: one A record "<name>.local" (cache-flush class)
+static size_t writeAnnouncement(const SimHost &host, uint8_t *out)
+{
+    memset(out, 0, 12);
+    writeBe16(out + 2, 0x8400); // Response, authoritative
+    writeBe16(out + 6, 1);      // ANCOUNT
+    size_t n = 12;
+
+    size_t labelLength = std::min<size_t>(host.name.size(), 63);
+    out[n++] = (uint8_t)labelLength;
+    memcpy(out + n, host.name.data(), labelLength);
+    n += labelLength;
+    out[n++] = 5;
+    memcpy(out + n, "local", 5);
+    n += 5;
+    out[n++] = 0;
+
+    writeBe16(out + n, 1);       // A
+    writeBe16(out + n + 2, 0x8001);
+    writeBe32(out + n + 4, 120); // TTL
+    writeBe16(out + n + 8, 4);
+    memcpy(out + n + 10, &host.ip, 4);
+    return n + 14;
+}
+
+void SimNetwork::announce(uint64_t untilUs)
+{
+    bool listening = false;
+    for (const Socket &sock : sockets)
+        listening |= sock.used && sock.kind == SocketKind::UDP && sock.localPort == MDNS_PORT;
+
+    for (size_t i = 0; i < hosts.size(); i++)
+    {
+        uint64_t &next = nextAnnounceUs[i];
+        if (next > untilUs)
+            continue;
+        if (!listening)
+        {
+            // Nobody hears them; skip the missed announcements in one step
+            next += ((untilUs - next) / announceIntervalUs + 1) * announceIntervalUs;
+            continue;
+        }
+
+        const SimHost &host = hosts[i];
+        while (next <= untilUs)
+        {
+            uint64_t sentUs = next;
+            next += announceIntervalUs;
+            stats.announcements++;
+            if (roll(host.loss))
+            {
+                stats.dropped++;
+                continue;
+            }
+
+            uint8_t packet[128];
+            size_t len = writeAnnouncement(host, packet);
+            uint64_t at = sentUs + oneWayDelay(host);
+            for (Socket &sock : sockets)
+            {
+                if (sock.used && sock.kind == SocketKind::UDP && sock.localPort == MDNS_PORT)
+                    deliver(sock, at, host.ip, MDNS_PORT, packet, len);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// ARP
+// ============================================================================
+
+bool SimNetwork::arpRequest(uint32_t ip)
+{
+    charge();
+    stats.arpRequests++;
+
+    const SimHost *host = findHost(ip);
+    if (!host)
+        return true; // Broadcast goes out; nobody answers
+    if (roll(host->loss) || roll(host->loss))
+    {
+        stats.dropped++;
+        return true;
+    }
+
+    uint64_t at = vclock.now() + oneWayDelay(*host) + oneWayDelay(*host);
+    for (ArpEntry &entry : arpTable)
+    {
+        if (entry.ip == ip)
+        {
+            // A fresh reply re-inserts an entry that may have been evicted
+            if (entry.readyUs <= vclock.now())
+            {
+                entry.readyUs = at;
+                entry.reported = false;
+            }
+            else
+            {
+                entry.readyUs = std::min(entry.readyUs, at);
+            }
+            return true;
+        }
+    }
+    arpTable.push_back({ip, at, false});
+    return true;
+}
+
+void SimNetwork::learnArp(uint32_t ip, uint64_t readyUs)
+{
+    // Reported up front: only broadcast sweeps see replies on the input path
+    for (ArpEntry &entry : arpTable)
+    {
+        if (entry.ip == ip)
+        {
+            entry.readyUs = readyUs;
+            entry.reported = true;
+            return;
+        }
+    }
+    arpTable.push_back({ip, readyUs, true});
+}
+
+bool SimNetwork::arpLookup(uint32_t ip, uint8_t mac[6])
+{
+    charge();
+    uint64_t now = vclock.now();
+    for (const ArpEntry &entry : arpTable)
+    {
+        if (entry.ip != ip || entry.readyUs > now)
+            continue;
+
+        // Each arriving reply takes the oldest slot
+        int newer = 0;
+        for (const ArpEntry &other : arpTable)
+        {
+            if (other.readyUs > entry.readyUs && other.readyUs <= now)
+                newer++;
+        }
+        if (arpTableSize > 0 && newer >= arpTableSize)
+            return false;
+
+        const SimHost *host = findHost(ip);
+        memcpy(mac, host->mac, 6);
+        return true;
+    }
+    return false;
+}
+
+bool SimNetwork::arpReply(uint32_t &ip, uint8_t mac[6])
+{
+    // Earliest arrival not yet handed out; the table size does not apply
+    ArpEntry *next = nullptr;
+    for (ArpEntry &entry : arpTable)
+    {
+        if (!entry.reported && entry.readyUs <= vclock.now() &&
+            (!next || entry.readyUs < next->readyUs))
+            next = &entry;
+    }
+    if (!next)
+        return false;
+
+    next->reported = true;
+    ip = next->ip;
+    memcpy(mac, findHost(ip)->mac, 6);
+    return true;
+}
+
+} // namespace sim
@@ -0,0 +1,225 @@
+"""Generate the banner signature automaton.
+
+Inputs:  tables/banner_signatures.txt (vulnerability signatures) and the
+         required literal of every match in tables/service_probes.txt
+Outputs: src/generated/banner_signature_ids.h  (SIG_* ids, shared)
+         src/generated/banner_automaton.h      (tables for banner_matcher.cpp)
+
+All literals are folded to lower case and compiled into one Aho-Corasick
+automaton, flattened to a DFA over byte classes so a scan costs one table
+lookup per byte. Each state carries the bitmask of every signature that ends
+there (including via failure links), as many 64-bit words as the signature
+count needs.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand: python scripts/gen_banner_signatures.py
+"""
+
+import os
+import re
+import sys
+from collections import deque
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+sys.path.insert(0, os.path.join(PROJECT_DIR, "scripts"))
+from service_probe_defs import DefinitionError, parse, service_signatures, unescape  # noqa: E402
+
+SIGNATURES = os.path.join(PROJECT_DIR, "tables", "banner_signatures.txt")
+PROBES = os.path.join(PROJECT_DIR, "tables", "service_probes.txt")
+IDS_OUTPUT = os.path.join(PROJECT_DIR, "src", "generated", "banner_signature_ids.h")
+AUTOMATON_OUTPUT = os.path.join(PROJECT_DIR, "src", "generated", "banner_automaton.h")
+
+MAX_SIGNATURES = 255  # ids are uint8_t and 0xFF is SIG_NONE
+LINE_RE = re.compile(r'^([A-Z0-9_]+)\s+"((?:[^"\\]|\\.)*)"$')
+
+
+def fold(data):
+    return bytes(data).lower()
+
+
+def parse_signatures(path):
+    signatures = []
+    with open(path) as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.strip()
+            if not line or line.startswith("#"):
+                continue
+            where = "%s:%d" % (os.path.basename(path), lineno)
+            m = LINE_RE.match(line)
+            if not m:
+                raise DefinitionError("%s: expected NAME \"literal\"" % where)
+            literal = fold(b for b, _ in unescape(m.group(2), where))
+            if not literal:
+                raise DefinitionError("%s: empty literal" % where)
+            signatures.append(("SIG_" + m.group(1), literal))
+    return signatures
+
+
+def build(literals):
+    """Returns (class_of_byte, class_count, delta rows, output masks)."""
+    alphabet = sorted(set(b for lit in literals for b in lit))
+    class_of = [0] * 256
+    for index, b in enumerate(alphabet, 1):
+        class_of[b] = index
+        if ord("a") <= b <= ord("z"):
+            class_of[b - 32] = index  # upper case folds onto lower
+    classes = len(alphabet) + 1
+
+    goto = [{}]
+    output = [0]
+    for sig, lit in enumerate(literals):
+        state = 0
+        for b in lit:
+            c = class_of[b]
+            if c not in goto[state]:
+                goto.append({})
+                output.append(0)
+                goto[state][c] = len(goto) - 1
+            state = goto[state][c]
+        output[state] |= 1 << sig
+
+    fail = [0] * len(goto)
+    delta = [[0] * classes for _ in goto]
+    queue = deque()
+    for c in range(classes):
+        if c in goto[0]:
+            delta[0][c] = goto[0][c]
+            queue.append(goto[0][c])
+    while queue:
+        state = queue.popleft()
+        output[state] |= output[fail[state]]
+        for c in range(classes):
+            if c in goto[state]:
+                child = goto[state][c]
+                fail[child] = delta[fail[state]][c]
+                delta[state][c] = child
+                queue.append(child)
+            else:
+                delta[state][c] = delta[fail[state]][c]
+    return class_of, classes, delta, output
+
+
+def c_literal(data):
+    out = []
+    for b in data:
+        if 32 <= b < 127 and chr(b) not in "\\\"":
+            out.append(chr(b))
+        else:
+            out.append("\\x%02x" % b)
+    return "".join(out)
+
+
+def mask_words(count):
+    return max(1, (count + 63) // 64)
+
+
+def render_ids(names, literals):
+    return "\n".join([
+        "// Generated by scripts/gen_banner_signatures.py - do not edit",
+        "#ifndef BANNER_SIGNATURE_IDS_H",
+        "#define BANNER_SIGNATURE_IDS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum BannerSignature : uint8_t",
+        "{",
+    ] + ["    %s = %d, // \"%s\"" % (name, i, c_literal(lit)) for i, (name, lit) in enumerate(zip(names, literals))] + [
+        "    BANNER_SIGNATURE_COUNT = %d," % len(names),
+        "    SIG_NONE = 0xFF",
+        "};",
+        "",
+        "// uint64_t words in a signature mask",
+        "static constexpr int BANNER_SIGNATURE_WORDS = %d;" % mask_words(len(names)),
+        "",
+        "#endif // BANNER_SIGNATURE_IDS_H",
+        "",
+    ])
+
+
+def render_automaton(class_of, classes, delta, output, signatures):
+    state_type = "uint8_t" if len(delta) <= 256 else "uint16_t"
+    class_rows = []
+    for i in range(0, 256, 16):
+        class_rows.append("    " + ", ".join("%d" % c for c in class_of[i:i + 16]) + ",")
+    delta_rows = ["    " + ", ".join("%d" % s for s in row) + "," for row in delta]
+    words = mask_words(signatures)
+    masks = [(m >> (64 * w)) & (2 ** 64 - 1) for m in output for w in range(words)]
+    output_rows = []
+    for i in range(0, len(masks), 4):
+        output_rows.append("    " + ", ".join("0x%016xULL" % m for m in masks[i:i + 4]) + ",")
+
+    return "\n".join([
+        "// Generated by scripts/gen_banner_signatures.py - do not edit",
+        "#ifndef BANNER_AUTOMATON_H",
+        "#define BANNER_AUTOMATON_H",
+        "",
+        "#include <stdint.h>",
+        "#include <stddef.h>",
+        "#include \"banner_signature_ids.h\"",
+        "",
+        "static constexpr size_t BANNER_AC_STATES = %d;" % len(delta),
+        "static constexpr size_t BANNER_AC_CLASSES = %d;" % classes,
+        "typedef %s BannerAcState;" % state_type,
+        "",
+        "// Byte -> class; class 0 is every byte no signature uses",
+        "static constexpr uint8_t BANNER_AC_CLASS[256] = {",
+    ] + class_rows + [
+        "};",
+        "",
+        "// Next state, BANNER_AC_CLASSES entries per state",
+        "static constexpr BannerAcState BANNER_AC_DELTA[] = {",
+    ] + delta_rows + [
+        "};",
+        "",
+        "// Signatures recognised on entering each state, BANNER_SIGNATURE_WORDS per state",
+        "static constexpr uint64_t BANNER_AC_OUTPUT[] = {",
+    ] + output_rows + [
+        "};",
+        "",
+        "static_assert(sizeof(BANNER_AC_DELTA) / sizeof(BANNER_AC_DELTA[0]) == BANNER_AC_STATES * BANNER_AC_CLASSES, \"table size\");",
+        "static_assert(sizeof(BANNER_AC_OUTPUT) / sizeof(BANNER_AC_OUTPUT[0]) == BANNER_AC_STATES * BANNER_SIGNATURE_WORDS, \"table size\");",
+        "",
+        "#endif // BANNER_AUTOMATON_H",
+        "",
+    ])
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    except IOError:
+        pass
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def generate():
+    probes, _ = parse(PROBES)
+    service_literals, _ = service_signatures(probes)
+    names = ["SIG_SERVICE_%d" % i for i in range(len(service_literals))]
+    literals = list(service_literals)
+    for name, literal in parse_signatures(SIGNATURES):
+        if name in names:
+            raise DefinitionError("duplicate signature %s" % name)
+        names.append(name)
+        literals.append(literal)
+    if len(literals) > MAX_SIGNATURES:
+        raise DefinitionError("%d signatures; ids stop at %d" % (len(literals), MAX_SIGNATURES))
+
+    class_of, classes, delta, output = build(literals)
+    changed = write_if_changed(IDS_OUTPUT, render_ids(names, literals))
+    changed |= write_if_changed(AUTOMATON_OUTPUT, render_automaton(class_of, classes, delta, output, len(literals)))
+    if changed:
+        print("gen_banner_signatures: %d signatures, %d states x %d classes" % (len(literals), len(delta), classes))
+
+
+generate()
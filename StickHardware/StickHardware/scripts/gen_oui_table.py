@@ -0,0 +1,194 @@
+"""Generate src/generated/oui_table.h from the IEEE registry CSVs in tables/oui/.
+
+Inputs:  tables/oui/seed.csv (committed subset), then any other *.csv in the
+         same directory (IEEE oui.csv, mam.csv, oui36.csv), whose rows win
+Output:  src/generated/oui_table.h (tables for lookupVendor())
+
+Each registry (MA-L 24-bit, MA-M 28-bit, MA-S/IAB 36-bit prefixes) becomes a
+sorted array of fixed-size records: the prefix left-aligned in whole bytes
+(unused low bits zero) followed by the vendor's offset in a string pool.
+Vendor names are shortened (legal suffixes dropped, capitals tamed),
+truncated to fit NetworkDevice::vendor and stored once each. The firmware
+binary-searches the records with memcmp, longest prefix first.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand: python scripts/gen_oui_table.py
+"""
+
+import csv
+import glob
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "tables", "oui")
+SEED = os.path.join(SOURCE_DIR, "seed.csv")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "generated", "oui_table.h")
+
+VENDOR_MAX = 31  # NetworkDevice::vendor is char[32]
+
+# Registry column -> prefix length in bits
+REGISTRIES = {"MA-L": 24, "MA-M": 28, "MA-S": 36, "IAB": 36}
+
+# Blocks that are subdivided further; their MA-L row names no vendor
+SKIPPED_NAMES = {"ieee registration authority", "private"}
+
+SUFFIX_RE = re.compile(
+    r"[\s,.]+(co\.?,?\s*ltd|inc|incorporated|corporation|corporate|corp|llc|ltd|limited|"
+    r"gmbh|ag|s\.?a|b\.?v|plc|co|company)\.?$", re.IGNORECASE)
+
+
+class OuiError(Exception):
+    pass
+
+
+def shorten(name):
+    name = " ".join(name.split())
+    while True:
+        stripped = SUFFIX_RE.sub("", name).rstrip(" ,.")
+        if stripped == name or not stripped:
+            break
+        name = stripped
+    # "SAMSUNG ELECTRONICS" -> "Samsung Electronics"; keeps "TP-LINK", "AVM"
+    words = [w.title() if w.isalpha() and w.isupper() and len(w) > 4 else w for w in name.split()]
+    name = " ".join(words)
+    if len(name) > VENDOR_MAX:
+        name = name[:VENDOR_MAX].rsplit(" ", 1)[0] if " " in name[:VENDOR_MAX] else name[:VENDOR_MAX]
+    return name
+
+
+def parse(path, entries):
+    with open(path, newline="", encoding="utf-8") as f:
+        lines = (line for line in f if not line.startswith("#"))
+        for lineno, row in enumerate(csv.DictReader(lines), 2):
+            where = "%s:%d" % (os.path.basename(path), lineno)
+            bits = REGISTRIES.get((row.get("Registry") or "").strip())
+            if bits is None:
+                raise OuiError("%s: unknown registry %r" % (where, row.get("Registry")))
+            assignment = (row.get("Assignment") or "").strip().upper()
+            if not re.fullmatch(r"[0-9A-F]{%d}" % (bits // 4), assignment):
+                raise OuiError("%s: bad %d-bit assignment %r" % (where, bits, assignment))
+            name = (row.get("Organization Name") or "").strip()
+            if not name or name.lower() in SKIPPED_NAMES:
+                continue
+            entries[(bits, assignment)] = shorten(name)
+
+
+def record_key(bits, assignment):
+    # Left-aligned in whole bytes: a 28-bit prefix "ABCDEF1" -> AB CD EF 10
+    digits = assignment + "0" * ((-len(assignment)) % 2)
+    return bytes.fromhex(digits)
+
+
+def build(entries):
+    names = sorted(set(entries.values()))
+    pool = bytearray()
+    offsets = {}
+    for name in names:
+        offsets[name] = len(pool)
+        pool += name.encode("ascii", "replace") + b"\0"
+    offset_bytes = 2 if len(pool) <= 0xFFFF else 3
+
+    tables = {}
+    for bits in sorted(set(REGISTRIES.values())):
+        records = sorted((record_key(b, a), offsets[n]) for (b, a), n in entries.items() if b == bits)
+        tables[bits] = records
+    return pool, offset_bytes, tables
+
+
+def c_string(data):
+    out = []
+    for b in data:
+        c = chr(b)
+        if c in "\\\"":
+            out.append("\\" + c)
+        elif 0x20 <= b < 0x7F:
+            out.append(c)
+        else:
+            out.append("\\x%02x" % b)
+    return "".join(out)
+
+
+def render(pool, offset_bytes, tables, sources):
+    names = pool.split(b"\0")[:-1]
+    pool_rows = ['    "%s\\0"' % c_string(n) for n in names]
+
+    lines = [
+        "// Generated by scripts/gen_oui_table.py from %s - do not edit" % ", ".join(sources),
+        "#ifndef OUI_TABLE_H",
+        "#define OUI_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "#include <stddef.h>",
+        "",
+        "// Vendor names, NUL-separated; records hold byte offsets into it",
+        "static constexpr char OUI_VENDOR_POOL[] =",
+    ] + pool_rows + [
+        "    ;",
+        "static constexpr size_t OUI_VENDOR_POOL_SIZE = %d;" % len(pool),
+        "static constexpr size_t OUI_VENDOR_COUNT = %d;" % len(names),
+        "static constexpr size_t OUI_OFFSET_BYTES = %d; // Big-endian, after the prefix" % offset_bytes,
+    ]
+
+    for bits, label in ((24, "MAL"), (28, "MAM"), (36, "MAS")):
+        records = tables[bits]
+        key_bytes = (bits + 7) // 8
+        lines += [
+            "",
+            "// %d-bit prefixes, sorted; %d key bytes + offset per record" % (bits, key_bytes),
+            "static constexpr size_t OUI_%s_COUNT = %d;" % (label, len(records)),
+        ]
+        if not records:
+            # Keep the symbol so lookups compile; the count says it is empty
+            lines.append("static constexpr uint8_t OUI_%s_RECORDS[1] = {0};" % label)
+            continue
+        lines.append("static constexpr uint8_t OUI_%s_RECORDS[] = {" % label)
+        for key, offset in records:
+            data = list(key) + list(offset.to_bytes(offset_bytes, "big"))
+            lines.append("    " + ", ".join("0x%02X" % b for b in data) + ",")
+        lines.append("};")
+
+    lines += [
+        "",
+        "#endif // OUI_TABLE_H",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    except IOError:
+        pass
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def generate():
+    paths = [SEED] + sorted(p for p in glob.glob(os.path.join(SOURCE_DIR, "*.csv")) if p != SEED)
+    entries = {}
+    for path in paths:
+        parse(path, entries)
+    pool, offset_bytes, tables = build(entries)
+
+    sources = [os.path.relpath(p, PROJECT_DIR).replace(os.sep, "/") for p in paths]
+    if write_if_changed(OUTPUT, render(pool, offset_bytes, tables, sources)):
+        record_bytes = sum(len(t) * ((b + 7) // 8 + offset_bytes) for b, t in tables.items())
+        print("gen_oui_table: %d MA-L, %d MA-M, %d MA-S prefixes, %d vendors, %d bytes -> %s" % (
+            len(tables[24]), len(tables[28]), len(tables[36]),
+            len(set(entries.values())), record_bytes + len(pool),
+            os.path.relpath(OUTPUT, PROJECT_DIR)))
+
+
+generate()
@@ -0,0 +1,172 @@
+"""Generate src/generated/service_probes_table.h from tables/service_probes.txt.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand: python scripts/gen_service_probes.py
+
+Pattern syntax and bytecode are described in service_probe_defs.py.
+"""
+
+import os
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+sys.path.insert(0, os.path.join(PROJECT_DIR, "scripts"))
+from service_probe_defs import (  # noqa: E402
+    DefinitionError, MATCH_ANCHORED, MATCH_NOCASE, PAT_ANY, PAT_CAPTURE, PAT_END, PAT_LIT, PAT_ONE,
+    PROBE_HTTP, PROBE_TLS, parse, service_signatures)
+
+SOURCE = os.path.join(PROJECT_DIR, "tables", "service_probes.txt")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "generated", "service_probes_table.h")
+
+
+class Pool:
+    def __init__(self):
+        self.data = []
+        self.strings = {}
+
+    def add(self, data):
+        offset = len(self.data)
+        self.data.extend(data)
+        return offset
+
+    def add_string(self, text):
+        if text not in self.strings:
+            self.strings[text] = self.add([ord(c) for c in text] + [0])
+        return self.strings[text]
+
+
+def render(probes, port_names):
+    pool = Pool()
+    ports = []
+    probe_rows = []
+    match_rows = []
+    _, match_signatures = service_signatures(probes)
+
+    for probe in probes:
+        payload = pool.add(probe["payload"])
+        first_port = len(ports)
+        ports.extend(probe["ports"])
+        first_match = len(match_rows)
+        for service, flags, code in probe["matches"]:
+            signature = match_signatures[len(match_rows)]
+            match_rows.append("    {%d, %d, 0x%02x, %s}," % (
+                pool.add_string(service), pool.add(code), flags,
+                "SIG_NONE" if signature is None else "SIG_SERVICE_%d" % signature))
+        probe_rows.append("    {%d, %d, 0x%02x, %d, %d, %d, %d}, // %s" % (
+            payload, len(probe["payload"]), probe["flags"], first_port, len(probe["ports"]),
+            first_match, len(probe["matches"]), probe["name"]))
+
+    name_rows = ["    {%d, %d}," % (port, pool.add_string(name)) for port, name in port_names]
+
+    if len(pool.data) > 0xFFFF:
+        raise DefinitionError("string pool exceeds 64 KiB")
+
+    pool_rows = []
+    for i in range(0, len(pool.data), 16):
+        pool_rows.append("    " + ", ".join("0x%02x" % b for b in pool.data[i:i + 16]) + ",")
+    port_rows = []
+    for i in range(0, len(ports), 12):
+        port_rows.append("    " + ", ".join("%d" % p for p in ports[i:i + 12]) + ",")
+
+    return "\n".join([
+        "// Generated by scripts/gen_service_probes.py from tables/service_probes.txt - do not edit",
+        "#ifndef SERVICE_PROBES_TABLE_H",
+        "#define SERVICE_PROBES_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "#include <stddef.h>",
+        "#include \"banner_signature_ids.h\"",
+        "",
+        "enum ServicePatternOp : uint8_t",
+        "{",
+        "    PAT_END = %d," % PAT_END,
+        "    PAT_LIT = %d,   // followed by length and bytes" % PAT_LIT,
+        "    PAT_ANY = %d," % PAT_ANY,
+        "    PAT_ONE = %d," % PAT_ONE,
+        "    PAT_CAPTURE = %d" % PAT_CAPTURE,
+        "};",
+        "",
+        "static constexpr uint8_t PROBE_HTTP = 0x%02x;" % PROBE_HTTP,
+        "static constexpr uint8_t PROBE_TLS = 0x%02x;" % PROBE_TLS,
+        "static constexpr uint8_t MATCH_ANCHORED = 0x%02x;" % MATCH_ANCHORED,
+        "static constexpr uint8_t MATCH_NOCASE = 0x%02x;" % MATCH_NOCASE,
+        "",
+        "struct ServiceProbeDef",
+        "{",
+        "    uint16_t payload;     // Pool offset",
+        "    uint8_t payloadLen;",
+        "    uint8_t flags;",
+        "    uint16_t firstPort;   // Index into SERVICE_PROBE_PORTS",
+        "    uint8_t portCount;",
+        "    uint16_t firstMatch;  // Index into SERVICE_MATCHES",
+        "    uint8_t matchCount;",
+        "};",
+        "",
+        "struct ServiceMatchDef",
+        "{",
+        "    uint16_t service;     // Pool offset, NUL-terminated",
+        "    uint16_t pattern;     // Pool offset of the bytecode",
+        "    uint8_t flags;",
+        "    uint8_t signature;    // Banner signature that must hit before the pattern runs",
+        "};",
+        "",
+        "struct ServicePortName",
+        "{",
+        "    uint16_t port;",
+        "    uint16_t service;     // Pool offset, NUL-terminated",
+        "};",
+        "",
+        "// Payloads, pattern bytecode and service names",
+        "static constexpr uint8_t SERVICE_PROBE_POOL[] = {",
+    ] + pool_rows + [
+        "};",
+        "",
+        "static constexpr uint16_t SERVICE_PROBE_PORTS[] = {",
+    ] + (port_rows or ["    0,"]) + [
+        "};",
+        "",
+        "// Entry 0 is the NULL probe (no payload), used for ports no other probe lists",
+        "static constexpr ServiceProbeDef SERVICE_PROBES[] = {",
+    ] + probe_rows + [
+        "};",
+        "",
+        "static constexpr ServiceMatchDef SERVICE_MATCHES[] = {",
+    ] + match_rows + [
+        "};",
+        "",
+        "// Sorted by port",
+        "static constexpr ServicePortName SERVICE_PORT_NAMES[] = {",
+    ] + name_rows + [
+        "};",
+        "",
+        "static constexpr size_t SERVICE_PROBE_COUNT = %d;" % len(probes),
+        "static constexpr size_t SERVICE_MATCH_COUNT = %d;" % len(match_rows),
+        "static constexpr size_t SERVICE_PORT_NAME_COUNT = %d;" % len(name_rows),
+        "",
+        "#endif // SERVICE_PROBES_TABLE_H",
+        "",
+    ])
+
+
+def generate():
+    probes, port_names = parse(SOURCE)
+    text = render(probes, port_names)
+    try:
+        with open(OUTPUT) as f:
+            if f.read() == text:
+                return
+    except IOError:
+        pass
+    os.makedirs(os.path.dirname(OUTPUT), exist_ok=True)
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("gen_service_probes: wrote %d probes, %d matches to %s" % (
+        len(probes), sum(len(p["matches"]) for p in probes), os.path.relpath(OUTPUT, PROJECT_DIR)))
+
+
+generate()
@@ -0,0 +1,84 @@
+"""Generate src/generated/top_ports_table.h from tables/top_ports_tcp.txt.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand: python scripts/gen_top_ports.py
+"""
+
+import os
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+SOURCE = os.path.join(PROJECT_DIR, "tables", "top_ports_tcp.txt")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "generated", "top_ports_table.h")
+RANKED_MARKER = "# --- unranked tail ---"
+
+
+def parse(path):
+    ports = []
+    ranked = None
+    seen = set()
+    with open(path) as f:
+        for lineno, raw in enumerate(f, 1):
+            if raw.strip() == RANKED_MARKER:
+                ranked = len(ports)
+                continue
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+            port = int(line)
+            if not 1 <= port <= 65535:
+                raise ValueError("%s:%d: port %d out of range" % (path, lineno, port))
+            if port in seen:
+                raise ValueError("%s:%d: duplicate port %d" % (path, lineno, port))
+            seen.add(port)
+            ports.append(port)
+    return ports, ranked if ranked is not None else len(ports)
+
+
+def render(ports, ranked):
+    rows = []
+    for i in range(0, len(ports), 12):
+        rows.append("    " + ", ".join("%d" % p for p in ports[i:i + 12]) + ",")
+    return "\n".join([
+        "// Generated by scripts/gen_top_ports.py from tables/top_ports_tcp.txt - do not edit",
+        "#ifndef TOP_PORTS_TABLE_H",
+        "#define TOP_PORTS_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "#include <stddef.h>",
+        "",
+        "// TCP ports, most frequently open first",
+        "static constexpr uint16_t TOP_PORTS_TCP[] = {",
+    ] + rows + [
+        "};",
+        "",
+        "static constexpr size_t TOP_PORTS_TCP_COUNT = %d;" % len(ports),
+        "static constexpr size_t TOP_PORTS_TCP_RANKED = %d; // entries past this share one rank" % ranked,
+        "static_assert(sizeof(TOP_PORTS_TCP) / sizeof(TOP_PORTS_TCP[0]) == TOP_PORTS_TCP_COUNT, \"table size\");",
+        "",
+        "#endif // TOP_PORTS_TABLE_H",
+        "",
+    ])
+
+
+def generate():
+    ports, ranked = parse(SOURCE)
+    text = render(ports, ranked)
+    try:
+        with open(OUTPUT) as f:
+            if f.read() == text:
+                return
+    except IOError:
+        pass
+    os.makedirs(os.path.dirname(OUTPUT), exist_ok=True)
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("gen_top_ports: wrote %d ports to %s" % (len(ports), os.path.relpath(OUTPUT, PROJECT_DIR)))
+
+
+generate()
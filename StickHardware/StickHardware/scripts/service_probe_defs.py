@@ -0,0 +1,204 @@
+"""Parser for tables/service_probes.txt, shared by the generator scripts.
+
+Match patterns are compiled to a small bytecode executed by the matcher in
+port_scanner.cpp:
+    PAT_END              end of pattern
+    PAT_LIT <n> <bytes>  n literal bytes
+    PAT_ANY              any run of bytes (lazy)
+    PAT_ONE              exactly one byte
+    PAT_CAPTURE          version capture: like PAT_ANY but stays on one line
+"""
+
+import os
+import re
+
+PAT_END, PAT_LIT, PAT_ANY, PAT_ONE, PAT_CAPTURE = range(5)
+PROBE_HTTP = 0x01
+PROBE_TLS = 0x02
+PROBE_FLAGS = {"": 0, "http": PROBE_HTTP, "tls": PROBE_TLS}
+MATCH_ANCHORED = 0x01
+MATCH_NOCASE = 0x02
+
+SIMPLE_ESCAPES = {"r": 13, "n": 10, "t": 9, "0": 0, "\\": 92, '"': 34}
+LINE_RE = re.compile(r'^(\w+)\s+(\S+)\s+"((?:[^"\\]|\\.)*)"\s*(\w*)$')
+
+
+class DefinitionError(ValueError):
+    pass
+
+
+def unescape(text, where, pattern=False):
+    """Returns a list of (byte, is_literal) pairs."""
+    out = []
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == "\\":
+            if i + 1 >= len(text):
+                raise DefinitionError("%s: dangling backslash" % where)
+            e = text[i + 1]
+            if e in SIMPLE_ESCAPES:
+                out.append((SIMPLE_ESCAPES[e], True))
+                i += 2
+            elif e == "x":
+                try:
+                    out.append((int(text[i + 2:i + 4], 16), True))
+                except ValueError:
+                    raise DefinitionError("%s: bad \\x escape" % where)
+                i += 4
+            elif pattern and e in "*?^{":
+                out.append((ord(e), True))
+                i += 2
+            else:
+                raise DefinitionError("%s: unknown escape \\%s" % (where, e))
+            continue
+        out.append((ord(c), False))
+        i += 1
+    return out
+
+
+def compile_pattern(text, where):
+    chars = unescape(text, where, pattern=True)
+    flags = 0
+    if chars and chars[0] == (ord("^"), False):
+        flags |= MATCH_ANCHORED
+        chars = chars[1:]
+
+    code = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:255]
+            del literal[:255]
+            code.extend([PAT_LIT, len(chunk)] + chunk)
+
+    i = 0
+    captures = 0
+    while i < len(chars):
+        b, is_literal = chars[i]
+        if not is_literal and b == ord("*"):
+            flush()
+            code.append(PAT_ANY)
+        elif not is_literal and b == ord("?"):
+            flush()
+            code.append(PAT_ONE)
+        elif not is_literal and text_at(chars, i, "{v}"):
+            flush()
+            code.append(PAT_CAPTURE)
+            captures += 1
+            i += 2
+        else:
+            literal.append(b)
+        i += 1
+    flush()
+    code.append(PAT_END)
+
+    if captures > 1:
+        raise DefinitionError("%s: at most one {v} per pattern" % where)
+    return flags, code
+
+
+def text_at(chars, i, token):
+    if i + len(token) > len(chars):
+        return False
+    return all(chars[i + k] == (ord(token[k]), False) for k in range(len(token)))
+
+
+def parse(path):
+    probes = []
+    port_names = []
+    seen_ports = {}
+    with open(path) as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.strip()
+            if not line or line.startswith("#"):
+                continue
+            where = "%s:%d" % (os.path.basename(path), lineno)
+            keyword = line.split(None, 1)[0]
+
+            if keyword in ("probe", "match"):
+                m = LINE_RE.match(line)
+                if not m:
+                    raise DefinitionError("%s: expected %s <name> \"...\" [flag]" % (where, keyword))
+                _, name, body, flag = m.groups()
+                if keyword == "probe":
+                    if flag not in PROBE_FLAGS:
+                        raise DefinitionError("%s: unknown probe flag '%s'" % (where, flag))
+                    payload = [b for b, _ in unescape(body, where)]
+                    if len(payload) > 255:
+                        raise DefinitionError("%s: payload longer than 255 bytes" % where)
+                    probes.append({"name": name, "payload": payload,
+                                   "flags": PROBE_FLAGS[flag],
+                                   "ports": [], "matches": []})
+                else:
+                    if not probes:
+                        raise DefinitionError("%s: match before any probe" % where)
+                    if flag not in ("", "i"):
+                        raise DefinitionError("%s: unknown match flag '%s'" % (where, flag))
+                    flags, code = compile_pattern(body, where)
+                    if flag == "i":
+                        flags |= MATCH_NOCASE
+                    probes[-1]["matches"].append((name, flags, code))
+
+            elif keyword == "ports":
+                if not probes:
+                    raise DefinitionError("%s: ports before any probe" % where)
+                for item in line.split(None, 1)[1].split(","):
+                    port = int(item)
+                    if not 1 <= port <= 65535:
+                        raise DefinitionError("%s: port %d out of range" % (where, port))
+                    if port in seen_ports:
+                        raise DefinitionError("%s: port %d already probed by %s" % (where, port, seen_ports[port]))
+                    seen_ports[port] = probes[-1]["name"]
+                    probes[-1]["ports"].append(port)
+
+            elif keyword == "port":
+                parts = line.split(None, 2)
+                if len(parts) != 3:
+                    raise DefinitionError("%s: expected port <p> <service>" % where)
+                port_names.append((int(parts[1]), parts[2]))
+
+            else:
+                raise DefinitionError("%s: unknown keyword '%s'" % (where, keyword))
+
+    if not probes or probes[0]["name"] != "NULL" or probes[0]["payload"]:
+        raise DefinitionError("%s: the first probe must be NULL with an empty payload" % path)
+    return probes, sorted(port_names)
+
+
+def required_literal(code):
+    """Longest literal run in compiled pattern code; any match contains it."""
+    best = []
+    i = 0
+    while code[i] != PAT_END:
+        if code[i] == PAT_LIT:
+            n = code[i + 1]
+            if n > len(best):
+                best = code[i + 2:i + 2 + n]
+            i += 2 + n
+        else:
+            i += 1
+    return bytes(best)
+
+
+def service_signatures(probes):
+    """Banner signatures used to prefilter service matches.
+
+    Returns (literals, per_match) where literals is the ordered list of unique
+    case-folded literals and per_match gives each match's index into it (or
+    None), in SERVICE_MATCHES order. IDs are assigned here so both generated
+    headers agree.
+    """
+    literals = []
+    per_match = []
+    for probe in probes:
+        for _, _, code in probe["matches"]:
+            literal = required_literal(code).lower()
+            if not literal:
+                per_match.append(None)
+                continue
+            if literal not in literals:
+                literals.append(literal)
+            per_match.append(literals.index(literal))
+    return literals, per_match
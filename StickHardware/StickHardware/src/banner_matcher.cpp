@@ -0,0 +1,27 @@
+#include "banner_matcher.h"
+#include "generated/banner_automaton.h"
+
+// ============================================================================
+// Banner Matcher - Implementation
+// ============================================================================
+
+SignatureSet scanBannerSignatures(const char *text, size_t length)
+{
+    SignatureSet hits;
+    if (!text)
+    {
+        return hits;
+    }
+
+    BannerAcState state = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        state = BANNER_AC_DELTA[state * BANNER_AC_CLASSES + BANNER_AC_CLASS[(uint8_t)text[i]]];
+        const uint64_t *found = BANNER_AC_OUTPUT + state * BANNER_SIGNATURE_WORDS;
+        for (int w = 0; w < BANNER_SIGNATURE_WORDS; w++)
+        {
+            hits.bits[w] |= found[w];
+        }
+    }
+    return hits;
+}
@@ -0,0 +1,38 @@
+#ifndef BANNER_MATCHER_H
+#define BANNER_MATCHER_H
+
+#include <Arduino.h>
+#include "generated/banner_signature_ids.h"
+
+// ============================================================================
+// Banner Matcher - One pass over a banner finds every signature it contains
+// ============================================================================
+// Signatures come from tables/banner_signatures.txt and the service probe
+// table; scripts/gen_banner_signatures.py compiles them into a flash DFA.
+// Matching ignores ASCII case.
+// ============================================================================
+
+struct SignatureSet
+{
+    uint64_t bits[BANNER_SIGNATURE_WORDS] = {};
+
+    bool has(uint8_t id) const
+    {
+        return id < BANNER_SIGNATURE_COUNT && (bits[id / 64] >> (id % 64)) & 1;
+    }
+    bool any() const
+    {
+        for (int w = 0; w < BANNER_SIGNATURE_WORDS; w++)
+        {
+            if (bits[w] != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+SignatureSet scanBannerSignatures(const char *text, size_t length);
+
+#endif // BANNER_MATCHER_H
@@ -0,0 +1,613 @@
+// ============================================================================
+// NetStick Scan Benchmark - Entry point for env:bench
+// ============================================================================
+// Runs scanNetwork() (ARP on a /24 and a /22, cold and after a minute of
+// passive listening; ICMP echo and both on the /24; network_delta rescans
+// of the /22, unchanged and with a passively heard host unplugged) and
+// scanPorts() (seeded with the echo RTTs; "seq" rows keep one connect in
+// flight, the baseline the connect engine is measured against; "1% loss"
+// rows compare connect and SYN discovery at that loss) against the
+// deterministic virtual LAN in lib/native_sim and reports, per seed and
+// scenario:
+//
+//   sim ms     Scan duration in simulated time (what the device would take)
+//   wall ms    Host CPU time spent in the scanner core plus the simulator
+//   probes/s   Probes per simulated second
+//   accuracy   Ports whose reported state matches the model
+//   open       Open ports found / open ports in the model
+//   calls      Socket calls made
+//
+// The same seed always yields the same numbers, so runs before and after a
+// change are directly comparable. A last section reports the flash size of
+// the OUI vendor database and the host-CPU cost of lookupVendor(), and
+// times service matching plus the vulnerability checks per banner with the
+// signature automaton against the full pattern runs and strstr chain it
+// replaced, and printableText() against a plain byte loop.
+//
+//   pio run -e bench && .pio/build/bench/program [seeds] [hosts] [loss]
+// ============================================================================
+
+#include <Arduino.h>
+#include <array>
+#include <chrono>
+#include <vector>
+#include "native_hal.h"
+#include "sim_network.h"
+#include "config.h"
+#include "banner_matcher.h"
+#include "device_inventory.h"
+#include "network_scanner.h"
+#include "passive_listener.h"
+#include "port_scanner.h"
+#include "probe_session.h"
+#include "generated/top_ports_table.h"
+#include "generated/oui_table.h"
+
+// pio test links the test's own main() and none of this driver
+#ifndef PIO_UNIT_TESTING
+
+static sim::SimNetwork simNet;
+
+struct BenchResult
+{
+    uint64_t simUs;
+    double wallMs;
+    int probes;
+    int matched;       // Probed ports whose state matches the model
+    int openFound;     // Model-open ports reported open
+    int openTruth;     // Model-open ports in the probed set
+    int falseOpen;     // Reported open, not open in the model
+    uint32_t calls;
+};
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static PortState expectedState(const sim::SimHost &host, uint16_t port)
+{
+    switch (host.tcpState(port))
+    {
+    case sim::PortKind::OPEN:
+        return PortState::OPEN;
+    case sim::PortKind::CLOSED:
+        return PortState::CLOSED;
+    default:
+        return PortState::FILTERED;
+    }
+}
+
+static void beginRun(BenchResult &result, std::chrono::steady_clock::time_point &wallStart)
+{
+    memset(&result, 0, sizeof(result));
+    simNet.resetStats();
+    result.simUs = simNet.clock().now();
+    wallStart = std::chrono::steady_clock::now();
+}
+
+static void endRun(BenchResult &result, std::chrono::steady_clock::time_point wallStart)
+{
+    result.wallMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - wallStart)
+                        .count();
+    result.simUs = simNet.clock().now() - result.simUs;
+    result.calls = simNet.getStats().socketCalls;
+}
+
+static void scorePort(BenchResult &result, const sim::SimHost &host, uint16_t port)
+{
+    PortState expected = expectedState(host, port);
+    PortState reported = portScanner.getPortState(port);
+
+    result.probes++;
+    if (reported == expected)
+        result.matched++;
+    if (expected == PortState::OPEN)
+    {
+        result.openTruth++;
+        if (reported == PortState::OPEN)
+            result.openFound++;
+    }
+    else if (reported == PortState::OPEN)
+    {
+        result.falseOpen++;
+    }
+}
+
+static void printResult(uint32_t seed, const char *scenario, const BenchResult &result)
+{
+    double simMs = result.simUs / 1000.0;
+    double rate = result.simUs ? result.probes * 1e6 / (double)result.simUs : 0.0;
+    double accuracy = result.probes ? 100.0 * result.matched / result.probes : 0.0;
+
+    printf("%4u  %-22s %10.1f %9.2f %10.1f %8.2f%% %5d/%-5d %4d %8u\n",
+           seed, scenario, simMs, result.wallMs, rate, accuracy,
+           result.openFound, result.openTruth, result.falseOpen, result.calls);
+}
+
+// First host other than the gateway whose unlisted ports behave as given
+static const sim::SimHost *pickTarget(sim::PortKind defaultTcp)
+{
+    for (const sim::SimHost &host : simNet.getHosts())
+    {
+        if (IPAddress(host.ip)[3] != 1 && host.defaultTcp == defaultTcp)
+            return &host;
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Scenarios
+// ============================================================================
+
+// Idle time before a scan, as main.cpp's loop spends it
+static void listenPassively(uint32_t ms)
+{
+    passiveListener.begin();
+    uint32_t start = millis();
+    while (millis() - start < ms)
+    {
+        passiveListener.poll();
+        delay(10);
+    }
+    passiveListener.stop();
+}
+
+static void benchHosts(uint32_t seed, const char *scenario,
+                       DiscoveryMethod method = DiscoveryMethod::ARP)
+{
+    BenchResult result;
+    std::chrono::steady_clock::time_point wallStart;
+
+    networkScanner.init();
+    networkScanner.setMethod(method);
+    beginRun(result, wallStart);
+    networkScanner.scanNetwork();
+    endRun(result, wallStart);
+
+    result.probes = networkScanner.getSweepSize();
+    result.matched = result.probes;
+    result.openTruth = (int)simNet.getHosts().size();
+
+    for (int i = 0; i < networkScanner.getDeviceCount(); i++)
+    {
+        NetworkDevice device = networkScanner.getDevice(i);
+        const sim::SimHost *host = simNet.findHost((uint32_t)device.ip);
+        if (host && memcmp(host->mac, device.mac, 6) == 0)
+            result.openFound++;
+        else
+            result.falseOpen++;
+    }
+    // A miss is a wrong answer for that address, as is a phantom
+    result.matched -= (result.openTruth - result.openFound) + result.falseOpen;
+
+    printResult(seed, scenario, result);
+}
+
+// Rescan against the inventory the last host scan left (RAM only: the
+// filesystem is not mounted here). leftIp, if set, is a host unplugged
+// since then: its LEFT is the only event expected, any other is wrong.
+static void benchDelta(uint32_t seed, const char *scenario, uint32_t leftIp = 0)
+{
+    BenchResult result;
+    std::chrono::steady_clock::time_point wallStart;
+
+    HostRange range = networkScanner.getLocalRange();
+    deviceInventory.select("bench", range);
+    deviceInventory.apply(networkScanner, range);
+    if (leftIp)
+        simNet.removeHost(leftIp);
+
+    int knownCount = 0;
+    const uint32_t *known = deviceInventory.knownAddresses(range, knownCount);
+    networkScanner.init();
+    networkScanner.setKnownHosts(known, knownCount);
+    beginRun(result, wallStart);
+    networkScanner.scanRange(range);
+    endRun(result, wallStart);
+    InventorySummary summary = deviceInventory.apply(networkScanner, range);
+
+    result.probes = networkScanner.getSweepSize();
+    result.matched = result.probes;
+    result.openTruth = (int)simNet.getHosts().size();
+    result.openFound = summary.seen;
+    int expectedLeft = leftIp ? 1 : 0;
+    result.falseOpen = summary.joined + abs(summary.left - expectedLeft) + summary.changedIp;
+    result.matched -= (result.openTruth - result.openFound) + result.falseOpen;
+
+    printResult(seed, scenario, result);
+}
+
+static void benchPorts(uint32_t seed, const char *scenario, const sim::SimHost *host,
+                       ScanMode mode, uint16_t startPort, uint16_t endPort,
+                       bool serviceVersion, int parallelism = 0)
+{
+    if (!host)
+    {
+        printf("%4u  %-22s (no such host in this network)\n", seed, scenario);
+        return;
+    }
+
+    BenchResult result;
+    std::chrono::steady_clock::time_point wallStart;
+    String target = IPAddress(host->ip).toString();
+
+    portScanner.init();
+    portScanner.setScanMode(mode);
+    portScanner.setParallelism(parallelism);
+    beginRun(result, wallStart);
+    portScanner.scanPorts(target.c_str(), startPort, endPort, nullptr, nullptr,
+                          false, serviceVersion);
+    endRun(result, wallStart);
+
+    for (uint32_t port = startPort; port <= endPort; port++)
+        scorePort(result, *host, (uint16_t)port);
+    printResult(seed, scenario, result);
+}
+
+static void benchTop(uint32_t seed, const char *scenario, const sim::SimHost *host, int count)
+{
+    if (!host)
+    {
+        printf("%4u  %-22s (no such host in this network)\n", seed, scenario);
+        return;
+    }
+
+    BenchResult result;
+    std::chrono::steady_clock::time_point wallStart;
+    String target = IPAddress(host->ip).toString();
+
+    count = clampTopPortCount(count);
+    portScanner.init();
+    portScanner.setScanMode(ScanMode::CONNECT);
+    beginRun(result, wallStart);
+    portScanner.scanTopPorts(target.c_str(), count);
+    endRun(result, wallStart);
+
+    for (int i = 0; i < count; i++)
+        scorePort(result, *host, TOP_PORTS_TCP[i]);
+    printResult(seed, scenario, result);
+}
+
+static void runSeed(uint32_t seed, int hostCount, float loss)
+{
+    sim::SimConfig config;
+    config.seed = seed;
+    config.hostCount = hostCount;
+    config.loss = loss;
+    simNet.generate(config);
+    hal::seedRandom(seed);
+
+    const sim::SimHost *openHost = pickTarget(sim::PortKind::CLOSED);
+    const sim::SimHost *firewalledHost = pickTarget(sim::PortKind::FILTERED);
+
+    benchHosts(seed, "hosts /24 (arp)");
+    listenPassively(60000);
+    benchHosts(seed, "hosts /24 after listen");
+    passiveListener.clear();
+    benchHosts(seed, "hosts /24 (icmp)", DiscoveryMethod::ICMP);
+    benchHosts(seed, "hosts /24 (both)", DiscoveryMethod::BOTH);
+    benchPorts(seed, "connect 1-1024", openHost, ScanMode::CONNECT, 1, 1024, false);
+    benchPorts(seed, "connect 1-1024 seq", openHost, ScanMode::CONNECT, 1, 1024, false, 1);
+    benchPorts(seed, "connect 1-1024 fw", firewalledHost, ScanMode::CONNECT, 1, 1024, false);
+    benchPorts(seed, "connect 1-1024 fw seq", firewalledHost, ScanMode::CONNECT, 1, 1024, false, 1);
+    benchPorts(seed, "syn 1-1024", openHost, ScanMode::SYN, 1, 1024, false);
+    benchPorts(seed, "syn 1-1024 fw", firewalledHost, ScanMode::SYN, 1, 1024, false);
+    benchTop(seed, "top 100", openHost, 100);
+    benchPorts(seed, "connect -sV 1-1024", openHost, ScanMode::CONNECT, 1, 1024, true);
+
+    // Both discovery modes on ordinary WiFi loss, whatever loss this run uses:
+    // a stray dropped probe must not make half-open scans the slower kind
+    config.loss = 0.01f;
+    simNet.generate(config);
+    openHost = pickTarget(sim::PortKind::CLOSED);
+    benchPorts(seed, "connect 1-1024 1% loss", openHost, ScanMode::CONNECT, 1, 1024, false);
+    benchPorts(seed, "syn 1-1024 1% loss", openHost, ScanMode::SYN, 1, 1024, false);
+    config.loss = loss;
+
+    // Same density on a /22
+    config.prefixLength = 22;
+    config.hostCount = hostCount * 4;
+    simNet.generate(config);
+    benchHosts(seed, "hosts /22 (arp)");
+    benchDelta(seed, "delta /22");
+
+    // A device heard while idle, then unplugged: still in the passive
+    // table, but the delta must report it gone
+    listenPassively(60000);
+    uint32_t leaving = 0;
+    for (int i = 0; i < passiveListener.getHostCount() && !leaving; i++)
+    {
+        const PassiveHost *heard = passiveListener.getHost(i);
+        if (heard->hasMac)
+            leaving = (uint32_t)fromHostOrder(heard->ip);
+    }
+    if (leaving)
+        benchDelta(seed, "delta /22 one left", leaving);
+    else
+        printf("%4u  %-22s (nothing heard passively)\n", seed, "delta /22 one left");
+    passiveListener.clear();
+}
+
+// ============================================================================
+// OUI lookup
+// ============================================================================
+
+static double timeLookups(const std::vector<std::array<uint8_t, 6>> &macs, int rounds)
+{
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (const std::array<uint8_t, 6> &mac : macs)
+            sink += (size_t)lookupVendor(mac.data())[0];
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 1)
+        printf(" "); // Keeps the loop from being optimized away
+    return ns / ((double)rounds * macs.size());
+}
+
+static void benchOui()
+{
+    const size_t footprint = OUI_VENDOR_POOL_SIZE +
+                             OUI_MAL_COUNT * (3 + OUI_OFFSET_BYTES) +
+                             OUI_MAM_COUNT * (4 + OUI_OFFSET_BYTES) +
+                             OUI_MAS_COUNT * (5 + OUI_OFFSET_BYTES);
+
+    // Registered prefixes with random device bits, and random universally
+    // administered addresses (almost all unregistered)
+    std::vector<std::array<uint8_t, 6>> registered(4096);
+    std::vector<std::array<uint8_t, 6>> unregistered(4096);
+    uint32_t state = 1;
+    for (size_t i = 0; i < registered.size(); i++)
+    {
+        const uint8_t *record = OUI_MAL_RECORDS + (i % OUI_MAL_COUNT) * (3 + OUI_OFFSET_BYTES);
+        for (int b = 0; b < 6; b++)
+        {
+            state = state * 1664525u + 1013904223u;
+            registered[i][b] = b < 3 ? record[b] : (uint8_t)(state >> 24);
+            state = state * 1664525u + 1013904223u;
+            unregistered[i][b] = (uint8_t)(state >> 24);
+        }
+        unregistered[i][0] &= 0xFC;
+    }
+
+    printf("# oui: %zu MA-L, %zu MA-M, %zu MA-S prefixes, %zu vendors, %zu bytes of flash\n",
+           OUI_MAL_COUNT, OUI_MAM_COUNT, OUI_MAS_COUNT, OUI_VENDOR_COUNT, footprint);
+    printf("# oui lookup: %.1f ns registered, %.1f ns unregistered (host CPU)\n",
+           timeLookups(registered, 250), timeLookups(unregistered, 250));
+}
+
+// ============================================================================
+// Banner signatures
+// ============================================================================
+
+// Typical first responses and the ports they came from, as
+// matchServiceResponse(), analyzeService() and bannerText() see them
+struct SampleBanner
+{
+    uint16_t port;
+    const char *text;
+};
+
+static const SampleBanner SAMPLE_BANNERS[] = {
+    {22, "SSH-2.0-OpenSSH_8.9p1 Ubuntu-3ubuntu0.6\r\n"},
+    {21, "220 (vsFTPd 3.0.5)\r\n"},
+    {25, "220 mail.example.lan ESMTP Postfix (Ubuntu)\r\n"},
+    {110, "+OK Dovecot (Ubuntu) ready.\r\n"},
+    {80, "HTTP/1.1 200 OK\r\nServer: nginx/1.18.0 (Ubuntu)\r\nDate: Fri, 16 Oct 2026 12:00:00 GMT\r\n"
+         "Content-Type: text/html\r\nContent-Length: 612\r\nLast-Modified: Tue, 21 Apr 2026 14:09:01 GMT\r\n"
+         "Connection: close\r\nETag: \"5e9efe7d-264\"\r\nAccept-Ranges: bytes\r\n\r\n"},
+    {8080, "HTTP/1.0 401 Unauthorized\r\nServer: Apache/2.4.49 (Unix)\r\n"
+           "WWW-Authenticate: Basic realm=\"router\"\r\nContent-Length: 0\r\n\r\n"},
+};
+static const size_t SAMPLE_BANNER_COUNT = sizeof(SAMPLE_BANNERS) / sizeof(SAMPLE_BANNERS[0]);
+
+// Nanoseconds per sample banner for fn(text, length, port), which returns
+// something to sum so the calls are not optimized away
+template <typename Fn>
+static double timePerBanner(Fn fn, int rounds)
+{
+    size_t lengths[SAMPLE_BANNER_COUNT];
+    for (size_t i = 0; i < SAMPLE_BANNER_COUNT; i++)
+        lengths[i] = strlen(SAMPLE_BANNERS[i].text);
+
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < SAMPLE_BANNER_COUNT; i++)
+            sink += fn(SAMPLE_BANNERS[i].text, lengths[i], SAMPLE_BANNERS[i].port);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 1)
+        printf(" ");
+    return ns / ((double)rounds * SAMPLE_BANNER_COUNT);
+}
+
+// analyzeService()'s checks before the automaton: one case-sensitive
+// strstr per vulnerable version string
+static size_t vulnStrstrs(const char *banner)
+{
+    static const char *const LITERALS[] = {
+        "SSH-1.", "Apache/2.4.49", "Apache/2.4.50", "nginx/1.14", "nginx/1.15",
+        "vsftpd 2.3.4", "OpenSSH_5.", "OpenSSH_6.", "OpenSSH_7.2"};
+    size_t found = 0;
+    for (const char *literal : LITERALS)
+        found += strstr(banner, literal) != nullptr;
+    return found;
+}
+
+static SignatureSet everySignature()
+{
+    SignatureSet all;
+    for (uint64_t &word : all.bits)
+        word = ~0ull;
+    return all;
+}
+
+// Per banner before the automaton: every service pattern of the sent probe
+// (and the greeting probe) runs, then the vulnerability strstrs
+static size_t strstrPath(const char *banner, size_t length, uint16_t port)
+{
+    static const SignatureSet all = everySignature();
+    char version[64];
+    const char *service = matchServiceResponse(banner, length, port, all, version, sizeof(version));
+    return (size_t)service[0] + version[0] + vulnStrstrs(banner);
+}
+
+// Per banner now: one automaton pass picks the patterns worth running, and
+// analyzeService() makes its own pass for the vulnerability signatures
+static size_t automatonPath(const char *banner, size_t length, uint16_t port)
+{
+    char version[64];
+    const char *service = matchServiceResponse(banner, length, port, version, sizeof(version));
+    return (size_t)service[0] + version[0] + scanBannerSignatures(banner, length).any();
+}
+
+static size_t automatonOnly(const char *banner, size_t length, uint16_t)
+{
+    return scanBannerSignatures(banner, length).any();
+}
+
+// The prefilter may only skip patterns that cannot match
+static bool samePrefilteredMatches()
+{
+    static const SignatureSet all = everySignature();
+    for (const SampleBanner &sample : SAMPLE_BANNERS)
+    {
+        size_t length = strlen(sample.text);
+        char fast[64];
+        char slow[64];
+        const char *a = matchServiceResponse(sample.text, length, sample.port, fast, sizeof(fast));
+        const char *b = matchServiceResponse(sample.text, length, sample.port, all, slow, sizeof(slow));
+        if (strcmp(a, b) != 0 || strcmp(fast, slow) != 0)
+            return false;
+    }
+    return true;
+}
+
+static void benchSignatures()
+{
+    if (!samePrefilteredMatches())
+    {
+        printf("# banner signatures: MISMATCH between prefiltered and full pattern matching\n");
+        return;
+    }
+    printf("# banner signatures: %.1f ns automaton path, %.1f ns strstr path per banner "
+           "(service patterns + vuln checks; automaton pass alone %.1f ns, %d signatures; host CPU)\n",
+           timePerBanner(automatonPath, 20000), timePerBanner(strstrPath, 20000),
+           timePerBanner(automatonOnly, 20000), (int)BANNER_SIGNATURE_COUNT);
+}
+
+// ============================================================================
+// Banner text
+// ============================================================================
+
+// printableText() without the word-at-a-time fast path
+static size_t byteLoopText(const char *data, size_t length, char *out, size_t outSize)
+{
+    if (outSize == 0)
+        return 0;
+    size_t n = 0;
+    for (size_t i = 0; i < length && n < outSize - 1; i++)
+    {
+        char c = data[i];
+        if (c >= 32 && c < 127)
+            out[n++] = c;
+        else if (c == '\n' || c == '\r')
+            out[n++] = ' ';
+    }
+    while (n > 0 && out[n - 1] == ' ')
+        n--;
+    out[n] = '\0';
+    return n;
+}
+
+static size_t wordText(const char *banner, size_t length, uint16_t)
+{
+    char out[BANNER_MAX_SIZE];
+    return printableText(banner, length, out, sizeof(out));
+}
+
+static size_t byteText(const char *banner, size_t length, uint16_t)
+{
+    char out[BANNER_MAX_SIZE];
+    return byteLoopText(banner, length, out, sizeof(out));
+}
+
+// Both must produce the same text for every sample, for every output size
+// (truncation lands mid-word), and for binary bytes at every alignment
+static bool sameText()
+{
+    char input[64];
+    for (size_t i = 0; i < sizeof(input); i++)
+    {
+        if (i % 5 == 4)
+            input[i] = (char)(0x80 + i);
+        else if (i % 7 == 6)
+            input[i] = i % 2 ? '\r' : '\x01';
+        else
+            input[i] = (char)('a' + i % 26);
+    }
+
+    char fast[BANNER_MAX_SIZE];
+    char slow[BANNER_MAX_SIZE];
+    for (size_t outSize = 1; outSize <= sizeof(fast); outSize++)
+    {
+        for (size_t i = 0; i <= SAMPLE_BANNER_COUNT; i++)
+        {
+            const char *data = i < SAMPLE_BANNER_COUNT ? SAMPLE_BANNERS[i].text : input;
+            size_t length = i < SAMPLE_BANNER_COUNT ? strlen(data) : sizeof(input);
+            for (size_t skip = 0; skip < 4 && skip < length; skip++)
+            {
+                size_t a = printableText(data + skip, length - skip, fast, outSize);
+                size_t b = byteLoopText(data + skip, length - skip, slow, outSize);
+                if (a != b || strcmp(fast, slow) != 0)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void benchBannerText()
+{
+    if (!sameText())
+    {
+        printf("# banner text: MISMATCH between printableText() and the byte loop\n");
+        return;
+    }
+    printf("# banner text: %.1f ns printableText(), %.1f ns byte loop per banner (host CPU)\n",
+           timePerBanner(wordText, 20000), timePerBanner(byteText, 20000));
+}
+
+int main(int argc, char **argv)
+{
+    int seeds = argc > 1 ? atoi(argv[1]) : 3;
+    int hostCount = argc > 2 ? atoi(argv[2]) : 40;
+    float loss = argc > 3 ? (float)atof(argv[3]) : 0.01f;
+    if (seeds < 1 || hostCount < 1 || hostCount > 250 || loss < 0.0f || loss >= 1.0f)
+    {
+        fprintf(stderr, "usage: netstick-bench [seeds] [hosts 1-250] [loss 0-1]\n");
+        return 2;
+    }
+
+    hal::setSerialEnabled(false);
+    simNet.install();
+
+    printf("# %d seeds, %d hosts per /24 of 10.0.0.0, loss %.3f\n", seeds, hostCount, loss);
+    printf("seed  %-22s %10s %9s %10s %9s %11s %4s %8s\n",
+           "scenario", "sim ms", "wall ms", "probes/s", "accuracy", "open", "fp", "calls");
+
+    for (int seed = 1; seed <= seeds; seed++)
+        runSeed((uint32_t)seed, hostCount, loss);
+    benchOui();
+    benchSignatures();
+    benchBannerText();
+
+    simNet.uninstall();
+    return 0;
+}
+#endif // PIO_UNIT_TESTING
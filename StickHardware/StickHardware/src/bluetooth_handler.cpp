@@ -167,6 +167,34 @@ void BluetoothHandler::onDataReceived(const char *data, size_t length)
     }
 }
 
+// "mode":"syn" selects half-open discovery; anything else is a connect scan
+static bool isSynMode(const char *mode)
+{
+    return mode && strcmp(mode, "syn") == 0;
+}
+
+// "method" of network_scan; absent means ARP
+static bool parseDiscoveryMethod(const char *name, DiscoveryMethod &out)
+{
+    if (!name || strcmp(name, "arp") == 0)
+    {
+        out = DiscoveryMethod::ARP;
+    }
+    else if (strcmp(name, "icmp") == 0)
+    {
+        out = DiscoveryMethod::ICMP;
+    }
+    else if (strcmp(name, "both") == 0)
+    {
+        out = DiscoveryMethod::BOTH;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
 void BluetoothHandler::parseCommand(const char *json)
 {
     JsonDocument doc;
@@ -191,6 +219,11 @@ void BluetoothHandler::parseCommand(const char *json)
     memset(&pendingCommand, 0, sizeof(pendingCommand));
     pendingCommand.portStart = DEFAULT_PORT_RANGE_START;
     pendingCommand.portEnd = DEFAULT_PORT_RANGE_END;
+    pendingCommand.netRange = HostRange();
+
+    // Optional probe rate ceiling, accepted by every scanning command
+    uint32_t rate = doc["rate"] | 0;
+    pendingCommand.rate = rate > 0xFFFF ? 0xFFFF : (uint16_t)rate;
 
     // Parse command type
     if (strcmp(cmd, "wifi_scan") == 0)
@@ -202,10 +235,38 @@ void BluetoothHandler::parseCommand(const char *json)
     }
     else if (strcmp(cmd, "network_scan") == 0)
     {
+        const char *target = doc["target"];
+        if (target && target[0] != '\0' && !parseHostRange(target, pendingCommand.netRange))
+        {
+            sendError("Invalid 'target' (CIDR, range or IP, at most a /16)");
+            return;
+        }
+        if (!parseDiscoveryMethod(doc["method"], pendingCommand.netMethod))
+        {
+            sendError("Invalid 'method' (arp, icmp or both)");
+            return;
+        }
+        pendingCommand.resolveNames = doc["names"] | true;
+
         pendingCommand.cmd = BLECommand::NETWORK_SCAN;
         commandPending = true;
         sendAck("network_scan");
-        Serial.println("[BLE] Command: network_scan");
+        Serial.printf("[BLE] Command: network_scan %s\n", target ? target : "subnet");
+    }
+    else if (strcmp(cmd, "network_delta") == 0)
+    {
+        // ARP only: the inventory is keyed by MAC
+        const char *target = doc["target"];
+        if (target && target[0] != '\0' && !parseHostRange(target, pendingCommand.netRange))
+        {
+            sendError("Invalid 'target' (CIDR, range or IP, at most a /16)");
+            return;
+        }
+
+        pendingCommand.cmd = BLECommand::NETWORK_DELTA;
+        commandPending = true;
+        sendAck("network_delta");
+        Serial.printf("[BLE] Command: network_delta %s\n", target ? target : "subnet");
     }
     else if (strcmp(cmd, "port_scan") == 0)
     {
@@ -222,6 +283,7 @@ void BluetoothHandler::parseCommand(const char *json)
         strncpy(pendingCommand.targetIP, target, sizeof(pendingCommand.targetIP) - 1);
         pendingCommand.portStart = (uint16_t)start;
         pendingCommand.portEnd = (uint16_t)end;
+        pendingCommand.synScan = isSynMode(doc["mode"]);
         pendingCommand.cmd = BLECommand::PORT_SCAN;
         commandPending = true;
         sendAck("port_scan");
@@ -267,11 +329,95 @@ void BluetoothHandler::parseCommand(const char *json)
         pendingCommand.serviceVersion = serviceVersion;
         pendingCommand.portStart = (uint16_t)start;
         pendingCommand.portEnd = (uint16_t)end;
+        pendingCommand.synScan = isSynMode(doc["mode"]);
         pendingCommand.cmd = BLECommand::ADVANCED_SCAN;
         commandPending = true;
         sendAck("advanced_scan");
         Serial.printf("[BLE] Command: advanced_scan %s (OS:%d SV:%d) ports %d-%d\n", target, osDetect, serviceVersion, start, end);
     }
+    else if (strcmp(cmd, "sweep") == 0)
+    {
+        const char *ports = doc["ports"];
+        int start = doc["start"] | DEFAULT_PORT_RANGE_START;
+        int end = doc["end"] | DEFAULT_PORT_RANGE_END;
+        bool serviceVersion = doc["serviceVersion"] | false;
+
+        pendingCommand.commonPorts = ports && strcmp(ports, "common") == 0;
+        if (ports && strncmp(ports, "top", 3) == 0)
+        {
+            pendingCommand.topPorts = (uint16_t)clampTopPortCount(atoi(ports + 3));
+        }
+        pendingCommand.portStart = (uint16_t)start;
+        pendingCommand.portEnd = (uint16_t)end;
+        pendingCommand.serviceVersion = serviceVersion;
+        pendingCommand.cmd = BLECommand::SWEEP;
+        commandPending = true;
+        sendAck("sweep");
+        if (pendingCommand.commonPorts)
+        {
+            Serial.println("[BLE] Command: sweep (common ports)");
+        }
+        else if (pendingCommand.topPorts > 0)
+        {
+            Serial.printf("[BLE] Command: sweep (top %d ports)\n", pendingCommand.topPorts);
+        }
+        else
+        {
+            Serial.printf("[BLE] Command: sweep ports %d-%d\n", start, end);
+        }
+    }
+    else if (strcmp(cmd, "top_ports") == 0)
+    {
+        const char *target = doc["target"];
+        int count = doc["count"] | DEFAULT_TOP_PORTS;
+        bool osDetect = doc["osDetect"] | false;
+        bool serviceVersion = doc["serviceVersion"] | true;
+
+        if (!target || strlen(target) == 0)
+        {
+            sendError("Missing 'target' IP");
+            return;
+        }
+
+        strncpy(pendingCommand.targetIP, target, sizeof(pendingCommand.targetIP) - 1);
+        pendingCommand.topPorts = (uint16_t)clampTopPortCount(count);
+        pendingCommand.osDetect = osDetect;
+        pendingCommand.serviceVersion = serviceVersion;
+        pendingCommand.synScan = isSynMode(doc["mode"]);
+        pendingCommand.cmd = BLECommand::TOP_PORTS;
+        commandPending = true;
+        sendAck("top_ports");
+        Serial.printf("[BLE] Command: top_ports %s (top %d)\n", target, pendingCommand.topPorts);
+    }
+    else if (strcmp(cmd, "udp_scan") == 0)
+    {
+        // Without a target every host from the last network_scan is probed
+        const char *target = doc["target"];
+        if (target)
+        {
+            strncpy(pendingCommand.targetIP, target, sizeof(pendingCommand.targetIP) - 1);
+        }
+
+        JsonArray ports = doc["ports"].as<JsonArray>();
+        for (JsonVariant port : ports)
+        {
+            if (pendingCommand.udpPortCount >= UDP_MAX_CUSTOM_PORTS)
+            {
+                break;
+            }
+            int value = port.as<int>();
+            if (value > 0 && value <= 65535)
+            {
+                pendingCommand.udpPorts[pendingCommand.udpPortCount++] = (uint16_t)value;
+            }
+        }
+
+        pendingCommand.cmd = BLECommand::UDP_SCAN;
+        commandPending = true;
+        sendAck("udp_scan");
+        Serial.printf("[BLE] Command: udp_scan %s (%d ports)\n",
+                      target ? target : "all hosts", pendingCommand.udpPortCount);
+    }
     else if (strcmp(cmd, "analyze") == 0)
     {
         const char *target = doc["target"];
@@ -286,6 +432,13 @@ void BluetoothHandler::parseCommand(const char *json)
         sendAck("analyze");
         Serial.printf("[BLE] Command: analyze %s\n", target);
     }
+    else if (strcmp(cmd, "resume") == 0)
+    {
+        pendingCommand.cmd = BLECommand::RESUME;
+        commandPending = true;
+        sendAck("resume");
+        Serial.println("[BLE] Command: resume");
+    }
     else if (strcmp(cmd, "status") == 0)
     {
         pendingCommand.cmd = BLECommand::STATUS;
@@ -469,17 +622,41 @@ void BluetoothHandler::sendWifiResults(const WiFiNetworkBLE *networks, int count
     sendNotification(output.c_str());
 }
 
-void BluetoothHandler::sendDevice(const char *ip, const char *mac, const char *vendor)
+void BluetoothHandler::sendDevice(const char *ip, const char *mac, const char *vendor, const char *name,
+                                  int rttMs)
 {
     char escapedVendor[64] = {0};
     escapeJsonString(vendor ? vendor : "Unknown", escapedVendor, sizeof(escapedVendor));
     
-    char buf[192];
-    snprintf(buf, sizeof(buf),
-             "{\"type\":\"device\",\"ip\":\"%s\",\"mac\":\"%s\",\"vendor\":\"%s\"}",
-             ip ? ip : "",
-             mac ? mac : "",
-             escapedVendor);
+    // Fits: the escaped fields are capped at 63 bytes each
+    char buf[256];
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"type\":\"device\",\"ip\":\"%s\",\"mac\":\"%s\",\"vendor\":\"%s\"",
+                       ip ? ip : "",
+                       mac ? mac : "",
+                       escapedVendor);
+    if (name && name[0])
+    {
+        char escapedName[64] = {0};
+        escapeJsonString(name, escapedName, sizeof(escapedName));
+        len += snprintf(buf + len, sizeof(buf) - len, ",\"name\":\"%s\"", escapedName);
+    }
+    if (rttMs >= 0)
+    {
+        len += snprintf(buf + len, sizeof(buf) - len, ",\"rtt\":%d", rttMs);
+    }
+    snprintf(buf + len, sizeof(buf) - len, "}");
+    sendNotification(buf);
+}
+
+void BluetoothHandler::sendDeviceName(const char *ip, const char *name, const char *source)
+{
+    char escapedName[128] = {0};
+    escapeJsonString(name ? name : "", escapedName, sizeof(escapedName));
+
+    char buf[224];
+    snprintf(buf, sizeof(buf), "{\"type\":\"device_name\",\"ip\":\"%s\",\"name\":\"%s\",\"source\":\"%s\"}",
+             ip ? ip : "", escapedName, source);
     sendNotification(buf);
 }
 
@@ -490,6 +667,45 @@ void BluetoothHandler::sendNetDone(int count)
     sendNotification(buf);
 }
 
+void BluetoothHandler::sendInventoryEvent(const char *type, const char *ip, const char *mac, const char *vendor,
+                                          const char *name, const char *oldIp, uint32_t firstSeen,
+                                          uint32_t lastSeen)
+{
+    char escapedVendor[64] = {0};
+    escapeJsonString(vendor ? vendor : "Unknown", escapedVendor, sizeof(escapedVendor));
+
+    // Fits: the escaped fields are capped at 63 bytes each
+    char buf[288];
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"type\":\"%s\",\"ip\":\"%s\",\"mac\":\"%s\",\"vendor\":\"%s\"",
+                       type,
+                       ip ? ip : "",
+                       mac ? mac : "",
+                       escapedVendor);
+    if (name && name[0])
+    {
+        char escapedName[64] = {0};
+        escapeJsonString(name, escapedName, sizeof(escapedName));
+        len += snprintf(buf + len, sizeof(buf) - len, ",\"name\":\"%s\"", escapedName);
+    }
+    if (oldIp)
+    {
+        len += snprintf(buf + len, sizeof(buf) - len, ",\"old_ip\":\"%s\"", oldIp);
+    }
+    snprintf(buf + len, sizeof(buf) - len, ",\"first_seen\":%lu,\"last_seen\":%lu}",
+             (unsigned long)firstSeen, (unsigned long)lastSeen);
+    sendNotification(buf);
+}
+
+void BluetoothHandler::sendDeltaDone(int seen, int joined, int left, int changedIp, int known)
+{
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+             "{\"type\":\"delta_done\",\"seen\":%d,\"joined\":%d,\"left\":%d,\"changed_ip\":%d,\"known\":%d}",
+             seen, joined, left, changedIp, known);
+    sendNotification(buf);
+}
+
 void BluetoothHandler::sendPortResult(uint16_t port, const char *service, const char *banner)
 {
     char escapedBanner[256] = {0};
@@ -559,6 +775,41 @@ void BluetoothHandler::sendPortDone(int count)
     sendNotification(buf);
 }
 
+void BluetoothHandler::sendSweepDone(int hosts, int count)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "{\"type\":\"sweep_done\",\"hosts\":%d,\"count\":%d}", hosts, count);
+    sendNotification(buf);
+}
+
+void BluetoothHandler::sendUdpPortRaw(uint16_t port, const char *targetIp, const char *state, const char *service, const char *banner)
+{
+    char escapedBanner[128] = {0};
+    if (banner)
+    {
+        escapeJsonString(banner, escapedBanner, sizeof(escapedBanner));
+    }
+
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+             "{\"type\":\"port_raw\",\"ip\":\"%s\",\"port\":%d,\"protocol\":\"udp\",\"state\":\"%s\",\"service\":\"%s\",\"banner\":\"%s\"}",
+             targetIp ? targetIp : "",
+             port,
+             state ? state : "open",
+             service ? service : "unknown",
+             escapedBanner);
+    sendNotification(buf);
+}
+
+void BluetoothHandler::sendUdpDone(int hosts, int open, int openFiltered, int closed, int filtered)
+{
+    char buf[144];
+    snprintf(buf, sizeof(buf),
+             "{\"type\":\"udp_done\",\"hosts\":%d,\"open\":%d,\"open_filtered\":%d,\"closed\":%d,\"filtered\":%d}",
+             hosts, open, openFiltered, closed, filtered);
+    sendNotification(buf);
+}
+
 void BluetoothHandler::sendPortSummary(uint16_t startPort, uint16_t endPort, const char *targetIp, const char *os, const PortScanner &scanner)
 {
     JsonDocument doc;
@@ -568,26 +819,46 @@ void BluetoothHandler::sendPortSummary(uint16_t startPort, uint16_t endPort, con
     doc["end"] = endPort;
     doc["os"] = os ? os : "unknown";
 
+    doc["mode"] = scanner.getScanMode() == ScanMode::SYN ? "syn" : "connect";
+
+    JsonObject timeouts = doc["timeouts"].to<JsonObject>();
+    timeouts["connect"] = scanner.getConnectTimeouts();
+    timeouts["banner"] = scanner.getBannerTimeouts();
+
+    JsonObject connects = doc["connects"].to<JsonObject>();
+    connects["made"] = scanner.getConnectsMade();
+    connects["saved"] = scanner.getConnectsSaved();
+
+    const RttEstimator &rtt = scanner.getRtt();
+    JsonObject rttObj = doc["rtt"].to<JsonObject>();
+    rttObj["srtt"] = rtt.getSmoothedRtt();
+    rttObj["rttvar"] = rtt.getRttVariance();
+    rttObj["min"] = rtt.getMinRtt();
+    rttObj["max"] = rtt.getMaxRtt();
+    rttObj["rto"] = rtt.connectTimeoutMs();
+    rttObj["samples"] = rtt.getSampleCount();
+
+    JsonObject counts = doc["counts"].to<JsonObject>();
+    counts["open"] = scanner.getOpenPortCount();
+    counts["closed"] = scanner.getClosedPortCount();
+    counts["filtered"] = scanner.getFilteredPortCount();
+
     JsonArray arr = doc["open_ports"].to<JsonArray>();
-    for (int i = 0; i < scanner.getOpenPortCount(); ++i)
+    PortResultView res;
+    for (int i = 0; scanner.getResult(i, res); ++i)
     {
-        PortResult res = scanner.getResult(i);
         JsonObject obj = arr.add<JsonObject>();
         obj["port"] = res.port;
         obj["protocol"] = "tcp";
         obj["service"] = res.service;
-        if (strlen(res.banner) > 0)
+        if (res.banner[0] != '\0')
         {
             obj["banner"] = res.banner;
         }
-<<<<<<< HEAD
-        obj["version"] = ""; // no version parsing on device
-=======
-        if (strlen(res.version) > 0)
+        if (res.version[0] != '\0')
         {
             obj["version"] = res.version;
         }
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
     }
 
     String output;
@@ -595,18 +866,32 @@ void BluetoothHandler::sendPortSummary(uint16_t startPort, uint16_t endPort, con
     sendNotification(output.c_str());
 }
 
-void BluetoothHandler::sendProgress(const char *operation, int current, int total)
+void BluetoothHandler::sendProgress(const char *operation, int current, int total, int rate)
+{
+    sendProgress(operation, operation, current, total, rate);
+}
+
+void BluetoothHandler::sendProgress(const char *stage, const char *operation, int current, int total, int rate)
 {
     int percent = (total > 0) ? (current * 100 / total) : 0;
 
-    char buf[144];
-    snprintf(buf, sizeof(buf),
-             "{\"type\":\"progress\",\"stage\":\"%s\",\"operation\":\"%s\",\"current\":%d,\"total\":%d,\"percent\":%d}",
-             operation ? operation : "",
-             operation ? operation : "",
-             current,
-             total,
-             percent);
+    char buf[160];
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"type\":\"progress\",\"stage\":\"%s\",\"operation\":\"%s\",\"current\":%d,\"total\":%d,\"percent\":%d",
+                       stage ? stage : "",
+                       operation ? operation : "",
+                       current,
+                       total,
+                       percent);
+    if (rate >= 0 && len > 0 && len < (int)sizeof(buf))
+    {
+        len += snprintf(buf + len, sizeof(buf) - len, ",\"rate\":%d", rate);
+    }
+    if (len > 0 && len < (int)sizeof(buf) - 1)
+    {
+        buf[len] = '}';
+        buf[len + 1] = '\0';
+    }
     sendNotification(buf);
 }
 
@@ -625,24 +910,14 @@ void BluetoothHandler::sendError(const char *message)
     sendNotification(buf);
 }
 
-<<<<<<< HEAD
-void BluetoothHandler::sendStatus(int battery, bool charging, bool btConnected, bool wifiConnected, const char *ssid, int rssi, const char *operation, int progress)
-=======
 void BluetoothHandler::sendStatus(int battery, bool charging, bool btConnected, bool wifiConnected, const char *ssid, int rssi, const char *operation, int progress, unsigned long uptimeSeconds)
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 {
     char escapedSsid[32] = {0};
     escapeJsonString(ssid ? ssid : "unknown", escapedSsid, sizeof(escapedSsid));
 
-<<<<<<< HEAD
-    char buf[192];
-    snprintf(buf, sizeof(buf),
-             "{\"type\":\"status\",\"battery\":%d,\"charging\":%s,\"bt_connected\":%s,\"wifi_connected\":%s,\"ssid\":\"%s\",\"rssi\":%d,\"operation\":\"%s\",\"progress\":%d}",
-=======
     char buf[224];
     snprintf(buf, sizeof(buf),
              "{\"type\":\"status\",\"battery\":%d,\"charging\":%s,\"bt_connected\":%s,\"wifi_connected\":%s,\"ssid\":\"%s\",\"rssi\":%d,\"operation\":\"%s\",\"progress\":%d,\"uptime\":%lu}",
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
              battery,
              charging ? "true" : "false",
              btConnected ? "true" : "false",
@@ -650,12 +925,8 @@ void BluetoothHandler::sendStatus(int battery, bool charging, bool btConnected,
              escapedSsid,
              rssi,
              operation ? operation : "idle",
-<<<<<<< HEAD
-             progress);
-=======
              progress,
              uptimeSeconds);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
     sendNotification(buf);
 }
 
@@ -8,6 +8,8 @@
 #include <ArduinoJson.h>
 #include "config.h"
 #include "port_scanner.h"
+#include "network_scanner.h"
+#include "host_range.h"
 
 // ============================================================================
 // Bluetooth Handler - Nordic UART Service (NUS) with JSON Protocol
@@ -24,11 +26,16 @@ enum class BLECommand
 {
     NONE,
     WIFI_SCAN,       // {"cmd":"wifi_scan"}
-    NETWORK_SCAN,    // {"cmd":"network_scan"}
-    PORT_SCAN,       // {"cmd":"port_scan","target":"192.168.1.10","start":1,"end":1024}
+    NETWORK_SCAN,    // {"cmd":"network_scan"} or with "target":"192.168.0.0/22"|"192.168.1.10-50", "method":"arp|icmp|both", "names":false
+    PORT_SCAN,       // {"cmd":"port_scan","target":"192.168.1.10","start":1,"end":1024,"mode":"connect|syn"}
     WIFI_CONNECT,    // {"cmd":"wifi_connect","ssid":"...","password":"..."}
-    ADVANCED_SCAN,   // {"cmd":"advanced_scan","target":"192.168.1.10","osDetect":true,"serviceVersion":true}
+    ADVANCED_SCAN,   // {"cmd":"advanced_scan","target":"192.168.1.10","osDetect":true,"serviceVersion":true,"mode":"syn"}
     ANALYZE,         // {"cmd":"analyze","target":"192.168.1.10"}
+    SWEEP,           // {"cmd":"sweep","start":1,"end":1024} or {"cmd":"sweep","ports":"common"|"top100"}
+    TOP_PORTS,       // {"cmd":"top_ports","target":"192.168.1.10","count":100,"mode":"syn"}
+    UDP_SCAN,        // {"cmd":"udp_scan","target":"192.168.1.10","ports":[53,161]} (no target = all hosts)
+    NETWORK_DELTA,   // {"cmd":"network_delta"} or with "target" as network_scan; reports changes since the last scan
+    RESUME,          // {"cmd":"resume"} continues the last interrupted port_scan/advanced_scan/top_ports
     STATUS,          // {"cmd":"status"}
     CANCEL,          // {"cmd":"cancel"}
     UNKNOWN
@@ -51,6 +58,27 @@ struct CommandData
     // Advanced scan params
     bool osDetect = false;
     bool serviceVersion = true;
+
+    // Network scan/delta target (empty = local subnet) and discovery method
+    HostRange netRange;
+    DiscoveryMethod netMethod = DiscoveryMethod::ARP;
+    bool resolveNames = true;  // Name resolution stage after network_scan
+
+    // Sweep params (hosts come from the last network_scan)
+    bool commonPorts = false;
+
+    // Top-N ports mode (0 = use start/end range)
+    uint16_t topPorts = 0;
+
+    // Half-open discovery for single-target scans ("mode":"syn")
+    bool synScan = false;
+
+    // Probe rate ceiling in probes/second for any scan ("rate":N, 0 = default)
+    uint16_t rate = 0;
+
+    // UDP scan ports (0 entries = built-in probe ports)
+    uint16_t udpPorts[UDP_MAX_CUSTOM_PORTS] = {0};
+    uint8_t udpPortCount = 0;
 };
 
 // WiFi network info for results
@@ -93,12 +121,31 @@ public:
     void sendWifiResults(const WiFiNetworkBLE* networks, int count);
     
     // Network device found (streaming)
-    // {"type":"device","ip":"...","mac":"...","vendor":"..."}
-    void sendDevice(const char* ip, const char* mac, const char* vendor);
+    // {"type":"device","ip":"...","mac":"...","vendor":"...","name":"...","rtt":ms}
+    // "name" only when the host was heard announcing one (mDNS, NetBIOS, DHCP),
+    // "rtt" only when it answered an echo; "mac" is empty for routed hosts
+    void sendDevice(const char* ip, const char* mac, const char* vendor, const char* name = nullptr,
+                    int rttMs = -1);
     
+    // Name found for a device after discovery; a later update with a
+    // better source ("mdns" > "dns" > "netbios") replaces it
+    // {"type":"device_name","ip":"...","name":"...","source":"mdns|dns|netbios"}
+    void sendDeviceName(const char* ip, const char* name, const char* source);
+
     // Network scan complete
     // {"type":"net_done","count":N}
     void sendNetDone(int count);
+
+    // Device inventory change found by network_delta; type is "joined",
+    // "left" or "changed_ip". "old_ip" only for changed_ip; times are UTC
+    // seconds, 0 when the clock was not set
+    // {"type":"joined","ip":"...","mac":"...","vendor":"...","name":"...","old_ip":"...","first_seen":T,"last_seen":T}
+    void sendInventoryEvent(const char* type, const char* ip, const char* mac, const char* vendor,
+                            const char* name, const char* oldIp, uint32_t firstSeen, uint32_t lastSeen);
+
+    // Network delta complete; seen counts devices with a MAC in the sweep
+    // {"type":"delta_done","seen":N,"joined":N,"left":N,"changed_ip":N,"known":N}
+    void sendDeltaDone(int seen, int joined, int left, int changedIp, int known);
     
     // Port result (streaming - legacy)
     // {"type":"port_result","port":N,"service":"...","banner":"..."}
@@ -112,13 +159,30 @@ public:
     // {"type":"port_done","count":N}
     void sendPortDone(int count);
 
+    // Multi-host sweep complete
+    // {"type":"sweep_done","hosts":H,"count":N}
+    void sendSweepDone(int hosts, int count);
+
+    // UDP port result, sent for every classified port; state is one of
+    // "open", "open|filtered", "closed", "filtered"
+    // {"type":"port_raw","ip":"...","port":N,"protocol":"udp","state":"open","service":"...","banner":"..."}
+    void sendUdpPortRaw(uint16_t port, const char* targetIp, const char* state, const char* service, const char* banner = nullptr);
+
+    // UDP scan complete
+    // {"type":"udp_done","hosts":H,"open":N,"open_filtered":N,"closed":N,"filtered":N}
+    void sendUdpDone(int hosts, int open, int openFiltered, int closed, int filtered);
+
     // Port summary
-    // {"type":"port_summary","target":"...","start":S,"end":E,"os":"unknown","open_ports":[...]}
+    // {"type":"port_summary","target":"...","start":S,"end":E,"os":"unknown",
+    //  "counts":{"open":N,"closed":N,"filtered":N},"mode":"connect|syn","timeouts":{"connect":N,"banner":N},"connects":{"made":N,"saved":N},"rtt":{"srtt":ms,"rttvar":ms,"min":ms,"max":ms,"rto":ms,"samples":N},
+    //  "open_ports":[...]}
     void sendPortSummary(uint16_t startPort, uint16_t endPort, const char* targetIp, const char* os, const PortScanner& scanner);
     
-    // Progress update (optional)
-    // {"type":"progress","stage":"...","operation":"...","current":N,"total":N,"percent":P}
-    void sendProgress(const char* operation, int current, int total);
+    // Progress update (optional); "rate" is the live probe rate, omitted when rate < 0
+    // {"type":"progress","stage":"...","operation":"...","current":N,"total":N,"percent":P,"rate":pps}
+    void sendProgress(const char* operation, int current, int total, int rate = -1);
+    // Same with a distinct pipeline stage, e.g. stage "discover"/"enrich" of operation "port_scan"
+    void sendProgress(const char* stage, const char* operation, int current, int total, int rate = -1);
     
     // Cancelled confirmation
     // {"type":"cancelled"}
@@ -129,13 +193,8 @@ public:
     void sendError(const char* message);
     
     // Status update (periodic)
-<<<<<<< HEAD
-    // {"type":"status","battery":N,"charging":true/false,"bt_connected":bool,"wifi_connected":bool,"ssid":"...","rssi":-65,"operation":"...","progress":P}
-    void sendStatus(int battery, bool charging, bool btConnected, bool wifiConnected, const char* ssid, int rssi, const char* operation, int progress);
-=======
     // {"type":"status","battery":N,"charging":true/false,"bt_connected":bool,"wifi_connected":bool,"ssid":"...","rssi":-65,"operation":"...","progress":P,"uptime":S}
     void sendStatus(int battery, bool charging, bool btConnected, bool wifiConnected, const char* ssid, int rssi, const char* operation, int progress, unsigned long uptimeSeconds);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 
     // Raw JSON (for custom messages)
     void sendRaw(const char* json);
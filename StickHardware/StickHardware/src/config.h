@@ -17,19 +17,87 @@
 // WiFi Configuration
 #define WIFI_CONNECT_TIMEOUT_MS 15000
 #define WIFI_SCAN_TIMEOUT_MS 10000
+#define NTP_SERVER "pool.ntp.org"     // Synced after connecting; inventory times are UTC
 
 // Network Scanner Configuration
-#define ARP_TIMEOUT_MS 100
-#define ARP_RETRIES 2
-#define MAX_DEVICES_IN_SCAN 96
+#define ARP_TIMEOUT_MS 100            // Per attempt, measured from the request
+#define ARP_RETRIES 2                 // Attempts per address (a retry goes out ahead of fresh addresses)
+#define ARP_BURST_SIZE 16             // Requests per poll tick
+#define ARP_MAX_IN_FLIGHT 64          // Outstanding requests awaiting a reply
+#define ARP_POLL_MS 5
+#define ARP_CAPTURE_RING_SIZE 64      // Replies captured on the input path between ticks
+#define MAX_DEVICES_IN_SCAN 4096      // Device records kept per sweep (12 bytes each, heap, grown on demand)
+#define NETWORK_SCAN_MAX_HOSTS 65536  // Largest sweep: a /16
+#define ICMP_TIMEOUT_MS 1000          // Per echo attempt; routed hosts and dozing phones answer slowly
+#define ICMP_RETRIES 2                // Echo attempts per address
+#define ICMP_BURST_SIZE 8             // Echo requests per poll tick
+#define ICMP_MAX_IN_FLIGHT 64         // Outstanding echo requests (a power of two: low bits of the sequence)
+#define ICMP_POLL_MS 5
+
+// Passive discovery (mDNS, SSDP, NetBIOS-NS and DHCP broadcasts while idle)
+#define PASSIVE_MAX_HOSTS 64          // Hosts remembered; the stalest is replaced when full
+#define PASSIVE_HOST_TTL_MS 600000    // Forget a host not heard from for 10 minutes
+#define PASSIVE_NAME_SIZE 32
+#define PASSIVE_MAINTENANCE_MS 250    // MAC resolution and expiry interval
+#define PASSIVE_ARP_RETRY_MS 2000     // Between background ARP requests for one host
+#define PASSIVE_ARP_RETRIES 3
+#define PASSIVE_TRUST_MS 120000       // Heard this recently, a host is reported without an ARP probe
+
+// Name resolution after network_scan (reverse DNS, mDNS and NBSTAT per device)
+#define NAME_RESOLVE_BATCH 32         // Devices queried together; three datagrams each
+#define NAME_RESOLVE_TIMEOUT_MS 1500  // Wait for a batch after its last query went out
+#define NAME_QUERY_BURST 12           // Queries sent per poll tick
+#define NAME_RESOLVE_POLL_MS 5
+#define NAME_RESOLVE_NAME_SIZE 64
+
+// Device inventory (LittleFS, one file per network) and network_delta
+#define INVENTORY_MAX_DEVICES 256     // Devices remembered per network (20 bytes each); oldest evicted
+#define INVENTORY_PATH_FORMAT "/inv_%08lx.bin"  // Named by a hash of the SSID and subnet
+#define DELTA_UNKNOWN_ATTEMPTS 1      // ARP attempts for addresses without a known device
 
 // Port Scanner Configuration
 #define PORT_CONNECT_TIMEOUT_MS 2000
 #define BANNER_READ_TIMEOUT_MS 1000
 #define BANNER_MAX_SIZE 256
-#define PARALLEL_PORT_SCANS 10
+#define PARALLEL_PORT_SCANS 10       // In-flight connects; keep below CONFIG_LWIP_MAX_SOCKETS
 #define DEFAULT_PORT_RANGE_START 20
 #define DEFAULT_PORT_RANGE_END 1000
+#define MAX_SWEEP_HOSTS 96           // Port-sweep targets (static per-target state in PortScanner)
+#define ENRICH_QUEUE_DEPTH PARALLEL_PORT_SCANS  // Open sockets awaiting banners; shares the socket budget
+#define ENRICH_POLL_MS 10
+#define PROBE_SESSION_BUFFER_SIZE 512  // Cached response bytes per open port (headers + banner)
+#define PROBE_REQUEST_MAX_SIZE 288     // Probe payload (max 255) after {host} expansion
+#define MAX_OPEN_PORT_RECORDS 512      // Open ports kept with detail per job
+#define PORT_TEXT_POOL_SIZE 16384      // Banner/version/OS text for open ports
+#define DEFAULT_TOP_PORTS 100          // top_ports mode; table in src/generated/top_ports_table.h
+#define SYN_MAX_IN_FLIGHT 256          // Outstanding half-open probes (8 bytes each, no socket)
+#define SYN_SEND_BURST 16              // SYNs sent per scheduler pass
+#define SYN_RETRIES 1                  // Retransmits before a silent port counts as filtered
+#define UDP_MAX_IN_FLIGHT 32           // Outstanding UDP probes across all hosts
+#define UDP_PROBE_TIMEOUT_MS 1000      // Per attempt; UDP daemons answer slower than TCP stacks
+#define UDP_RETRIES 1                  // Resends before a silent port is open|filtered
+#define UDP_BANNER_SIZE 64
+#define UDP_MAX_CUSTOM_PORTS 16        // "ports" array accepted by udp_scan
+
+// Probe pacing (token bucket + AIMD); "rate" in scan commands overrides the ceiling
+#define RATE_DEFAULT_PPS 400           // Ceiling in probes per second
+#define RATE_MIN_PPS 10                // Floor after repeated backoff
+#define RATE_INCREASE_PPS 20           // Additive increase per second of answered probes
+#define RATE_BACKOFF_HOLD_MS 500       // Losses within this window count as one event
+#define RATE_LOSS_WINDOW 50            // Probe outcomes per lost-fraction sample
+#define RATE_LOSS_PERCENT 10           // Lost share of a sample that counts as congestion
+#define RATE_BURST_MS 50               // Bucket depth in milliseconds of rate
+
+// Resumable single-target scans (LittleFS)
+#define SCAN_CHECKPOINT_PATH "/scan.ckpt"
+#define SCAN_CHECKPOINT_INTERVAL_MS 5000  // Rewritten only when the resume point moved
+
+// Adaptive timeouts (per-target RTT estimation)
+#define RTT_SEED_SAMPLES 3              // Handshakes measured before timeouts shrink
+#define RTT_CLOCK_GRANULARITY_MS 50     // Matches the select() wait in the sweep loop
+#define RTT_MIN_CONNECT_TIMEOUT_MS 250  // Floor for WiFi jitter
+#define RTT_MIN_BANNER_TIMEOUT_MS 300
+#define RTT_BANNER_RTO_MULTIPLIER 3
 
 // Common Ports to prioritize
 static const uint16_t COMMON_PORTS[] = {
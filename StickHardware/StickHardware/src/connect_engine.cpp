@@ -0,0 +1,183 @@
+#include "connect_engine.h"
+#include <lwip/sockets.h>
+
+// ============================================================================
+// Connect Engine - Implementation
+// ============================================================================
+// Active slots are kept packed at the front of the array so poll() only walks
+// in-flight sockets. A released slot is filled with the last active one.
+// ============================================================================
+
+void ConnectEngine::begin(int maxInFlight)
+{
+    abortAll();
+    slotLimit = (maxInFlight > 0 && maxInFlight < MAX_SLOTS) ? maxInFlight : MAX_SLOTS;
+}
+
+bool ConnectEngine::submit(uint32_t ip, uint16_t port, uint32_t timeoutMs, uint16_t tag)
+{
+    if (!hasFreeSlot())
+    {
+        return false;
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0)
+    {
+        // lwIP socket pool exhausted - retry once a slot has drained
+        return false;
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = ip;
+
+    Slot &slot = slots[activeCount];
+    slot.fd = fd;
+    slot.ip = ip;
+    slot.port = port;
+    slot.startMs = millis();
+    slot.timeoutMs = timeoutMs;
+    slot.tag = tag;
+    slot.settled = false;
+    slot.result = ProbeState::FILTERED;
+
+    int rc = connect(fd, (struct sockaddr *)&addr, sizeof(addr));
+    if (rc == 0)
+    {
+        slot.settled = true;
+        slot.result = ProbeState::OPEN;
+    }
+    else if (errno != EINPROGRESS)
+    {
+        slot.settled = true;
+        slot.result = (errno == ECONNREFUSED || errno == ECONNRESET) ? ProbeState::CLOSED : ProbeState::FILTERED;
+    }
+
+    activeCount++;
+    return true;
+}
+
+void ConnectEngine::releaseSlot(int index, ProbeState state, ConnectOutcome &outcome)
+{
+    Slot &slot = slots[index];
+
+    outcome.ip = slot.ip;
+    outcome.port = slot.port;
+    outcome.state = state;
+    outcome.rttMs = millis() - slot.startMs;
+    outcome.tag = slot.tag;
+
+    if (state == ProbeState::OPEN)
+    {
+        outcome.fd = slot.fd; // ownership passes to the caller
+    }
+    else
+    {
+        outcome.fd = -1;
+        close(slot.fd);
+    }
+
+    slots[index] = slots[--activeCount];
+}
+
+int ConnectEngine::poll(ConnectOutcome *out, int maxOut, uint32_t waitMs)
+{
+    if (activeCount == 0 || maxOut <= 0)
+    {
+        return 0;
+    }
+
+    int produced = 0;
+
+    // Report anything that resolved synchronously in submit()
+    for (int i = 0; i < activeCount && produced < maxOut;)
+    {
+        if (slots[i].settled)
+        {
+            releaseSlot(i, slots[i].result, out[produced++]);
+            continue; // slot i now holds a different socket
+        }
+        i++;
+    }
+    if (produced > 0 || activeCount == 0)
+    {
+        return produced;
+    }
+
+    // Sleep no longer than the nearest deadline
+    unsigned long now = millis();
+    uint32_t waitLimit = waitMs;
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    int maxFd = -1;
+    for (int i = 0; i < activeCount; i++)
+    {
+        unsigned long elapsed = now - slots[i].startMs;
+        uint32_t remaining = (elapsed >= slots[i].timeoutMs) ? 0 : slots[i].timeoutMs - elapsed;
+        if (remaining < waitLimit)
+        {
+            waitLimit = remaining;
+        }
+        FD_SET(slots[i].fd, &writeSet);
+        if (slots[i].fd > maxFd)
+        {
+            maxFd = slots[i].fd;
+        }
+    }
+
+    struct timeval tv;
+    tv.tv_sec = waitLimit / 1000;
+    tv.tv_usec = (waitLimit % 1000) * 1000;
+
+    int ready = select(maxFd + 1, nullptr, &writeSet, nullptr, &tv);
+
+    now = millis();
+    for (int i = 0; i < activeCount && produced < maxOut;)
+    {
+        Slot &slot = slots[i];
+
+        if (ready > 0 && FD_ISSET(slot.fd, &writeSet))
+        {
+            int soError = 0;
+            socklen_t len = sizeof(soError);
+            getsockopt(slot.fd, SOL_SOCKET, SO_ERROR, &soError, &len);
+
+            ProbeState state = ProbeState::OPEN;
+            if (soError == ECONNREFUSED || soError == ECONNRESET)
+            {
+                state = ProbeState::CLOSED;
+            }
+            else if (soError != 0)
+            {
+                state = ProbeState::FILTERED; // unreachable, timed out in stack
+            }
+            releaseSlot(i, state, out[produced++]);
+            continue;
+        }
+
+        if (now - slot.startMs >= slot.timeoutMs)
+        {
+            releaseSlot(i, ProbeState::FILTERED, out[produced++]);
+            continue;
+        }
+
+        i++;
+    }
+
+    return produced;
+}
+
+void ConnectEngine::abortAll()
+{
+    for (int i = 0; i < activeCount; i++)
+    {
+        close(slots[i].fd);
+    }
+    activeCount = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef CONNECT_ENGINE_H
+#define CONNECT_ENGINE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Connect Engine - Concurrent non-blocking TCP connects multiplexed by select()
+// ============================================================================
+
+enum class ProbeState : uint8_t
+{
+    OPEN,     // Handshake completed
+    CLOSED,   // RST received
+    FILTERED  // No answer before the deadline (or unreachable)
+};
+
+struct ConnectOutcome
+{
+    uint32_t ip;        // Target address (network byte order)
+    uint16_t port;
+    ProbeState state;
+    int fd;             // Connected socket when OPEN (caller owns it), -1 otherwise
+    uint32_t rttMs;     // Time from connect() to completion
+    uint16_t tag;       // Caller's identifier passed to submit()
+};
+
+class ConnectEngine
+{
+public:
+    static const int MAX_SLOTS = PARALLEL_PORT_SCANS;
+
+    // Reset all slots; maxInFlight is clamped to MAX_SLOTS
+    void begin(int maxInFlight = MAX_SLOTS);
+
+    // Start a non-blocking connect. Returns false if no slot or socket is
+    // available right now; the caller should poll() and try again.
+    bool submit(uint32_t ip, uint16_t port, uint32_t timeoutMs, uint16_t tag = 0);
+
+    // Wait up to waitMs for connects to complete or expire.
+    // Fills up to maxOut outcomes and returns how many were written.
+    int poll(ConnectOutcome *out, int maxOut, uint32_t waitMs);
+
+    // Close every in-flight socket without reporting outcomes
+    void abortAll();
+
+    bool hasFreeSlot() const { return activeCount < slotLimit; }
+    int inFlight() const { return activeCount; }
+    int capacity() const { return slotLimit; }
+
+private:
+    struct Slot
+    {
+        int fd;
+        uint32_t ip;
+        uint16_t port;
+        unsigned long startMs;
+        uint32_t timeoutMs;
+        uint16_t tag;
+        bool settled;        // connect() already resolved inside submit()
+        ProbeState result;   // valid when settled
+    };
+
+    Slot slots[MAX_SLOTS];
+    int activeCount = 0;
+    int slotLimit = MAX_SLOTS;
+
+    void releaseSlot(int index, ProbeState state, ConnectOutcome &outcome);
+};
+
+#endif // CONNECT_ENGINE_H
@@ -0,0 +1,398 @@
+#include "device_inventory.h"
+#include "scan_checkpoint.h"
+#include <LittleFS.h>
+#include <stdlib.h>
+#include <time.h>
+
+// ============================================================================
+// Device Inventory - Implementation
+// ============================================================================
+
+DeviceInventory deviceInventory;
+
+// Anything earlier is the epoch the clock starts at before SNTP answers
+static const time_t CLOCK_VALID_AFTER = 1600000000;
+
+static uint32_t wallClock()
+{
+    time_t now = time(nullptr);
+    return now >= CLOCK_VALID_AFTER ? (uint32_t)now : 0;
+}
+
+bool DeviceInventory::begin()
+{
+    mounted = LittleFS.begin(true);
+    if (!mounted)
+    {
+        Serial.println("[Inventory] LittleFS mount failed - inventory will not persist");
+    }
+    return mounted;
+}
+
+bool DeviceInventory::allocate()
+{
+    if (records)
+    {
+        return true;
+    }
+    records = (Record *)malloc(INVENTORY_MAX_DEVICES * sizeof(Record));
+    addresses = (uint32_t *)malloc(INVENTORY_MAX_DEVICES * sizeof(uint32_t));
+    if (!records || !addresses)
+    {
+        Serial.println("[Inventory] Allocation failed");
+        free(records);
+        free(addresses);
+        records = nullptr;
+        addresses = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool DeviceInventory::select(const char *ssid, const HostRange &subnet)
+{
+    uint32_t key = simpleCrc32((const uint8_t *)ssid, strlen(ssid));
+    key = simpleCrc32((const uint8_t *)&subnet.first, sizeof(subnet.first), key);
+    key = simpleCrc32((const uint8_t *)&subnet.last, sizeof(subnet.last), key);
+    if (selected && key == networkKey)
+    {
+        return true;
+    }
+    if (!allocate())
+    {
+        selected = false;
+        return false;
+    }
+
+    networkKey = key;
+    count = 0;
+    selected = true;
+    snprintf(path, sizeof(path), INVENTORY_PATH_FORMAT, (unsigned long)key);
+
+    if (load())
+    {
+        Serial.printf("[Inventory] %d devices known on %s\n", count, ssid);
+    }
+    return true;
+}
+
+bool DeviceInventory::load()
+{
+    if (!mounted || !LittleFS.exists(path))
+    {
+        return false;
+    }
+
+    File file = LittleFS.open(path, "r");
+    Header header;
+    bool ok = file && file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+              header.magic == MAGIC && header.version == VERSION &&
+              header.networkKey == networkKey && header.count <= INVENTORY_MAX_DEVICES &&
+              file.size() == sizeof(header) + header.count * sizeof(Record);
+    size_t length = ok ? header.count * sizeof(Record) : 0;
+    ok = ok && file.read((uint8_t *)records, length) == length;
+    file.close();
+
+    if (ok)
+    {
+        uint32_t stored = header.crc;
+        header.crc = 0;
+        uint32_t crc = simpleCrc32((const uint8_t *)records, length);
+        ok = simpleCrc32((const uint8_t *)&header, sizeof(header), crc) == stored;
+    }
+    if (!ok)
+    {
+        Serial.println("[Inventory] Stored inventory is damaged - starting over");
+        LittleFS.remove(path);
+        return false;
+    }
+
+    count = header.count;
+    return true;
+}
+
+bool DeviceInventory::save()
+{
+    if (!mounted || !selected)
+    {
+        return false;
+    }
+
+    char tempPath[sizeof(path) + 4];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+    File file = LittleFS.open(tempPath, "w");
+    if (!file)
+    {
+        Serial.println("[Inventory] Could not open inventory file");
+        return false;
+    }
+
+    size_t length = count * sizeof(Record);
+    Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.networkKey = networkKey;
+    header.count = count;
+    header.crc = simpleCrc32((const uint8_t *)&header, sizeof(header),
+                             simpleCrc32((const uint8_t *)records, length));
+
+    bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+              file.write((const uint8_t *)records, length) == length;
+    file.close();
+
+    if (!ok)
+    {
+        Serial.println("[Inventory] Write failed");
+        LittleFS.remove(tempPath);
+        return false;
+    }
+
+    // rename() replaces the old inventory in one step; only if the
+    // filesystem refuses to overwrite is the old one removed first
+    if (!LittleFS.rename(tempPath, path))
+    {
+        LittleFS.remove(path);
+        if (!LittleFS.rename(tempPath, path))
+        {
+            Serial.println("[Inventory] Rename failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+int DeviceInventory::find(const uint8_t *mac) const
+{
+    int low = 0;
+    int high = count;
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        int order = memcmp(records[mid].mac, mac, 6);
+        if (order == 0)
+        {
+            return mid;
+        }
+        if (order < 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+int DeviceInventory::insert(const uint8_t *mac)
+{
+    if (count >= INVENTORY_MAX_DEVICES)
+    {
+        // Full: forget the device seen longest ago, preferring one already gone
+        int victim = -1;
+        for (int i = 0; i < count; i++)
+        {
+            const Record &r = records[i];
+            if (r.flags & FLAG_SEEN)
+            {
+                continue;
+            }
+            if (victim < 0)
+            {
+                victim = i;
+                continue;
+            }
+            const Record &v = records[victim];
+            bool rGone = !(r.flags & FLAG_PRESENT);
+            bool vGone = !(v.flags & FLAG_PRESENT);
+            if (rGone != vGone ? rGone : r.lastSeen < v.lastSeen)
+            {
+                victim = i;
+            }
+        }
+        if (victim < 0)
+        {
+            return -1;
+        }
+        memmove(&records[victim], &records[victim + 1], (count - victim - 1) * sizeof(Record));
+        count--;
+    }
+
+    int index = 0;
+    while (index < count && memcmp(records[index].mac, mac, 6) < 0)
+    {
+        index++;
+    }
+    memmove(&records[index + 1], &records[index], (count - index) * sizeof(Record));
+    count++;
+
+    Record &record = records[index];
+    memset(&record, 0, sizeof(record));
+    memcpy(record.mac, mac, 6);
+    return index;
+}
+
+static int compareAddresses(const void *a, const void *b)
+{
+    uint32_t ipA = *(const uint32_t *)a;
+    uint32_t ipB = *(const uint32_t *)b;
+    return ipA < ipB ? -1 : (ipA > ipB ? 1 : 0);
+}
+
+const uint32_t *DeviceInventory::knownAddresses(const HostRange &range, int &outCount)
+{
+    outCount = 0;
+    if (!selected)
+    {
+        return nullptr;
+    }
+
+    // Devices that left too: they tend to come back at the same address
+    for (int i = 0; i < count; i++)
+    {
+        if (range.contains(records[i].ip))
+        {
+            addresses[outCount++] = records[i].ip;
+        }
+    }
+    qsort(addresses, outCount, sizeof(uint32_t), compareAddresses);
+
+    int unique = 0;
+    for (int i = 0; i < outCount; i++)
+    {
+        if (unique == 0 || addresses[unique - 1] != addresses[i])
+        {
+            addresses[unique++] = addresses[i];
+        }
+    }
+    outCount = unique;
+    return addresses;
+}
+
+void DeviceInventory::merge(const NetworkDevice &dev, uint32_t now, InventoryEventCallback callback,
+                            InventorySummary &summary)
+{
+    uint32_t ip = toHostOrder(dev.ip);
+    summary.seen++;
+
+    int index = find(dev.mac);
+    bool added = false;
+    if (index < 0)
+    {
+        index = insert(dev.mac);
+        if (index < 0)
+        {
+            Serial.printf("[Inventory] Full (%d), not keeping %s\n", count, dev.macStr);
+            return;
+        }
+        records[index].ip = ip;
+        records[index].firstSeen = now;
+        added = true;
+    }
+
+    Record &record = records[index];
+    InventoryEvent event;
+    memcpy(event.mac, record.mac, 6);
+    event.ip = ip;
+    event.oldIp = record.ip;
+    event.firstSeen = record.firstSeen;
+    event.lastSeen = now;
+
+    bool report = true;
+    if (added || !(record.flags & FLAG_PRESENT))
+    {
+        event.change = InventoryChange::JOINED;
+        summary.joined++;
+    }
+    else if (record.ip != ip)
+    {
+        event.change = InventoryChange::CHANGED_IP;
+        summary.changedIp++;
+    }
+    else
+    {
+        report = false;
+    }
+
+    record.ip = ip;
+    if (now != 0)
+    {
+        record.lastSeen = now;
+    }
+    record.flags |= FLAG_PRESENT | FLAG_SEEN;
+
+    if (report && callback)
+    {
+        callback(event);
+    }
+}
+
+InventorySummary DeviceInventory::apply(const NetworkScanner &scanner, const HostRange &range,
+                                        InventoryEventCallback callback)
+{
+    InventorySummary summary = {0, 0, 0, 0};
+    if (!selected)
+    {
+        return summary;
+    }
+
+    uint32_t now = wallClock();
+    for (int i = 0; i < count; i++)
+    {
+        records[i].flags &= ~FLAG_SEEN;
+    }
+
+    // A MAC can answer for several addresses (proxy ARP, a host with two
+    // IPs). The address it already had wins, so that is not a move: the
+    // first pass takes unchanged devices, the second everything else once.
+    int found = scanner.getDeviceCount();
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < found; i++)
+        {
+            NetworkDevice dev = scanner.getDevice(i);
+            uint32_t ip = toHostOrder(dev.ip);
+            if (!dev.hasMac || !range.contains(ip))
+            {
+                continue;
+            }
+            int index = find(dev.mac);
+            bool unchanged = index >= 0 && records[index].ip == ip;
+            bool merged = index >= 0 && (records[index].flags & FLAG_SEEN);
+            if (pass == 0 ? !unchanged || merged : merged)
+            {
+                continue;
+            }
+            merge(dev, now, callback, summary);
+        }
+    }
+
+    // Present before, silent now, and its address was swept
+    for (int i = 0; i < count; i++)
+    {
+        Record &record = records[i];
+        if (!(record.flags & FLAG_PRESENT) || (record.flags & FLAG_SEEN) || !range.contains(record.ip))
+        {
+            continue;
+        }
+        record.flags &= ~FLAG_PRESENT;
+        summary.left++;
+        if (callback)
+        {
+            InventoryEvent event;
+            event.change = InventoryChange::LEFT;
+            memcpy(event.mac, record.mac, 6);
+            event.ip = record.ip;
+            event.oldIp = record.ip;
+            event.firstSeen = record.firstSeen;
+            event.lastSeen = record.lastSeen;
+            callback(event);
+        }
+    }
+
+    Serial.printf("[Inventory] %d seen: %d joined, %d left, %d changed address (%d known)\n",
+                  summary.seen, summary.joined, summary.left, summary.changedIp, count);
+    return summary;
+}
@@ -0,0 +1,116 @@
+#ifndef DEVICE_INVENTORY_H
+#define DEVICE_INVENTORY_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "config.h"
+#include "host_range.h"
+#include "network_scanner.h"
+
+// ============================================================================
+// Device Inventory - Devices seen per network, persisted to LittleFS
+// ============================================================================
+// One file per network (named by a hash of the SSID and subnet, so one site
+// never reports another's devices as gone) holding a record per MAC: last
+// address, first and last time seen and whether it answered the last sweep.
+// Records are kept sorted by MAC and found by binary search. The file is a
+// header with a CRC-32 and the raw records, written to a temporary name and
+// renamed into place like the scan checkpoint.
+//
+// Times are UTC seconds from SNTP; 0 means the clock was not set yet.
+// ============================================================================
+
+enum class InventoryChange : uint8_t
+{
+    JOINED,     // New MAC, or one that had left
+    LEFT,       // Known and present, silent in a sweep of its address
+    CHANGED_IP  // Present at a different address than last time
+};
+
+struct InventoryEvent
+{
+    InventoryChange change;
+    uint8_t mac[6];
+    uint32_t ip;        // Host order; the last known address for LEFT
+    uint32_t oldIp;     // CHANGED_IP only
+    uint32_t firstSeen;
+    uint32_t lastSeen;  // Before this sweep for LEFT
+};
+
+typedef void (*InventoryEventCallback)(const InventoryEvent &event);
+
+struct InventorySummary
+{
+    int seen;      // Devices with a MAC in the sweep
+    int joined;
+    int left;
+    int changedIp;
+};
+
+class DeviceInventory
+{
+public:
+    // Mount the filesystem; without it the inventory lives in RAM only
+    bool begin();
+
+    // Switch to the inventory of a network, loading it if stored
+    bool select(const char *ssid, const HostRange &subnet);
+
+    int getCount() const { return count; }
+
+    // Last known addresses inside range: sorted and unique, for
+    // NetworkScanner::setKnownHosts(). Valid until the next apply().
+    const uint32_t *knownAddresses(const HostRange &range, int &outCount);
+
+    // Merge the scanner's results for range (devices with a MAC). Events
+    // go to callback if one is given; the counts are returned either way.
+    InventorySummary apply(const NetworkScanner &scanner, const HostRange &range,
+                           InventoryEventCallback callback = nullptr);
+
+    bool save();
+
+private:
+    struct Record
+    {
+        uint8_t mac[6];
+        uint8_t flags;       // FLAG_* below
+        uint8_t reserved;
+        uint32_t ip;         // Host order
+        uint32_t firstSeen;
+        uint32_t lastSeen;
+    };
+
+    struct Header
+    {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t reserved[3];
+        uint32_t networkKey;
+        uint32_t count;
+        uint32_t crc;        // Over the records, then the header with crc = 0
+    };
+
+    static const uint32_t MAGIC = 0x5649534E; // "NSIV"
+    static const uint8_t VERSION = 1;
+    static const uint8_t FLAG_PRESENT = 0x01; // Answered the last sweep of its address
+    static const uint8_t FLAG_SEEN = 0x02;    // In the sweep being applied
+
+    Record *records = nullptr;     // Heap, INVENTORY_MAX_DEVICES, sorted by MAC
+    uint32_t *addresses = nullptr; // knownAddresses() output
+    int count = 0;
+    uint32_t networkKey = 0;
+    bool selected = false;
+    bool mounted = false;
+    char path[24] = {0};
+
+    bool allocate();
+    bool load();
+    int find(const uint8_t *mac) const;
+    int insert(const uint8_t *mac);
+    void merge(const NetworkDevice &dev, uint32_t now, InventoryEventCallback callback,
+               InventorySummary &summary);
+};
+
+extern DeviceInventory deviceInventory;
+
+#endif // DEVICE_INVENTORY_H
@@ -0,0 +1,244 @@
+#include "dns_message.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// DNS Message - Implementation
+// ============================================================================
+
+static const int DNS_MAX_POINTER_HOPS = 16;
+
+static inline uint16_t readBe16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t readBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+DnsReader::DnsReader(const uint8_t *message, size_t length)
+    : message(message), length(length)
+{
+}
+
+bool DnsReader::readHeader(DnsHeader &header)
+{
+    if (failed || cursor != 0 || length < DNS_HEADER_SIZE)
+    {
+        failed = true;
+        return false;
+    }
+    header.id = readBe16(message);
+    header.flags = readBe16(message + 2);
+    header.questions = readBe16(message + 4);
+    header.answers = readBe16(message + 6);
+    header.authorities = readBe16(message + 8);
+    header.additionals = readBe16(message + 10);
+    cursor = DNS_HEADER_SIZE;
+    return true;
+}
+
+bool DnsReader::skipName(size_t offset, size_t &next) const
+{
+    while (offset < length)
+    {
+        uint8_t label = message[offset];
+        if (label == 0)
+        {
+            next = offset + 1;
+            return true;
+        }
+        if ((label & 0xC0) == 0xC0)
+        {
+            if (offset + 2 > length)
+            {
+                return false;
+            }
+            next = offset + 2; // A pointer always ends the name in place
+            return true;
+        }
+        if (label & 0xC0)
+        {
+            return false; // Extended label types are not used on the wire
+        }
+        offset += 1 + label;
+    }
+    return false;
+}
+
+bool DnsReader::readName(size_t offset, char *out, size_t outSize) const
+{
+    if (outSize == 0)
+    {
+        return false;
+    }
+
+    size_t written = 0;
+    int hops = 0;
+    while (offset < length)
+    {
+        uint8_t label = message[offset];
+        if (label == 0)
+        {
+            out[written] = '\0';
+            return true;
+        }
+        if ((label & 0xC0) == 0xC0)
+        {
+            if (offset + 2 > length || ++hops > DNS_MAX_POINTER_HOPS)
+            {
+                break;
+            }
+            offset = readBe16(message + offset) & 0x3FFF;
+            continue;
+        }
+        if ((label & 0xC0) || offset + 1 + label > length)
+        {
+            break;
+        }
+
+        if (written > 0 && written + 1 < outSize)
+        {
+            out[written++] = '.';
+        }
+        for (uint8_t i = 0; i < label && written + 1 < outSize; i++)
+        {
+            char c = (char)message[offset + 1 + i];
+            out[written++] = (c >= 0x20 && c < 0x7F) ? c : '?';
+        }
+        offset += 1 + label;
+    }
+
+    out[0] = '\0';
+    return false;
+}
+
+bool DnsReader::readQuestion(DnsRecord &out)
+{
+    size_t next;
+    if (failed || cursor < DNS_HEADER_SIZE || !skipName(cursor, next) || next + 4 > length ||
+        !readName(cursor, out.name, sizeof(out.name)))
+    {
+        failed = true;
+        return false;
+    }
+    out.type = readBe16(message + next);
+    out.rrClass = readBe16(message + next + 2);
+    out.ttl = 0;
+    out.dataLength = 0;
+    out.dataOffset = next + 4;
+    cursor = next + 4;
+    return true;
+}
+
+bool DnsReader::readRecord(DnsRecord &out)
+{
+    size_t next;
+    if (failed || cursor < DNS_HEADER_SIZE || !skipName(cursor, next) || next + 10 > length ||
+        !readName(cursor, out.name, sizeof(out.name)))
+    {
+        failed = true;
+        return false;
+    }
+    out.type = readBe16(message + next);
+    out.rrClass = readBe16(message + next + 2);
+    out.ttl = readBe32(message + next + 4);
+    out.dataLength = readBe16(message + next + 8);
+    out.dataOffset = next + 10;
+    if (out.dataOffset + out.dataLength > length)
+    {
+        failed = true;
+        return false;
+    }
+    cursor = out.dataOffset + out.dataLength;
+    return true;
+}
+
+size_t writeDnsQuery(uint8_t *out, size_t outSize, uint16_t id, uint16_t flags,
+                     const char *name, uint16_t type, uint16_t rrClass)
+{
+    if (outSize < DNS_HEADER_SIZE)
+    {
+        return 0;
+    }
+    memset(out, 0, DNS_HEADER_SIZE);
+    out[0] = (uint8_t)(id >> 8);
+    out[1] = (uint8_t)id;
+    out[2] = (uint8_t)(flags >> 8);
+    out[3] = (uint8_t)flags;
+    out[5] = 1; // One question
+
+    size_t written = DNS_HEADER_SIZE;
+    while (*name)
+    {
+        size_t label = strcspn(name, ".");
+        if (label == 0 || label > 63 || written + 1 + label > outSize)
+        {
+            return 0;
+        }
+        out[written++] = (uint8_t)label;
+        memcpy(out + written, name, label);
+        written += label;
+        name += label;
+        if (*name == '.')
+        {
+            name++;
+        }
+    }
+
+    if (written + 5 > outSize)
+    {
+        return 0;
+    }
+    out[written++] = 0; // Root label
+    out[written++] = (uint8_t)(type >> 8);
+    out[written++] = (uint8_t)type;
+    out[written++] = (uint8_t)(rrClass >> 8);
+    out[written++] = (uint8_t)rrClass;
+    return written;
+}
+
+void reverseDnsName(uint32_t ip, char *out, size_t outSize)
+{
+    snprintf(out, outSize, "%u.%u.%u.%u.in-addr.arpa",
+             (unsigned)(ip & 0xFF), (unsigned)((ip >> 8) & 0xFF),
+             (unsigned)((ip >> 16) & 0xFF), (unsigned)(ip >> 24));
+}
+
+bool decodeNetbiosName(const char *encoded, char *out, size_t outSize, uint8_t &suffix)
+{
+    // 16 bytes, each split into two nibbles written as 'A' + nibble
+    size_t encodedLength = strcspn(encoded, ".");
+    if (encodedLength != 32 || outSize == 0)
+    {
+        return false;
+    }
+
+    char name[16];
+    for (int i = 0; i < 16; i++)
+    {
+        char high = encoded[i * 2];
+        char low = encoded[i * 2 + 1];
+        if (high < 'A' || high > 'P' || low < 'A' || low > 'P')
+        {
+            return false;
+        }
+        name[i] = (char)(((high - 'A') << 4) | (low - 'A'));
+    }
+    suffix = (uint8_t)name[15];
+
+    size_t end = 15;
+    while (end > 0 && name[end - 1] == ' ')
+    {
+        end--;
+    }
+    size_t written = 0;
+    for (size_t i = 0; i < end && written + 1 < outSize; i++)
+    {
+        out[written++] = (name[i] >= 0x20 && name[i] < 0x7F) ? name[i] : '?';
+    }
+    out[written] = '\0';
+    return written > 0;
+}
@@ -0,0 +1,92 @@
+#ifndef DNS_MESSAGE_H
+#define DNS_MESSAGE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// DNS Message - Reader and query writer for DNS-format packets (DNS, mDNS,
+// NetBIOS-NS)
+// ============================================================================
+// Pure functions over byte buffers, like syn_packet. Names are returned
+// dotted ("host.local"); compression pointers are followed with a hop limit
+// so a malicious packet cannot loop. Bytes outside printable ASCII are
+// replaced with '?'.
+// ============================================================================
+
+static const size_t DNS_HEADER_SIZE = 12;
+static const size_t DNS_NAME_MAX = 256;
+
+static const uint16_t DNS_TYPE_A = 1;
+static const uint16_t DNS_TYPE_PTR = 12;
+static const uint16_t DNS_TYPE_NB = 32;
+static const uint16_t DNS_TYPE_NBSTAT = 33;
+static const uint16_t DNS_CLASS_IN = 1;
+static const uint16_t DNS_FLAG_RECURSION_DESIRED = 0x0100;
+
+struct DnsHeader
+{
+    uint16_t id;
+    uint16_t flags;
+    uint16_t questions;
+    uint16_t answers;
+    uint16_t authorities;
+    uint16_t additionals;
+
+    bool isResponse() const { return (flags & 0x8000) != 0; }
+    uint8_t opcode() const { return (uint8_t)((flags >> 11) & 0x0F); }
+    uint8_t rcode() const { return (uint8_t)(flags & 0x0F); }
+};
+
+struct DnsRecord
+{
+    char name[DNS_NAME_MAX];
+    uint16_t type;
+    uint16_t rrClass;     // mDNS: top bit is cache-flush / unicast-response
+    uint32_t ttl;
+    uint16_t dataLength;
+    size_t dataOffset;    // RDATA position in the message
+};
+
+// Walks a message section by section. Every read returns false once the
+// message is exhausted or malformed; the reader then stays failed.
+class DnsReader
+{
+public:
+    DnsReader(const uint8_t *message, size_t length);
+
+    bool readHeader(DnsHeader &header);
+
+    // Question entries carry no TTL or data; out.dataLength is 0
+    bool readQuestion(DnsRecord &out);
+    bool readRecord(DnsRecord &out);
+
+    // Decode the (possibly compressed) name at offset; false if malformed
+    bool readName(size_t offset, char *out, size_t outSize) const;
+
+    const uint8_t *data() const { return message; }
+    size_t size() const { return length; }
+
+private:
+    const uint8_t *message;
+    size_t length;
+    size_t cursor = 0;
+    bool failed = false;
+
+    // Bytes the name at offset occupies in place (a pointer counts as 2)
+    bool skipName(size_t offset, size_t &next) const;
+};
+
+// One-question query for a dotted name. Returns the message length, or 0
+// if a label is empty or over 63 bytes or the message does not fit.
+size_t writeDnsQuery(uint8_t *out, size_t outSize, uint16_t id, uint16_t flags,
+                     const char *name, uint16_t type, uint16_t rrClass);
+
+// Reverse lookup name: "4.3.2.1.in-addr.arpa" for 1.2.3.4 (host byte order)
+void reverseDnsName(uint32_t ip, char *out, size_t outSize);
+
+// First-level NetBIOS name ("FEEFFDFE..." 32 chars, optional ".scope") to
+// the 15-char name with trailing spaces trimmed; suffix is the 16th byte
+bool decodeNetbiosName(const char *encoded, char *out, size_t outSize, uint8_t &suffix);
+
+#endif // DNS_MESSAGE_H
@@ -0,0 +1,271 @@
+// Generated by scripts/gen_banner_signatures.py - do not edit
+#ifndef BANNER_AUTOMATON_H
+#define BANNER_AUTOMATON_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "banner_signature_ids.h"
+
+static constexpr size_t BANNER_AC_STATES = 181;
+static constexpr size_t BANNER_AC_CLASSES = 48;
+typedef uint8_t BannerAcState;
+
+// Byte -> class; class 0 is every byte no signature uses
+static constexpr uint8_t BANNER_AC_CLASS[256] = {
+    1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 6, 0, 7, 8, 0, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 0, 20, 21, 0, 0, 0, 0, 0,
+    0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 0, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 0, 44, 45, 46, 0, 0, 0, 0, 22,
+    0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 0, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 0, 44, 45, 46, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+};
+
+// Next state, BANNER_AC_CLASSES entries per state
+static constexpr BannerAcState BANNER_AC_DELTA[] = {
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 3, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 4, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 99, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 127, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 116, 0, 25, 0, 98, 0, 0, 0, 80, 110, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 7, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 8, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 9, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 17, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 10, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 11, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 12, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 13, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 14, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 15, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 16, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 18, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 19, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 20, 0, 98, 0, 0, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 21, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 22, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 23, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 24, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 27, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 28, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 29, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 30, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 31, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 32, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 34, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 130, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 35, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 36, 25, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 37, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 38, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 39, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 155, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 40, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 41, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 44, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 45, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 46, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 116, 0, 47, 0, 98, 0, 0, 0, 80, 110, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 48, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 49, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 50, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 53, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 54, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 55, 0, 154, 0, 81, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 56, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 57, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 59, 0, 154, 0, 81, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 60, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 62, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 63, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 168, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 65, 105, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 66, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 67, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 68, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 69, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 70, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 71, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 155, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 72, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 73, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 167, 0, 85, 1, 74, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 76, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 77, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 78, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 90, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 81, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 82, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 58, 122, 166, 42, 83, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 84, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 87, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 88, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 91, 25, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 92, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 93, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 94, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 155, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 95, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 96, 0, 129, 0, 0, 0, 0, 86, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 97, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 99, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 100, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 101, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 102, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 103, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 104, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 106, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 107, 166, 62, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 108, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 145, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 116, 0, 25, 0, 98, 0, 0, 0, 80, 110, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 144, 98, 0, 0, 0, 80, 122, 111, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 130, 0, 85, 1, 0, 113, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 114, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 115, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 99, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 117, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 118, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 144, 98, 119, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 120, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 121, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 144, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 124, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 125, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 128, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 130, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 132, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 130, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 133, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 134, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 99, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 135, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 137, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 138, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 139, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 140, 142, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 141, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 143, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 145, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 146, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 144, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 147, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 148, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 149, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 150, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 151, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 152, 153, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 155, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 156, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 26, 0, 0, 80, 122, 166, 42, 0, 85, 1, 157, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 158, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 159, 0, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 160, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 126, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 52, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 162, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 163, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 164, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 165, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 167, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 168, 25, 0, 98, 0, 0, 0, 80, 122, 61, 42, 0, 85, 1, 0, 43, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 169, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 144, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 170, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 58, 122, 166, 42, 0, 85, 171, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 172, 0, 0, 0, 58, 122, 166, 42, 0, 85, 2, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 4, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 173, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 99, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 174, 176, 178, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 175, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 177, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 179, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 180, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+    0, 0, 0, 123, 79, 51, 0, 75, 64, 109, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 25, 0, 98, 0, 0, 0, 80, 122, 166, 42, 0, 85, 1, 0, 0, 154, 0, 0, 0, 89,
+};
+
+// Signatures recognised on entering each state, BANNER_SIGNATURE_WORDS per state
+static constexpr uint64_t BANNER_AC_OUTPUT[] = {
+    0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+    0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000020ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000080ULL, 0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000100ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000800ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+    0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000002000ULL, 0x0000000000004000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+    0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000800000ULL, 0x0000000000000000ULL,
+    0x0000000001000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000008000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000100000ULL, 0x0000000000100000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+    0x0000000000000000ULL, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000100000000ULL,
+};
+
+static_assert(sizeof(BANNER_AC_DELTA) / sizeof(BANNER_AC_DELTA[0]) == BANNER_AC_STATES * BANNER_AC_CLASSES, "table size");
+static_assert(sizeof(BANNER_AC_OUTPUT) / sizeof(BANNER_AC_OUTPUT[0]) == BANNER_AC_STATES * BANNER_SIGNATURE_WORDS, "table size");
+
+#endif // BANNER_AUTOMATON_H
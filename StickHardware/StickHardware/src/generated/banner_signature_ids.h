@@ -0,0 +1,49 @@
+// Generated by scripts/gen_banner_signatures.py - do not edit
+#ifndef BANNER_SIGNATURE_IDS_H
+#define BANNER_SIGNATURE_IDS_H
+
+#include <stdint.h>
+
+enum BannerSignature : uint8_t
+{
+    SIG_SERVICE_0 = 0, // "ssh-"
+    SIG_SERVICE_1 = 1, // "220 (vsftpd "
+    SIG_SERVICE_2 = 2, // "220 proftpd "
+    SIG_SERVICE_3 = 3, // "filezilla server "
+    SIG_SERVICE_4 = 4, // "pure-ftpd"
+    SIG_SERVICE_5 = 5, // "220"
+    SIG_SERVICE_6 = 6, // " esmtp "
+    SIG_SERVICE_7 = 7, // "smtp"
+    SIG_SERVICE_8 = 8, // "pop3"
+    SIG_SERVICE_9 = 9, // "+ok dovecot"
+    SIG_SERVICE_10 = 10, // "* ok"
+    SIG_SERVICE_11 = 11, // "\x0a"
+    SIG_SERVICE_12 = 12, // "mysql"
+    SIG_SERVICE_13 = 13, // "rfb "
+    SIG_SERVICE_14 = 14, // "\xff"
+    SIG_SERVICE_15 = 15, // "\x0aserver: "
+    SIG_SERVICE_16 = 16, // "http/1."
+    SIG_SERVICE_17 = 17, // "+pong"
+    SIG_SERVICE_18 = 18, // "-noauth"
+    SIG_SERVICE_19 = 19, // "-denied"
+    SIG_SERVICE_20 = 20, // "s"
+    SIG_SERVICE_21 = 21, // "n"
+    SIG_SERVICE_22 = 22, // "\x03\x00\x00"
+    SIG_SERVICE_23 = 23, // " \x02"
+    SIG_SSH_V1 = 24, // "ssh-1."
+    SIG_APACHE_2_4_49 = 25, // "apache/2.4.49"
+    SIG_APACHE_2_4_50 = 26, // "apache/2.4.50"
+    SIG_NGINX_1_14 = 27, // "nginx/1.14"
+    SIG_NGINX_1_15 = 28, // "nginx/1.15"
+    SIG_VSFTPD_2_3_4 = 29, // "vsftpd 2.3.4"
+    SIG_OPENSSH_5 = 30, // "openssh_5."
+    SIG_OPENSSH_6 = 31, // "openssh_6."
+    SIG_OPENSSH_7_2 = 32, // "openssh_7.2"
+    BANNER_SIGNATURE_COUNT = 33,
+    SIG_NONE = 0xFF
+};
+
+// uint64_t words in a signature mask
+static constexpr int BANNER_SIGNATURE_WORDS = 1;
+
+#endif // BANNER_SIGNATURE_IDS_H
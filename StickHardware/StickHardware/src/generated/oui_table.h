@@ -0,0 +1,745 @@
+// Generated by scripts/gen_oui_table.py from tables/oui/seed.csv - do not edit
+#ifndef OUI_TABLE_H
+#define OUI_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Vendor names, NUL-separated; records hold byte offsets into it
+static constexpr char OUI_VENDOR_POOL[] =
+    "ASUSTek Computer\0"
+    "AVM\0"
+    "Amazon Technologies\0"
+    "Apple\0"
+    "Arduino\0"
+    "Aruba Networks\0"
+    "Belkin International\0"
+    "Brother Industries\0"
+    "Cisco Meraki\0"
+    "Cisco Systems\0"
+    "Cisco-Linksys\0"
+    "D-Link\0"
+    "Dell\0"
+    "Espressif\0"
+    "Fortinet\0"
+    "Google\0"
+    "Hewlett Packard\0"
+    "Huawei Technologies\0"
+    "Intel\0"
+    "Juniper Networks\0"
+    "Microsoft\0"
+    "Nest Labs\0"
+    "Netgear\0"
+    "Nintendo\0"
+    "PCS Systemtechnik\0"
+    "Philips Lighting\0"
+    "QNAP Systems\0"
+    "Ralink Technology\0"
+    "Raspberry Pi Foundation\0"
+    "Raspberry Pi Trading\0"
+    "Realtek Semiconductor\0"
+    "Roku\0"
+    "Routerboard.com\0"
+    "Samsung Electronics\0"
+    "Sonos\0"
+    "Sony\0"
+    "Sony Interactive Entertainment\0"
+    "Super Micro Computer\0"
+    "Synology\0"
+    "TP-LINK Technologies\0"
+    "Texas Instruments\0"
+    "Ubiquiti Networks\0"
+    "VMware\0"
+    "Xerox\0"
+    "Xiaomi Communications\0"
+    "Zyxel Communications\0"
+    ;
+static constexpr size_t OUI_VENDOR_POOL_SIZE = 644;
+static constexpr size_t OUI_VENDOR_COUNT = 46;
+static constexpr size_t OUI_OFFSET_BYTES = 2; // Big-endian, after the prefix
+
+// 24-bit prefixes, sorted; 3 key bytes + offset per record
+static constexpr size_t OUI_MAL_COUNT = 671;
+static constexpr uint8_t OUI_MAL_RECORDS[] = {
+    0x00, 0x00, 0x0C, 0x00, 0x7B,
+    0x00, 0x00, 0xAA, 0x02, 0x53,
+    0x00, 0x00, 0xF0, 0x01, 0xB7,
+    0x00, 0x01, 0x42, 0x00, 0x7B,
+    0x00, 0x01, 0x43, 0x00, 0x7B,
+    0x00, 0x01, 0x63, 0x00, 0x7B,
+    0x00, 0x01, 0x64, 0x00, 0x7B,
+    0x00, 0x01, 0x96, 0x00, 0x7B,
+    0x00, 0x01, 0x97, 0x00, 0x7B,
+    0x00, 0x01, 0xE6, 0x00, 0xBD,
+    0x00, 0x01, 0xE7, 0x00, 0xBD,
+    0x00, 0x02, 0xA5, 0x00, 0xBD,
+    0x00, 0x02, 0xB3, 0x00, 0xE1,
+    0x00, 0x03, 0x47, 0x00, 0xE1,
+    0x00, 0x03, 0x93, 0x00, 0x29,
+    0x00, 0x04, 0x0E, 0x00, 0x11,
+    0x00, 0x04, 0x23, 0x00, 0xE1,
+    0x00, 0x04, 0xEA, 0x00, 0xBD,
+    0x00, 0x05, 0x02, 0x00, 0x29,
+    0x00, 0x05, 0x5D, 0x00, 0x97,
+    0x00, 0x05, 0x69, 0x02, 0x4C,
+    0x00, 0x05, 0x85, 0x00, 0xE7,
+    0x00, 0x06, 0x25, 0x00, 0x89,
+    0x00, 0x06, 0x5B, 0x00, 0x9E,
+    0x00, 0x07, 0xAB, 0x01, 0xB7,
+    0x00, 0x07, 0xE9, 0x00, 0xE1,
+    0x00, 0x08, 0x02, 0x00, 0xBD,
+    0x00, 0x08, 0x74, 0x00, 0x9E,
+    0x00, 0x08, 0x9B, 0x01, 0x40,
+    0x00, 0x09, 0x0F, 0x00, 0xAD,
+    0x00, 0x09, 0x5B, 0x01, 0x0C,
+    0x00, 0x09, 0xBF, 0x01, 0x14,
+    0x00, 0x0A, 0x27, 0x00, 0x29,
+    0x00, 0x0A, 0x95, 0x00, 0x29,
+    0x00, 0x0B, 0x86, 0x00, 0x37,
+    0x00, 0x0B, 0xCD, 0x00, 0xBD,
+    0x00, 0x0B, 0xDB, 0x00, 0x9E,
+    0x00, 0x0C, 0x29, 0x02, 0x4C,
+    0x00, 0x0C, 0x41, 0x00, 0x89,
+    0x00, 0x0C, 0x42, 0x01, 0xA7,
+    0x00, 0x0C, 0x43, 0x01, 0x4D,
+    0x00, 0x0C, 0x6E, 0x00, 0x00,
+    0x00, 0x0D, 0x56, 0x00, 0x9E,
+    0x00, 0x0D, 0x88, 0x00, 0x97,
+    0x00, 0x0D, 0x93, 0x00, 0x29,
+    0x00, 0x0D, 0x9D, 0x00, 0xBD,
+    0x00, 0x0E, 0x08, 0x00, 0x89,
+    0x00, 0x0E, 0x0C, 0x00, 0xE1,
+    0x00, 0x0E, 0x58, 0x01, 0xCB,
+    0x00, 0x0E, 0x7F, 0x00, 0xBD,
+    0x00, 0x0E, 0xA6, 0x00, 0x00,
+    0x00, 0x0F, 0x1F, 0x00, 0x9E,
+    0x00, 0x0F, 0x20, 0x00, 0xBD,
+    0x00, 0x0F, 0x3D, 0x00, 0x97,
+    0x00, 0x0F, 0x66, 0x00, 0x89,
+    0x00, 0x0F, 0xB5, 0x01, 0x0C,
+    0x00, 0x10, 0x83, 0x00, 0xBD,
+    0x00, 0x10, 0xDB, 0x00, 0xE7,
+    0x00, 0x11, 0x0A, 0x00, 0xBD,
+    0x00, 0x11, 0x24, 0x00, 0x29,
+    0x00, 0x11, 0x2F, 0x00, 0x00,
+    0x00, 0x11, 0x32, 0x02, 0x0A,
+    0x00, 0x11, 0x43, 0x00, 0x9E,
+    0x00, 0x11, 0x50, 0x00, 0x46,
+    0x00, 0x11, 0x85, 0x00, 0xBD,
+    0x00, 0x11, 0x95, 0x00, 0x97,
+    0x00, 0x11, 0xD8, 0x00, 0x00,
+    0x00, 0x12, 0x17, 0x00, 0x89,
+    0x00, 0x12, 0x1E, 0x00, 0xE7,
+    0x00, 0x12, 0x3F, 0x00, 0x9E,
+    0x00, 0x12, 0x47, 0x01, 0xB7,
+    0x00, 0x12, 0x4B, 0x02, 0x28,
+    0x00, 0x12, 0x79, 0x00, 0xBD,
+    0x00, 0x13, 0x02, 0x00, 0xE1,
+    0x00, 0x13, 0x10, 0x00, 0x89,
+    0x00, 0x13, 0x20, 0x00, 0xE1,
+    0x00, 0x13, 0x21, 0x00, 0xBD,
+    0x00, 0x13, 0x46, 0x00, 0x97,
+    0x00, 0x13, 0x49, 0x02, 0x6F,
+    0x00, 0x13, 0x72, 0x00, 0x9E,
+    0x00, 0x13, 0xA9, 0x01, 0xD1,
+    0x00, 0x13, 0xD4, 0x00, 0x00,
+    0x00, 0x13, 0xE8, 0x00, 0xE1,
+    0x00, 0x14, 0x22, 0x00, 0x9E,
+    0x00, 0x14, 0x38, 0x00, 0xBD,
+    0x00, 0x14, 0x51, 0x00, 0x29,
+    0x00, 0x14, 0x6C, 0x01, 0x0C,
+    0x00, 0x14, 0xBF, 0x00, 0x89,
+    0x00, 0x14, 0xC2, 0x00, 0xBD,
+    0x00, 0x14, 0xF6, 0x00, 0xE7,
+    0x00, 0x15, 0x00, 0x00, 0xE1,
+    0x00, 0x15, 0x0C, 0x00, 0x11,
+    0x00, 0x15, 0x5D, 0x00, 0xF8,
+    0x00, 0x15, 0x60, 0x00, 0xBD,
+    0x00, 0x15, 0x6D, 0x02, 0x3A,
+    0x00, 0x15, 0x99, 0x01, 0xB7,
+    0x00, 0x15, 0xC5, 0x00, 0x9E,
+    0x00, 0x15, 0xE9, 0x00, 0x97,
+    0x00, 0x15, 0xF2, 0x00, 0x00,
+    0x00, 0x16, 0x32, 0x01, 0xB7,
+    0x00, 0x16, 0x35, 0x00, 0xBD,
+    0x00, 0x16, 0x56, 0x01, 0x14,
+    0x00, 0x16, 0x6F, 0x00, 0xE1,
+    0x00, 0x16, 0x76, 0x00, 0xE1,
+    0x00, 0x16, 0xB6, 0x00, 0x89,
+    0x00, 0x16, 0xCB, 0x00, 0x29,
+    0x00, 0x17, 0x08, 0x00, 0xBD,
+    0x00, 0x17, 0x31, 0x00, 0x00,
+    0x00, 0x17, 0x3F, 0x00, 0x46,
+    0x00, 0x17, 0x88, 0x01, 0x2F,
+    0x00, 0x17, 0x9A, 0x00, 0x97,
+    0x00, 0x17, 0xA4, 0x00, 0xBD,
+    0x00, 0x17, 0xAB, 0x01, 0x14,
+    0x00, 0x17, 0xCB, 0x00, 0xE7,
+    0x00, 0x17, 0xEC, 0x02, 0x28,
+    0x00, 0x17, 0xF2, 0x00, 0x29,
+    0x00, 0x18, 0x0A, 0x00, 0x6E,
+    0x00, 0x18, 0x30, 0x02, 0x28,
+    0x00, 0x18, 0x39, 0x00, 0x89,
+    0x00, 0x18, 0x4D, 0x01, 0x0C,
+    0x00, 0x18, 0x82, 0x00, 0xCD,
+    0x00, 0x18, 0x8B, 0x00, 0x9E,
+    0x00, 0x18, 0xDE, 0x00, 0xE1,
+    0x00, 0x18, 0xF3, 0x00, 0x00,
+    0x00, 0x18, 0xF8, 0x00, 0x89,
+    0x00, 0x18, 0xFE, 0x00, 0xBD,
+    0x00, 0x19, 0x1D, 0x01, 0x14,
+    0x00, 0x19, 0x5B, 0x00, 0x97,
+    0x00, 0x19, 0xB9, 0x00, 0x9E,
+    0x00, 0x19, 0xBB, 0x00, 0xBD,
+    0x00, 0x19, 0xCB, 0x02, 0x6F,
+    0x00, 0x19, 0xD1, 0x00, 0xE1,
+    0x00, 0x19, 0xE2, 0x00, 0xE7,
+    0x00, 0x19, 0xE3, 0x00, 0x29,
+    0x00, 0x19, 0xFD, 0x01, 0x14,
+    0x00, 0x1A, 0x11, 0x00, 0xB6,
+    0x00, 0x1A, 0x1E, 0x00, 0x37,
+    0x00, 0x1A, 0x4B, 0x00, 0xBD,
+    0x00, 0x1A, 0x70, 0x00, 0x89,
+    0x00, 0x1A, 0x80, 0x01, 0xD1,
+    0x00, 0x1A, 0x92, 0x00, 0x00,
+    0x00, 0x1A, 0xA0, 0x00, 0x9E,
+    0x00, 0x1A, 0xB6, 0x02, 0x28,
+    0x00, 0x1A, 0xE9, 0x01, 0x14,
+    0x00, 0x1B, 0x11, 0x00, 0x97,
+    0x00, 0x1B, 0x21, 0x00, 0xE1,
+    0x00, 0x1B, 0x2F, 0x01, 0x0C,
+    0x00, 0x1B, 0x54, 0x00, 0x7B,
+    0x00, 0x1B, 0x63, 0x00, 0x29,
+    0x00, 0x1B, 0x77, 0x00, 0xE1,
+    0x00, 0x1B, 0x78, 0x00, 0xBD,
+    0x00, 0x1B, 0x7A, 0x01, 0x14,
+    0x00, 0x1B, 0xA9, 0x00, 0x5B,
+    0x00, 0x1B, 0xEA, 0x01, 0x14,
+    0x00, 0x1B, 0xFC, 0x00, 0x00,
+    0x00, 0x1C, 0x10, 0x00, 0x89,
+    0x00, 0x1C, 0x14, 0x02, 0x4C,
+    0x00, 0x1C, 0x23, 0x00, 0x9E,
+    0x00, 0x1C, 0x4A, 0x00, 0x11,
+    0x00, 0x1C, 0xB3, 0x00, 0x29,
+    0x00, 0x1C, 0xBE, 0x01, 0x14,
+    0x00, 0x1C, 0xBF, 0x00, 0xE1,
+    0x00, 0x1C, 0xC4, 0x00, 0xBD,
+    0x00, 0x1C, 0xDF, 0x00, 0x46,
+    0x00, 0x1C, 0xF0, 0x00, 0x97,
+    0x00, 0x1D, 0x09, 0x00, 0x9E,
+    0x00, 0x1D, 0x0F, 0x02, 0x13,
+    0x00, 0x1D, 0x25, 0x01, 0xB7,
+    0x00, 0x1D, 0x4F, 0x00, 0x29,
+    0x00, 0x1D, 0x60, 0x00, 0x00,
+    0x00, 0x1D, 0x7E, 0x00, 0x89,
+    0x00, 0x1D, 0xBC, 0x01, 0x14,
+    0x00, 0x1E, 0x0B, 0x00, 0xBD,
+    0x00, 0x1E, 0x10, 0x00, 0xCD,
+    0x00, 0x1E, 0x13, 0x00, 0x7B,
+    0x00, 0x1E, 0x14, 0x00, 0x7B,
+    0x00, 0x1E, 0x2A, 0x01, 0x0C,
+    0x00, 0x1E, 0x35, 0x01, 0x14,
+    0x00, 0x1E, 0x4F, 0x00, 0x9E,
+    0x00, 0x1E, 0x52, 0x00, 0x29,
+    0x00, 0x1E, 0x58, 0x00, 0x97,
+    0x00, 0x1E, 0x64, 0x00, 0xE1,
+    0x00, 0x1E, 0x67, 0x00, 0xE1,
+    0x00, 0x1E, 0x8C, 0x00, 0x00,
+    0x00, 0x1E, 0xA9, 0x01, 0x14,
+    0x00, 0x1E, 0xC2, 0x00, 0x29,
+    0x00, 0x1E, 0xE5, 0x00, 0x89,
+    0x00, 0x1F, 0x12, 0x00, 0xE7,
+    0x00, 0x1F, 0x29, 0x00, 0xBD,
+    0x00, 0x1F, 0x32, 0x01, 0x14,
+    0x00, 0x1F, 0x33, 0x01, 0x0C,
+    0x00, 0x1F, 0x3B, 0x00, 0xE1,
+    0x00, 0x1F, 0x3F, 0x00, 0x11,
+    0x00, 0x1F, 0x5B, 0x00, 0x29,
+    0x00, 0x1F, 0xC5, 0x01, 0x14,
+    0x00, 0x1F, 0xC6, 0x00, 0x00,
+    0x00, 0x1F, 0xF3, 0x00, 0x29,
+    0x00, 0x21, 0x19, 0x01, 0xB7,
+    0x00, 0x21, 0x29, 0x00, 0x89,
+    0x00, 0x21, 0x47, 0x01, 0x14,
+    0x00, 0x21, 0x59, 0x00, 0xE7,
+    0x00, 0x21, 0x5A, 0x00, 0xBD,
+    0x00, 0x21, 0x5C, 0x00, 0xE1,
+    0x00, 0x21, 0x6A, 0x00, 0xE1,
+    0x00, 0x21, 0x70, 0x00, 0x9E,
+    0x00, 0x21, 0x91, 0x00, 0x97,
+    0x00, 0x21, 0xBD, 0x01, 0x14,
+    0x00, 0x21, 0xE9, 0x00, 0x29,
+    0x00, 0x22, 0x15, 0x00, 0x00,
+    0x00, 0x22, 0x19, 0x00, 0x9E,
+    0x00, 0x22, 0x3F, 0x01, 0x0C,
+    0x00, 0x22, 0x41, 0x00, 0x29,
+    0x00, 0x22, 0x4C, 0x01, 0x14,
+    0x00, 0x22, 0x55, 0x00, 0x7B,
+    0x00, 0x22, 0x64, 0x00, 0xBD,
+    0x00, 0x22, 0x6B, 0x00, 0x89,
+    0x00, 0x22, 0x83, 0x00, 0xE7,
+    0x00, 0x22, 0xA5, 0x02, 0x28,
+    0x00, 0x22, 0xAA, 0x01, 0x14,
+    0x00, 0x22, 0xB0, 0x00, 0x97,
+    0x00, 0x22, 0xD7, 0x01, 0x14,
+    0x00, 0x22, 0xFA, 0x00, 0xE1,
+    0x00, 0x23, 0x04, 0x00, 0x7B,
+    0x00, 0x23, 0x12, 0x00, 0x29,
+    0x00, 0x23, 0x31, 0x01, 0x14,
+    0x00, 0x23, 0x32, 0x00, 0x29,
+    0x00, 0x23, 0x39, 0x01, 0xB7,
+    0x00, 0x23, 0x54, 0x00, 0x00,
+    0x00, 0x23, 0x69, 0x00, 0x89,
+    0x00, 0x23, 0x6C, 0x00, 0x29,
+    0x00, 0x23, 0x7D, 0x00, 0xBD,
+    0x00, 0x23, 0x9C, 0x00, 0xE7,
+    0x00, 0x23, 0xAE, 0x00, 0x9E,
+    0x00, 0x23, 0xCC, 0x01, 0x14,
+    0x00, 0x23, 0xCD, 0x02, 0x13,
+    0x00, 0x23, 0xDF, 0x00, 0x29,
+    0x00, 0x23, 0xF8, 0x02, 0x6F,
+    0x00, 0x24, 0x01, 0x00, 0x97,
+    0x00, 0x24, 0x1E, 0x01, 0x14,
+    0x00, 0x24, 0x36, 0x00, 0x29,
+    0x00, 0x24, 0x44, 0x01, 0x14,
+    0x00, 0x24, 0x6C, 0x00, 0x37,
+    0x00, 0x24, 0x81, 0x00, 0xBD,
+    0x00, 0x24, 0x8C, 0x00, 0x00,
+    0x00, 0x24, 0xB2, 0x01, 0x0C,
+    0x00, 0x24, 0xBA, 0x02, 0x28,
+    0x00, 0x24, 0xBE, 0x01, 0xD1,
+    0x00, 0x24, 0xD6, 0x00, 0xE1,
+    0x00, 0x24, 0xDC, 0x00, 0xE7,
+    0x00, 0x24, 0xE8, 0x00, 0x9E,
+    0x00, 0x24, 0xF3, 0x01, 0x14,
+    0x00, 0x24, 0xFE, 0x00, 0x11,
+    0x00, 0x25, 0x00, 0x00, 0x29,
+    0x00, 0x25, 0x4B, 0x00, 0x29,
+    0x00, 0x25, 0x64, 0x00, 0x9E,
+    0x00, 0x25, 0x68, 0x00, 0xCD,
+    0x00, 0x25, 0x86, 0x02, 0x13,
+    0x00, 0x25, 0x90, 0x01, 0xF5,
+    0x00, 0x25, 0x9C, 0x00, 0x89,
+    0x00, 0x25, 0x9E, 0x00, 0xCD,
+    0x00, 0x25, 0xA0, 0x01, 0x14,
+    0x00, 0x25, 0xB3, 0x00, 0xBD,
+    0x00, 0x25, 0xBC, 0x00, 0x29,
+    0x00, 0x26, 0x08, 0x00, 0x29,
+    0x00, 0x26, 0x0B, 0x00, 0x7B,
+    0x00, 0x26, 0x18, 0x00, 0x00,
+    0x00, 0x26, 0x37, 0x01, 0xB7,
+    0x00, 0x26, 0x4A, 0x00, 0x29,
+    0x00, 0x26, 0x55, 0x00, 0xBD,
+    0x00, 0x26, 0x59, 0x01, 0x14,
+    0x00, 0x26, 0x5A, 0x00, 0x97,
+    0x00, 0x26, 0x88, 0x00, 0xE7,
+    0x00, 0x26, 0xB0, 0x00, 0x29,
+    0x00, 0x26, 0xB9, 0x00, 0x9E,
+    0x00, 0x26, 0xBB, 0x00, 0x29,
+    0x00, 0x26, 0xCB, 0x00, 0x7B,
+    0x00, 0x26, 0xF2, 0x01, 0x0C,
+    0x00, 0x27, 0x09, 0x01, 0x14,
+    0x00, 0x27, 0x10, 0x00, 0xE1,
+    0x00, 0x27, 0x19, 0x02, 0x13,
+    0x00, 0x27, 0x22, 0x02, 0x3A,
+    0x00, 0x46, 0x4B, 0x00, 0xCD,
+    0x00, 0x50, 0x0F, 0x00, 0x7B,
+    0x00, 0x50, 0x56, 0x02, 0x4C,
+    0x00, 0x50, 0xF2, 0x00, 0xF8,
+    0x00, 0x60, 0x09, 0x00, 0x7B,
+    0x00, 0x80, 0x77, 0x00, 0x5B,
+    0x00, 0xA0, 0xC5, 0x02, 0x6F,
+    0x00, 0xD9, 0xD1, 0x01, 0xD6,
+    0x00, 0xE0, 0x1E, 0x00, 0x7B,
+    0x00, 0xE0, 0x4C, 0x01, 0x8C,
+    0x00, 0xE0, 0xFC, 0x00, 0xCD,
+    0x04, 0x03, 0xD6, 0x01, 0x14,
+    0x04, 0x18, 0xD6, 0x02, 0x3A,
+    0x04, 0xBD, 0x88, 0x00, 0x37,
+    0x04, 0xC0, 0x6F, 0x00, 0xCD,
+    0x04, 0xCF, 0x8C, 0x02, 0x59,
+    0x04, 0xD4, 0xC4, 0x00, 0x00,
+    0x08, 0x00, 0x27, 0x01, 0x1D,
+    0x08, 0x05, 0x81, 0x01, 0xA2,
+    0x08, 0x19, 0xA6, 0x00, 0xCD,
+    0x08, 0x3A, 0xF2, 0x00, 0xA3,
+    0x08, 0x55, 0x31, 0x01, 0xA7,
+    0x08, 0x5B, 0x0E, 0x00, 0xAD,
+    0x08, 0x60, 0x6E, 0x00, 0x00,
+    0x08, 0x86, 0x3B, 0x00, 0x46,
+    0x08, 0x96, 0xD7, 0x00, 0x11,
+    0x08, 0xBD, 0x43, 0x01, 0x0C,
+    0x08, 0xD4, 0x2B, 0x01, 0xB7,
+    0x0C, 0x37, 0xDC, 0x00, 0xCD,
+    0x0C, 0x47, 0xC9, 0x00, 0x15,
+    0x0C, 0x8D, 0xDB, 0x00, 0x6E,
+    0x0C, 0xC4, 0x7A, 0x01, 0xF5,
+    0x10, 0x0D, 0x7F, 0x01, 0x0C,
+    0x10, 0x1B, 0x54, 0x00, 0xCD,
+    0x10, 0x1D, 0xC0, 0x01, 0xB7,
+    0x10, 0x52, 0x1C, 0x00, 0xA3,
+    0x10, 0x59, 0x32, 0x01, 0xA2,
+    0x10, 0x60, 0x4B, 0x00, 0xBD,
+    0x10, 0x7B, 0xEF, 0x02, 0x6F,
+    0x10, 0xBF, 0x48, 0x00, 0x00,
+    0x10, 0xFE, 0xED, 0x02, 0x13,
+    0x14, 0xCC, 0x20, 0x02, 0x13,
+    0x14, 0xD6, 0x4D, 0x00, 0x97,
+    0x14, 0xDA, 0xE9, 0x00, 0x00,
+    0x14, 0xFE, 0xB5, 0x00, 0x9E,
+    0x18, 0x03, 0x73, 0x00, 0x9E,
+    0x18, 0x59, 0x36, 0x02, 0x59,
+    0x18, 0x64, 0x72, 0x00, 0x37,
+    0x18, 0xA9, 0x9B, 0x00, 0x9E,
+    0x18, 0xB4, 0x30, 0x01, 0x02,
+    0x18, 0xD6, 0xC7, 0x02, 0x13,
+    0x18, 0xE8, 0x29, 0x02, 0x3A,
+    0x18, 0xFD, 0x74, 0x01, 0xA7,
+    0x18, 0xFE, 0x34, 0x00, 0xA3,
+    0x1C, 0x3B, 0xF3, 0x02, 0x13,
+    0x1C, 0x7E, 0xE5, 0x00, 0x97,
+    0x1C, 0x87, 0x2C, 0x00, 0x00,
+    0x20, 0x4C, 0x03, 0x00, 0x37,
+    0x20, 0x4E, 0x7F, 0x01, 0x0C,
+    0x20, 0xF3, 0xA3, 0x00, 0xCD,
+    0x24, 0x0A, 0xC4, 0x00, 0xA3,
+    0x24, 0x5A, 0x4C, 0x02, 0x3A,
+    0x24, 0x5E, 0xBE, 0x01, 0x40,
+    0x24, 0x62, 0xAB, 0x00, 0xA3,
+    0x24, 0x65, 0x11, 0x00, 0x11,
+    0x24, 0x6F, 0x28, 0x00, 0xA3,
+    0x24, 0xA4, 0x3C, 0x02, 0x3A,
+    0x24, 0xB6, 0xFD, 0x00, 0x9E,
+    0x24, 0xDC, 0xC3, 0x00, 0xA3,
+    0x24, 0xDE, 0xC6, 0x00, 0x37,
+    0x28, 0x0D, 0xFC, 0x01, 0xD6,
+    0x28, 0x10, 0x7B, 0x00, 0x97,
+    0x28, 0x6C, 0x07, 0x02, 0x59,
+    0x28, 0x6E, 0xD4, 0x00, 0xCD,
+    0x28, 0x8A, 0x1C, 0x00, 0xE7,
+    0x28, 0xC6, 0x8E, 0x01, 0x0C,
+    0x28, 0xCD, 0xC1, 0x01, 0x77,
+    0x2C, 0x3A, 0xFD, 0x00, 0x11,
+    0x2C, 0x41, 0x38, 0x00, 0xBD,
+    0x2C, 0x56, 0xDC, 0x00, 0x00,
+    0x2C, 0x6B, 0xF5, 0x00, 0xE7,
+    0x2C, 0x91, 0xAB, 0x00, 0x11,
+    0x2C, 0xB0, 0x5D, 0x01, 0x0C,
+    0x2C, 0xC8, 0x1B, 0x01, 0xA7,
+    0x2C, 0xCF, 0x67, 0x01, 0x77,
+    0x30, 0x05, 0x5C, 0x00, 0x5B,
+    0x30, 0x17, 0xC8, 0x01, 0xD1,
+    0x30, 0x46, 0x9A, 0x01, 0x0C,
+    0x30, 0x83, 0x98, 0x00, 0xA3,
+    0x30, 0x85, 0xA9, 0x00, 0x00,
+    0x30, 0xAE, 0xA4, 0x00, 0xA3,
+    0x30, 0xB5, 0xC2, 0x02, 0x13,
+    0x34, 0x08, 0x04, 0x00, 0x97,
+    0x34, 0x13, 0xE8, 0x00, 0xE1,
+    0x34, 0x17, 0xEB, 0x00, 0x9E,
+    0x34, 0x31, 0xC4, 0x00, 0x11,
+    0x34, 0x56, 0xFE, 0x00, 0x6E,
+    0x34, 0x7E, 0x5C, 0x01, 0xCB,
+    0x34, 0x85, 0x18, 0x00, 0xA3,
+    0x34, 0xCE, 0x00, 0x02, 0x59,
+    0x34, 0xD2, 0x70, 0x00, 0x15,
+    0x38, 0x10, 0xD5, 0x00, 0x11,
+    0x38, 0x2C, 0x4A, 0x00, 0x00,
+    0x38, 0xF7, 0x3D, 0x00, 0x15,
+    0x3C, 0x22, 0xFB, 0x00, 0x29,
+    0x3C, 0x2A, 0xF4, 0x00, 0x5B,
+    0x3C, 0x5A, 0xB4, 0x00, 0xB6,
+    0x3C, 0x61, 0x04, 0x00, 0xE7,
+    0x3C, 0x61, 0x05, 0x00, 0xA3,
+    0x3C, 0x71, 0xBF, 0x00, 0xA3,
+    0x3C, 0xA6, 0x2F, 0x00, 0x11,
+    0x3C, 0xA9, 0xF4, 0x00, 0xE1,
+    0x3C, 0xD9, 0x2B, 0x00, 0xBD,
+    0x3C, 0xEC, 0xEF, 0x01, 0xF5,
+    0x40, 0x16, 0x7E, 0x00, 0x00,
+    0x40, 0x25, 0xC2, 0x00, 0xE1,
+    0x40, 0x4A, 0x03, 0x02, 0x6F,
+    0x40, 0xB4, 0xCD, 0x00, 0x15,
+    0x40, 0xB4, 0xF0, 0x00, 0xE7,
+    0x40, 0xE3, 0xD6, 0x00, 0x37,
+    0x40, 0xF4, 0x07, 0x01, 0x14,
+    0x40, 0xF5, 0x20, 0x00, 0xA3,
+    0x44, 0x4E, 0x6D, 0x00, 0x11,
+    0x44, 0x65, 0x0D, 0x00, 0x15,
+    0x44, 0x94, 0xFC, 0x01, 0x0C,
+    0x44, 0xD9, 0xE7, 0x02, 0x3A,
+    0x44, 0xF4, 0x77, 0x00, 0xE7,
+    0x48, 0x3F, 0xDA, 0x00, 0xA3,
+    0x48, 0x46, 0xFB, 0x00, 0xCD,
+    0x48, 0x51, 0xB7, 0x00, 0xE1,
+    0x48, 0x8F, 0x5A, 0x01, 0xA7,
+    0x48, 0xA6, 0xB8, 0x01, 0xCB,
+    0x4C, 0x5E, 0x0C, 0x01, 0xA7,
+    0x4C, 0x75, 0x25, 0x00, 0xA3,
+    0x50, 0x3E, 0xAA, 0x02, 0x13,
+    0x50, 0x46, 0x5D, 0x00, 0x00,
+    0x50, 0xC7, 0xBF, 0x02, 0x13,
+    0x50, 0xEC, 0x50, 0x02, 0x59,
+    0x50, 0xF5, 0xDA, 0x00, 0x15,
+    0x54, 0x04, 0xA6, 0x00, 0x00,
+    0x54, 0x2A, 0x1B, 0x01, 0xCB,
+    0x54, 0x60, 0x09, 0x00, 0xB6,
+    0x54, 0x89, 0x98, 0x00, 0xCD,
+    0x54, 0xE0, 0x32, 0x00, 0xE7,
+    0x54, 0xE6, 0xFC, 0x02, 0x13,
+    0x58, 0xBD, 0xA3, 0x01, 0x14,
+    0x5C, 0x0A, 0x5B, 0x01, 0xB7,
+    0x5C, 0x26, 0x0A, 0x00, 0x9E,
+    0x5C, 0x45, 0x27, 0x00, 0xE7,
+    0x5C, 0x49, 0x79, 0x00, 0x11,
+    0x5C, 0xAA, 0xFD, 0x01, 0xCB,
+    0x5C, 0xCF, 0x7F, 0x00, 0xA3,
+    0x5C, 0xD9, 0x98, 0x00, 0x97,
+    0x5C, 0xE0, 0xC5, 0x00, 0xE1,
+    0x5C, 0xF4, 0xAB, 0x02, 0x6F,
+    0x60, 0x01, 0x94, 0x00, 0xA3,
+    0x60, 0x45, 0xCB, 0x00, 0x00,
+    0x60, 0x67, 0x20, 0x00, 0xE1,
+    0x60, 0xE3, 0x27, 0x02, 0x13,
+    0x64, 0x09, 0x80, 0x02, 0x59,
+    0x64, 0x16, 0x66, 0x01, 0x02,
+    0x64, 0x70, 0x02, 0x02, 0x13,
+    0x64, 0x87, 0x88, 0x00, 0xE7,
+    0x64, 0xB4, 0x73, 0x02, 0x59,
+    0x64, 0xD1, 0x54, 0x01, 0xA7,
+    0x68, 0x54, 0xFD, 0x00, 0x15,
+    0x68, 0x72, 0x51, 0x02, 0x3A,
+    0x6C, 0x3B, 0x6B, 0x01, 0xA7,
+    0x6C, 0x56, 0x97, 0x00, 0x15,
+    0x6C, 0x5A, 0xB0, 0x02, 0x13,
+    0x6C, 0xB0, 0xCE, 0x01, 0x0C,
+    0x6C, 0xF3, 0x7F, 0x00, 0x37,
+    0x70, 0x3A, 0x0E, 0x00, 0x37,
+    0x70, 0x4C, 0xA5, 0x00, 0xAD,
+    0x70, 0x5A, 0x0F, 0x00, 0xBD,
+    0x70, 0x72, 0x3C, 0x00, 0xCD,
+    0x70, 0x9E, 0x29, 0x01, 0xD6,
+    0x74, 0x44, 0x01, 0x01, 0x0C,
+    0x74, 0x4D, 0x28, 0x01, 0xA7,
+    0x74, 0x75, 0x48, 0x00, 0x15,
+    0x74, 0x83, 0xC2, 0x02, 0x3A,
+    0x74, 0xAC, 0xB9, 0x02, 0x3A,
+    0x74, 0xC2, 0x46, 0x00, 0x15,
+    0x74, 0xD0, 0x2B, 0x00, 0x00,
+    0x78, 0x11, 0xDC, 0x02, 0x59,
+    0x78, 0x19, 0xF7, 0x00, 0xE7,
+    0x78, 0x21, 0x84, 0x00, 0xA3,
+    0x78, 0x28, 0xCA, 0x01, 0xCB,
+    0x78, 0x45, 0x58, 0x02, 0x3A,
+    0x78, 0x54, 0x2E, 0x00, 0x97,
+    0x78, 0x8A, 0x20, 0x02, 0x3A,
+    0x78, 0xBD, 0xBC, 0x01, 0xB7,
+    0x7C, 0x1E, 0x52, 0x00, 0xF8,
+    0x7C, 0x49, 0xEB, 0x02, 0x59,
+    0x7C, 0x7A, 0x91, 0x00, 0xE1,
+    0x7C, 0x9E, 0xBD, 0x00, 0xA3,
+    0x7C, 0xBB, 0x8A, 0x01, 0x14,
+    0x7C, 0xDF, 0xA1, 0x00, 0xA3,
+    0x7C, 0xFF, 0x4D, 0x00, 0x11,
+    0x80, 0x2A, 0xA8, 0x02, 0x3A,
+    0x80, 0xB6, 0x86, 0x00, 0xCD,
+    0x84, 0x16, 0xF9, 0x02, 0x13,
+    0x84, 0x18, 0x88, 0x00, 0xE7,
+    0x84, 0x1B, 0x5E, 0x01, 0x0C,
+    0x84, 0x25, 0xDB, 0x01, 0xB7,
+    0x84, 0x2B, 0x2B, 0x00, 0x9E,
+    0x84, 0xB5, 0x9C, 0x00, 0xE7,
+    0x84, 0xC9, 0xB2, 0x00, 0x97,
+    0x84, 0xCC, 0xA8, 0x00, 0xA3,
+    0x84, 0xD4, 0x7E, 0x00, 0x37,
+    0x84, 0xD6, 0xD0, 0x00, 0x15,
+    0x84, 0xF3, 0xEB, 0x00, 0xA3,
+    0x88, 0x15, 0x44, 0x00, 0x6E,
+    0x88, 0x53, 0xD4, 0x00, 0xCD,
+    0x88, 0xE0, 0xF3, 0x00, 0xE7,
+    0x8C, 0x4B, 0x14, 0x00, 0xA3,
+    0x8C, 0x56, 0xC5, 0x01, 0x14,
+    0x8C, 0x70, 0x5A, 0x00, 0xE1,
+    0x8C, 0x77, 0x12, 0x01, 0xB7,
+    0x8C, 0xAA, 0xB5, 0x00, 0xA3,
+    0x90, 0x6C, 0xAC, 0x00, 0xAD,
+    0x90, 0x94, 0xE4, 0x00, 0x97,
+    0x90, 0xEF, 0x68, 0x02, 0x6F,
+    0x90, 0xF6, 0x52, 0x02, 0x13,
+    0x94, 0x10, 0x3E, 0x00, 0x46,
+    0x94, 0x44, 0x52, 0x00, 0x46,
+    0x94, 0x57, 0xA5, 0x00, 0xBD,
+    0x94, 0x65, 0x9C, 0x00, 0xE1,
+    0x94, 0x9F, 0x3E, 0x01, 0xCB,
+    0x94, 0xB4, 0x0F, 0x00, 0x37,
+    0x94, 0xB9, 0x7E, 0x00, 0xA3,
+    0x94, 0xE6, 0x86, 0x00, 0xA3,
+    0x98, 0x18, 0x88, 0x00, 0x6E,
+    0x98, 0x5F, 0xD3, 0x00, 0xF8,
+    0x98, 0x90, 0x96, 0x00, 0x9E,
+    0x98, 0x9B, 0xCB, 0x00, 0x11,
+    0x98, 0xB6, 0xE9, 0x01, 0x14,
+    0x98, 0xDE, 0xD0, 0x02, 0x13,
+    0x98, 0xF4, 0xAB, 0x00, 0xA3,
+    0x9C, 0x1C, 0x12, 0x00, 0x37,
+    0x9C, 0x8E, 0x99, 0x00, 0xBD,
+    0x9C, 0x99, 0xA0, 0x02, 0x59,
+    0x9C, 0xC7, 0xA6, 0x00, 0x11,
+    0x9C, 0xCC, 0x83, 0x00, 0xE7,
+    0x9C, 0xD3, 0x6D, 0x01, 0x0C,
+    0x9C, 0xE6, 0x35, 0x01, 0x14,
+    0xA0, 0x02, 0xDC, 0x00, 0x15,
+    0xA0, 0x21, 0xB7, 0x01, 0x0C,
+    0xA0, 0x40, 0xA0, 0x01, 0x0C,
+    0xA0, 0x88, 0xB4, 0x00, 0xE1,
+    0xA0, 0xD3, 0xC1, 0x00, 0xBD,
+    0xA0, 0xF3, 0xC1, 0x02, 0x13,
+    0xA4, 0x4E, 0x31, 0x00, 0xE1,
+    0xA4, 0x5C, 0x27, 0x01, 0x14,
+    0xA4, 0x7B, 0x9D, 0x00, 0xA3,
+    0xA4, 0xCF, 0x12, 0x00, 0xA3,
+    0xA8, 0x48, 0xFA, 0x00, 0xA3,
+    0xA8, 0x61, 0x0A, 0x00, 0x2F,
+    0xA8, 0xD0, 0xE5, 0x00, 0xE7,
+    0xAC, 0x17, 0xC8, 0x00, 0x6E,
+    0xAC, 0x1F, 0x6B, 0x01, 0xF5,
+    0xAC, 0x22, 0x0B, 0x00, 0x00,
+    0xAC, 0x3A, 0x7A, 0x01, 0xA2,
+    0xAC, 0x63, 0xBE, 0x00, 0x15,
+    0xAC, 0x67, 0xB2, 0x00, 0xA3,
+    0xAC, 0xA3, 0x1E, 0x00, 0x37,
+    0xAC, 0xBC, 0x32, 0x00, 0x29,
+    0xAC, 0xE2, 0x15, 0x00, 0xCD,
+    0xAC, 0xF7, 0xF3, 0x02, 0x59,
+    0xB0, 0x4E, 0x26, 0x02, 0x13,
+    0xB0, 0xA7, 0x37, 0x01, 0xA2,
+    0xB0, 0xA8, 0x6E, 0x00, 0xE7,
+    0xB0, 0xB2, 0xDC, 0x02, 0x6F,
+    0xB0, 0xF2, 0x08, 0x00, 0x11,
+    0xB4, 0x6B, 0xFC, 0x00, 0xE1,
+    0xB4, 0x75, 0x0E, 0x00, 0x46,
+    0xB4, 0x7C, 0x9C, 0x00, 0x15,
+    0xB4, 0x99, 0xBA, 0x00, 0xBD,
+    0xB4, 0xE6, 0x2D, 0x00, 0xA3,
+    0xB4, 0xFB, 0xE4, 0x02, 0x3A,
+    0xB8, 0x27, 0xEB, 0x01, 0x5F,
+    0xB8, 0x3E, 0x59, 0x01, 0xA2,
+    0xB8, 0x69, 0xF4, 0x01, 0xA7,
+    0xB8, 0xA3, 0x86, 0x00, 0x97,
+    0xB8, 0xAC, 0x6F, 0x00, 0x9E,
+    0xB8, 0xAE, 0x6E, 0x01, 0x14,
+    0xB8, 0xE9, 0x37, 0x01, 0xCB,
+    0xBC, 0x05, 0x43, 0x00, 0x11,
+    0xBC, 0x14, 0x85, 0x01, 0xB7,
+    0xBC, 0x60, 0xA7, 0x01, 0xD6,
+    0xBC, 0xDD, 0xC2, 0x00, 0xA3,
+    0xBC, 0xEE, 0x7B, 0x00, 0x00,
+    0xC0, 0x25, 0x06, 0x00, 0x11,
+    0xC0, 0x3F, 0x0E, 0x01, 0x0C,
+    0xC0, 0x4A, 0x00, 0x02, 0x13,
+    0xC0, 0x56, 0x27, 0x00, 0x46,
+    0xC0, 0xA0, 0xBB, 0x00, 0x97,
+    0xC4, 0x04, 0x15, 0x01, 0x0C,
+    0xC4, 0x4F, 0x33, 0x00, 0xA3,
+    0xC4, 0x5B, 0xBE, 0x00, 0xA3,
+    0xC4, 0x6E, 0x1F, 0x02, 0x13,
+    0xC4, 0xAD, 0x34, 0x01, 0xA7,
+    0xC8, 0x0E, 0x14, 0x00, 0x11,
+    0xC8, 0x2B, 0x96, 0x00, 0xA3,
+    0xC8, 0x3F, 0x26, 0x00, 0xF8,
+    0xC8, 0xBE, 0x19, 0x00, 0x97,
+    0xCC, 0x07, 0xAB, 0x01, 0xB7,
+    0xCC, 0x2D, 0xE0, 0x01, 0xA7,
+    0xCC, 0x50, 0xE3, 0x00, 0xA3,
+    0xCC, 0x5D, 0x4E, 0x02, 0x6F,
+    0xCC, 0x6D, 0xA0, 0x01, 0xA2,
+    0xCC, 0xB2, 0x55, 0x00, 0x97,
+    0xCC, 0xCE, 0x1E, 0x00, 0x11,
+    0xCC, 0xE1, 0x7F, 0x00, 0xE7,
+    0xCC, 0xFB, 0x65, 0x01, 0x14,
+    0xD0, 0x21, 0xF9, 0x02, 0x3A,
+    0xD4, 0x97, 0x0B, 0x02, 0x59,
+    0xD4, 0xBE, 0xD9, 0x00, 0x9E,
+    0xD4, 0xC9, 0xEF, 0x00, 0xBD,
+    0xD4, 0xCA, 0x6D, 0x01, 0xA7,
+    0xD8, 0x31, 0x34, 0x01, 0xA2,
+    0xD8, 0x3A, 0xDD, 0x01, 0x77,
+    0xD8, 0x50, 0xE6, 0x00, 0x00,
+    0xD8, 0x6B, 0xF7, 0x01, 0x14,
+    0xD8, 0xA0, 0x1D, 0x00, 0xA3,
+    0xD8, 0xC7, 0xC8, 0x00, 0x37,
+    0xDC, 0x2C, 0x6E, 0x01, 0xA7,
+    0xDC, 0x39, 0x6F, 0x00, 0x11,
+    0xDC, 0x3A, 0x5E, 0x01, 0xA2,
+    0xDC, 0x53, 0x60, 0x00, 0xE1,
+    0xDC, 0x68, 0xEB, 0x01, 0x14,
+    0xDC, 0x9F, 0xDB, 0x02, 0x3A,
+    0xDC, 0xA6, 0x32, 0x01, 0x77,
+    0xE0, 0x0C, 0x7F, 0x01, 0x14,
+    0xE0, 0x24, 0x7F, 0x00, 0xCD,
+    0xE0, 0x28, 0x6D, 0x00, 0x11,
+    0xE0, 0x3F, 0x49, 0x00, 0x00,
+    0xE0, 0x46, 0x9A, 0x01, 0x0C,
+    0xE0, 0x55, 0x3D, 0x00, 0x6E,
+    0xE0, 0x5A, 0x1B, 0x00, 0xA3,
+    0xE0, 0x63, 0xDA, 0x02, 0x3A,
+    0xE0, 0x91, 0xF5, 0x01, 0x0C,
+    0xE4, 0x18, 0x6B, 0x02, 0x6F,
+    0xE4, 0x5F, 0x01, 0x01, 0x77,
+    0xE4, 0x8D, 0x8C, 0x01, 0xA7,
+    0xE8, 0x1C, 0xBA, 0x00, 0xAD,
+    0xE8, 0x4E, 0xCE, 0x01, 0x14,
+    0xE8, 0x50, 0x8B, 0x01, 0xB7,
+    0xE8, 0x68, 0xE7, 0x00, 0xA3,
+    0xE8, 0xDB, 0x84, 0x00, 0xA3,
+    0xE8, 0xDE, 0x27, 0x02, 0x13,
+    0xE8, 0xDF, 0x70, 0x00, 0x11,
+    0xEC, 0x08, 0x6B, 0x02, 0x13,
+    0xEC, 0x1A, 0x59, 0x00, 0x46,
+    0xEC, 0x3E, 0xF7, 0x00, 0xE7,
+    0xEC, 0xB5, 0xFA, 0x01, 0x2F,
+    0xEC, 0xF4, 0xBB, 0x00, 0x9E,
+    0xEC, 0xFA, 0xBC, 0x00, 0xA3,
+    0xF0, 0x08, 0xD1, 0x00, 0xA3,
+    0xF0, 0x18, 0x98, 0x00, 0x29,
+    0xF0, 0x1C, 0x2D, 0x00, 0xE7,
+    0xF0, 0x25, 0xB7, 0x01, 0xB7,
+    0xF0, 0x27, 0x2D, 0x00, 0x15,
+    0xF0, 0x4D, 0xA2, 0x00, 0x9E,
+    0xF0, 0x5C, 0x19, 0x00, 0x37,
+    0xF0, 0x7D, 0x68, 0x00, 0x97,
+    0xF0, 0x9F, 0xC2, 0x02, 0x3A,
+    0xF0, 0xB0, 0x14, 0x00, 0x11,
+    0xF0, 0xB4, 0x29, 0x02, 0x59,
+    0xF0, 0xD2, 0xF1, 0x00, 0x15,
+    0xF4, 0x6D, 0x04, 0x00, 0x00,
+    0xF4, 0xA7, 0x39, 0x00, 0xE7,
+    0xF4, 0xC7, 0x14, 0x00, 0xCD,
+    0xF4, 0xCE, 0x46, 0x00, 0xBD,
+    0xF4, 0xF2, 0x6D, 0x02, 0x13,
+    0xF4, 0xF5, 0xD8, 0x00, 0xB6,
+    0xF4, 0xF5, 0xE8, 0x00, 0xB6,
+    0xF8, 0x16, 0x54, 0x00, 0xE1,
+    0xF8, 0x32, 0xE4, 0x00, 0x00,
+    0xF8, 0x8F, 0xCA, 0x00, 0xB6,
+    0xF8, 0xA4, 0x5F, 0x02, 0x59,
+    0xF8, 0xB1, 0x56, 0x00, 0x9E,
+    0xF8, 0xC0, 0x01, 0x00, 0xE7,
+    0xFC, 0x0F, 0xE6, 0x01, 0xD6,
+    0xFC, 0x65, 0xDE, 0x00, 0x15,
+    0xFC, 0x75, 0x16, 0x00, 0x97,
+    0xFC, 0xA1, 0x83, 0x00, 0x15,
+    0xFC, 0xEC, 0xDA, 0x02, 0x3A,
+    0xFC, 0xF5, 0x28, 0x02, 0x6F,
+    0xFC, 0xF5, 0xC4, 0x00, 0xA3,
+};
+
+// 28-bit prefixes, sorted; 4 key bytes + offset per record
+static constexpr size_t OUI_MAM_COUNT = 0;
+static constexpr uint8_t OUI_MAM_RECORDS[1] = {0};
+
+// 36-bit prefixes, sorted; 5 key bytes + offset per record
+static constexpr size_t OUI_MAS_COUNT = 0;
+static constexpr uint8_t OUI_MAS_RECORDS[1] = {0};
+
+#endif // OUI_TABLE_H
@@ -0,0 +1,166 @@
+// Generated by scripts/gen_service_probes.py from tables/service_probes.txt - do not edit
+#ifndef SERVICE_PROBES_TABLE_H
+#define SERVICE_PROBES_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "banner_signature_ids.h"
+
+enum ServicePatternOp : uint8_t
+{
+    PAT_END = 0,
+    PAT_LIT = 1,   // followed by length and bytes
+    PAT_ANY = 2,
+    PAT_ONE = 3,
+    PAT_CAPTURE = 4
+};
+
+static constexpr uint8_t PROBE_HTTP = 0x01;
+static constexpr uint8_t PROBE_TLS = 0x02;
+static constexpr uint8_t MATCH_ANCHORED = 0x01;
+static constexpr uint8_t MATCH_NOCASE = 0x02;
+
+struct ServiceProbeDef
+{
+    uint16_t payload;     // Pool offset
+    uint8_t payloadLen;
+    uint8_t flags;
+    uint16_t firstPort;   // Index into SERVICE_PROBE_PORTS
+    uint8_t portCount;
+    uint16_t firstMatch;  // Index into SERVICE_MATCHES
+    uint8_t matchCount;
+};
+
+struct ServiceMatchDef
+{
+    uint16_t service;     // Pool offset, NUL-terminated
+    uint16_t pattern;     // Pool offset of the bytecode
+    uint8_t flags;
+    uint8_t signature;    // Banner signature that must hit before the pattern runs
+};
+
+struct ServicePortName
+{
+    uint16_t port;
+    uint16_t service;     // Pool offset, NUL-terminated
+};
+
+// Payloads, pattern bytecode and service names
+static constexpr uint8_t SERVICE_PROBE_POOL[] = {
+    0x53, 0x53, 0x48, 0x00, 0x01, 0x04, 0x53, 0x53, 0x48, 0x2d, 0x02, 0x01, 0x01, 0x2d, 0x04, 0x00,
+    0x46, 0x54, 0x50, 0x00, 0x01, 0x0c, 0x32, 0x32, 0x30, 0x20, 0x28, 0x76, 0x73, 0x46, 0x54, 0x50,
+    0x64, 0x20, 0x04, 0x01, 0x01, 0x29, 0x00, 0x01, 0x0c, 0x32, 0x32, 0x30, 0x20, 0x50, 0x72, 0x6f,
+    0x46, 0x54, 0x50, 0x44, 0x20, 0x04, 0x01, 0x07, 0x20, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x00,
+    0x01, 0x03, 0x32, 0x32, 0x30, 0x02, 0x01, 0x11, 0x46, 0x69, 0x6c, 0x65, 0x5a, 0x69, 0x6c, 0x6c,
+    0x61, 0x20, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x04, 0x00, 0x01, 0x03, 0x32, 0x32, 0x30,
+    0x02, 0x01, 0x09, 0x50, 0x75, 0x72, 0x65, 0x2d, 0x46, 0x54, 0x50, 0x64, 0x00, 0x01, 0x03, 0x32,
+    0x32, 0x30, 0x02, 0x01, 0x03, 0x46, 0x54, 0x50, 0x00, 0x53, 0x4d, 0x54, 0x50, 0x00, 0x01, 0x04,
+    0x32, 0x32, 0x30, 0x20, 0x02, 0x01, 0x07, 0x20, 0x45, 0x53, 0x4d, 0x54, 0x50, 0x20, 0x04, 0x00,
+    0x01, 0x03, 0x32, 0x32, 0x30, 0x02, 0x01, 0x04, 0x53, 0x4d, 0x54, 0x50, 0x00, 0x50, 0x4f, 0x50,
+    0x33, 0x00, 0x01, 0x03, 0x2b, 0x4f, 0x4b, 0x02, 0x01, 0x04, 0x50, 0x4f, 0x50, 0x33, 0x00, 0x01,
+    0x0b, 0x2b, 0x4f, 0x4b, 0x20, 0x44, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x74, 0x00, 0x49, 0x4d, 0x41,
+    0x50, 0x00, 0x01, 0x04, 0x2a, 0x20, 0x4f, 0x4b, 0x02, 0x01, 0x04, 0x49, 0x4d, 0x41, 0x50, 0x00,
+    0x4d, 0x79, 0x53, 0x51, 0x4c, 0x00, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x01,
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xff, 0x02, 0x01, 0x05, 0x4d, 0x79, 0x53, 0x51,
+    0x4c, 0x00, 0x56, 0x4e, 0x43, 0x00, 0x01, 0x04, 0x52, 0x46, 0x42, 0x20, 0x04, 0x01, 0x01, 0x0a,
+    0x00, 0x54, 0x65, 0x6c, 0x6e, 0x65, 0x74, 0x00, 0x01, 0x01, 0xff, 0x00, 0x47, 0x45, 0x54, 0x20,
+    0x2f, 0x20, 0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x0d, 0x0a, 0x48, 0x6f, 0x73, 0x74,
+    0x3a, 0x20, 0x7b, 0x68, 0x6f, 0x73, 0x74, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x48, 0x54, 0x54, 0x50,
+    0x00, 0x01, 0x07, 0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x03, 0x02, 0x01, 0x09, 0x0a, 0x53,
+    0x65, 0x72, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x04, 0x01, 0x01, 0x0d, 0x00, 0x01, 0x07, 0x48, 0x54,
+    0x54, 0x50, 0x2f, 0x31, 0x2e, 0x03, 0x00, 0x50, 0x49, 0x4e, 0x47, 0x0d, 0x0a, 0x52, 0x65, 0x64,
+    0x69, 0x73, 0x00, 0x01, 0x05, 0x2b, 0x50, 0x4f, 0x4e, 0x47, 0x00, 0x01, 0x07, 0x2d, 0x4e, 0x4f,
+    0x41, 0x55, 0x54, 0x48, 0x00, 0x01, 0x07, 0x2d, 0x44, 0x45, 0x4e, 0x49, 0x45, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x04, 0xd2, 0x16, 0x2f, 0x50, 0x6f, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51,
+    0x4c, 0x00, 0x01, 0x01, 0x53, 0x00, 0x01, 0x01, 0x4e, 0x00, 0x03, 0x00, 0x00, 0x13, 0x0e, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x52, 0x44, 0x50,
+    0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x16, 0x03, 0x01, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x78,
+    0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+    0x1e, 0x1f, 0x00, 0x00, 0x1e, 0xc0, 0x2f, 0xc0, 0x30, 0xc0, 0x2b, 0xc0, 0x2c, 0xcc, 0xa8, 0xcc,
+    0xa9, 0xc0, 0x13, 0xc0, 0x14, 0xc0, 0x09, 0xc0, 0x0a, 0x00, 0x9c, 0x00, 0x9d, 0x00, 0x2f, 0x00,
+    0x35, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x06, 0x00, 0x1d, 0x00,
+    0x17, 0x00, 0x18, 0x00, 0x0b, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x14, 0x04,
+    0x03, 0x05, 0x03, 0x06, 0x03, 0x08, 0x04, 0x08, 0x05, 0x08, 0x06, 0x04, 0x01, 0x05, 0x01, 0x06,
+    0x01, 0x02, 0x01, 0xff, 0x01, 0x00, 0x01, 0x00, 0x10, 0x0e, 0x00, 0x04, 0x4d, 0x51, 0x54, 0x54,
+    0x04, 0x02, 0x00, 0x3c, 0x00, 0x02, 0x6e, 0x73, 0x4d, 0x51, 0x54, 0x54, 0x00, 0x01, 0x02, 0x20,
+    0x02, 0x00, 0x44, 0x4e, 0x53, 0x00, 0x48, 0x54, 0x54, 0x50, 0x53, 0x00, 0x53, 0x4d, 0x42, 0x00,
+    0x53, 0x4d, 0x54, 0x50, 0x53, 0x00, 0x4c, 0x44, 0x41, 0x50, 0x53, 0x00, 0x49, 0x4d, 0x41, 0x50,
+    0x53, 0x00, 0x50, 0x4f, 0x50, 0x33, 0x53, 0x00, 0x48, 0x54, 0x54, 0x50, 0x20, 0x50, 0x72, 0x6f,
+    0x78, 0x79, 0x00,
+};
+
+static constexpr uint16_t SERVICE_PROBE_PORTS[] = {
+    80, 81, 3000, 5000, 8000, 8008, 8080, 8081, 8888, 9000, 6379, 5432,
+    3389, 443, 465, 636, 993, 995, 8443, 1883,
+};
+
+// Entry 0 is the NULL probe (no payload), used for ports no other probe lists
+static constexpr ServiceProbeDef SERVICE_PROBES[] = {
+    {0, 0, 0x00, 0, 0, 0, 15}, // NULL
+    {268, 32, 0x01, 0, 10, 15, 2}, // GetRequest
+    {343, 6, 0x00, 10, 1, 17, 3}, // RedisPing
+    {383, 8, 0x00, 11, 1, 20, 2}, // PostgresSSL
+    {410, 19, 0x00, 12, 1, 22, 1}, // RdpConnect
+    {439, 129, 0x02, 13, 6, 23, 0}, // TLSClientHello
+    {568, 16, 0x00, 19, 1, 23, 1}, // MqttConnect
+};
+
+static constexpr ServiceMatchDef SERVICE_MATCHES[] = {
+    {0, 4, 0x01, SIG_SERVICE_0},
+    {16, 20, 0x01, SIG_SERVICE_1},
+    {16, 39, 0x01, SIG_SERVICE_2},
+    {16, 64, 0x01, SIG_SERVICE_3},
+    {16, 91, 0x01, SIG_SERVICE_4},
+    {16, 109, 0x03, SIG_SERVICE_5},
+    {121, 126, 0x01, SIG_SERVICE_6},
+    {121, 144, 0x03, SIG_SERVICE_7},
+    {157, 162, 0x03, SIG_SERVICE_8},
+    {157, 175, 0x01, SIG_SERVICE_9},
+    {189, 194, 0x03, SIG_SERVICE_10},
+    {208, 214, 0x01, SIG_SERVICE_11},
+    {208, 226, 0x01, SIG_SERVICE_12},
+    {242, 246, 0x01, SIG_SERVICE_13},
+    {257, 264, 0x01, SIG_SERVICE_14},
+    {300, 305, 0x03, SIG_SERVICE_15},
+    {300, 332, 0x01, SIG_SERVICE_16},
+    {349, 355, 0x01, SIG_SERVICE_17},
+    {349, 363, 0x01, SIG_SERVICE_18},
+    {349, 373, 0x01, SIG_SERVICE_19},
+    {391, 402, 0x01, SIG_SERVICE_20},
+    {391, 406, 0x01, SIG_SERVICE_21},
+    {429, 433, 0x01, SIG_SERVICE_22},
+    {584, 589, 0x01, SIG_SERVICE_23},
+};
+
+// Sorted by port
+static constexpr ServicePortName SERVICE_PORT_NAMES[] = {
+    {21, 16},
+    {22, 0},
+    {23, 257},
+    {25, 121},
+    {53, 594},
+    {80, 300},
+    {110, 157},
+    {143, 189},
+    {443, 598},
+    {445, 604},
+    {465, 608},
+    {636, 614},
+    {993, 620},
+    {995, 626},
+    {1883, 584},
+    {3306, 208},
+    {3389, 429},
+    {5432, 391},
+    {5900, 242},
+    {6379, 349},
+    {8080, 632},
+    {8443, 598},
+};
+
+static constexpr size_t SERVICE_PROBE_COUNT = 7;
+static constexpr size_t SERVICE_MATCH_COUNT = 24;
+static constexpr size_t SERVICE_PORT_NAME_COUNT = 22;
+
+#endif // SERVICE_PROBES_TABLE_H
@@ -0,0 +1,387 @@
+// ============================================================================
+// NetStick Host Driver - Entry point for env:native
+// ============================================================================
+// Runs the scanner core on a Linux build host through the native HAL
+// (lib/native_hal) for profiling and benchmarking. Raw-socket features (SYN
+// discovery, ICMP unreachables) need CAP_NET_RAW and fall back without it.
+//
+//   netstick hosts [range]                  Host sweep of the local subnet (or
+//                                           a CIDR/range; ARP keeps to the link)
+//   netstick delta [range]                  ARP sweep compared with the stored
+//                                           inventory (NETSTICK_FS_ROOT)
+//   netstick listen <seconds> [range]       Passive discovery, then a sweep
+//                                           of what was not heard
+//   netstick ports <ip> [start] [end]       TCP port scan
+//   netstick top <ip> [count]               Top-N ports in rank order
+//   netstick analyze <ip> [start] [end]     Port scan + vulnerability checks
+//   netstick command '<json>'               Feed a BLE command to the parser
+//
+// Options (before the command): -q silences scanner logs, -s uses SYN
+// discovery, -v enables service/version probes, -r <pps> caps the rate,
+// -m arp|icmp|both picks the host discovery method, -n resolves the names
+// of the hosts found (reverse DNS, mDNS, NetBIOS).
+//
+// LEGAL USE ONLY: scan only networks you are authorized to test.
+// ============================================================================
+
+#include <Arduino.h>
+#include <vector>
+#include "native_hal.h"
+#include "config.h"
+#include "bluetooth_handler.h"
+#include "device_inventory.h"
+#include "name_resolver.h"
+#include "network_scanner.h"
+#include "passive_listener.h"
+#include "port_scanner.h"
+#include "vulnerability_db.h"
+
+// pio test links the test's own main() and none of this driver
+#ifndef PIO_UNIT_TESTING
+
+struct HostOptions
+{
+    bool synScan = false;
+    bool serviceVersion = false;
+    uint32_t rate = 0;
+    DiscoveryMethod method = DiscoveryMethod::ARP;
+    bool resolveNames = false;
+};
+
+static HostOptions options;
+
+// ============================================================================
+// Result printers
+// ============================================================================
+
+static void printDevice(const NetworkDevice &device)
+{
+    char rtt[16] = "";
+    if (device.rttMs >= 0)
+        snprintf(rtt, sizeof(rtt), " %dms", device.rttMs);
+    printf("host  %-15s %-17s %s%s%s%s\n", device.ip.toString().c_str(),
+           device.hasMac ? device.macStr : "-", device.vendor,
+           device.hostname[0] ? " " : "", device.hostname, rtt);
+}
+
+static void printInventoryEvent(const InventoryEvent &event)
+{
+    static const char *TYPES[] = {"joined", "left", "moved"};
+    char mac[18];
+    snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+             event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4], event.mac[5]);
+    printf("%-7s%-15s %s %s", TYPES[(int)event.change], fromHostOrder(event.ip).toString().c_str(),
+           mac, lookupVendor(event.mac));
+    if (event.change == InventoryChange::CHANGED_IP)
+        printf(" (was %s)", fromHostOrder(event.oldIp).toString().c_str());
+    printf("\n");
+}
+
+static void printName(uint32_t ip, const char *name, NameSource source)
+{
+    printf("name  %-15s %s (%s)\n", fromHostOrder(ip).toString().c_str(), name,
+           NameResolver::sourceName(source));
+}
+
+static void printPort(const PortResult &result)
+{
+    printf("open  %5u/tcp %-12s %s%s%s\n", result.port, result.service,
+           result.version, result.version[0] ? " " : "", result.banner);
+}
+
+static void printVuln(const Vulnerability &vuln, uint16_t port)
+{
+    printf("vuln  %5u sev=%d %s: %s\n", port, vuln.severity, vuln.cve, vuln.description);
+}
+
+static void printBleNotify(const uint8_t *data, size_t length)
+{
+    printf("tx    %.*s\n", (int)length, (const char *)data);
+}
+
+static void printTiming(const char *what, unsigned long elapsedMs, int probes)
+{
+    double seconds = elapsedMs / 1000.0;
+    printf("done  %s: %d probes in %lu ms (%.1f probes/s)\n",
+           what, probes, elapsedMs, seconds > 0 ? probes / seconds : 0.0);
+}
+
+// ============================================================================
+// Commands
+// ============================================================================
+
+static int runHosts(const char *target)
+{
+    HostRange range;
+    if (target && !parseHostRange(target, range))
+    {
+        fprintf(stderr, "Bad range %s (CIDR, a.b.c.d-e.f.g.h, a.b.c.d-N or an IP)\n", target);
+        return 2;
+    }
+
+    networkScanner.init();
+    networkScanner.setMethod(options.method);
+    unsigned long start = millis();
+    int found = target ? networkScanner.scanRange(range, printDevice)
+                       : networkScanner.scanNetwork(printDevice);
+    if (found < 0)
+    {
+        fprintf(stderr, "No IPv4 interface (set NETSTICK_IFACE), range not on it or no raw socket\n");
+        return 1;
+    }
+    printTiming("hosts", millis() - start, networkScanner.getSweepSize());
+    printf("found %d hosts\n", found);
+
+    if (options.resolveNames && found > 0)
+    {
+        std::vector<uint32_t> ips;
+        for (int i = 0; i < found; i++)
+            ips.push_back(toHostOrder(networkScanner.getDevice(i).ip));
+        start = millis();
+        int named = nameResolver.resolve(ips.data(), (int)ips.size(), printName);
+        printf("done  names: %d of %d hosts named in %lu ms\n", named, found, millis() - start);
+    }
+    return 0;
+}
+
+static int runDelta(const char *target)
+{
+    HostRange local = networkScanner.getLocalRange();
+    HostRange range = local;
+    if (target && !parseHostRange(target, range))
+    {
+        fprintf(stderr, "Bad range %s (CIDR, a.b.c.d-e.f.g.h, a.b.c.d-N or an IP)\n", target);
+        return 2;
+    }
+    range = range.intersect(local);
+
+    deviceInventory.begin();
+    if (range.isEmpty() || !deviceInventory.select(WiFi.SSID().c_str(), local))
+    {
+        fprintf(stderr, "No IPv4 interface (set NETSTICK_IFACE) or range not on it\n");
+        return 1;
+    }
+
+    int knownCount = 0;
+    const uint32_t *known = deviceInventory.knownAddresses(range, knownCount);
+    networkScanner.init();
+    networkScanner.setKnownHosts(known, knownCount);
+    unsigned long start = millis();
+    int found = networkScanner.scanRange(range);
+    if (found < 0)
+    {
+        fprintf(stderr, "Sweep failed\n");
+        return 1;
+    }
+    printTiming("delta", millis() - start, networkScanner.getSweepSize());
+
+    InventorySummary summary = deviceInventory.apply(networkScanner, range, printInventoryEvent);
+    deviceInventory.save();
+    printf("delta seen=%d joined=%d left=%d moved=%d known=%d (%d probed first)\n",
+           summary.seen, summary.joined, summary.left, summary.changedIp,
+           deviceInventory.getCount(), knownCount);
+    return 0;
+}
+
+static const char *passiveSourceName(uint8_t source)
+{
+    switch (source)
+    {
+    case PASSIVE_MDNS:
+        return "mdns";
+    case PASSIVE_NBNS:
+        return "nbns";
+    case PASSIVE_DHCP:
+        return "dhcp";
+    default:
+        return "-";
+    }
+}
+
+static int runListen(unsigned long seconds, const char *target)
+{
+    if (!passiveListener.begin())
+    {
+        fprintf(stderr, "Cannot listen (no IPv4 interface or no free ports)\n");
+        return 1;
+    }
+    unsigned long start = millis();
+    while (millis() - start < seconds * 1000)
+    {
+        passiveListener.poll();
+        delay(10);
+    }
+    passiveListener.stop();
+
+    for (int i = 0; i < passiveListener.getHostCount(); i++)
+    {
+        const PassiveHost *host = passiveListener.getHost(i);
+        printf("heard %-15s sources=%02x name=%s (%s)%s\n",
+               fromHostOrder(host->ip).toString().c_str(), host->sources,
+               host->name[0] ? host->name : "-", passiveSourceName(host->nameSource),
+               host->hasMac ? "" : " no mac");
+    }
+    printf("heard %d hosts in %lu s\n", passiveListener.getHostCount(), seconds);
+    return runHosts(target);
+}
+
+static void preparePortScan()
+{
+    portScanner.init();
+    portScanner.setScanMode(options.synScan ? ScanMode::SYN : ScanMode::CONNECT);
+    portScanner.setRateCeiling(options.rate);
+}
+
+static void printPortSummary()
+{
+    const RttEstimator &rtt = portScanner.getRtt();
+    printf("ports open=%d closed=%d filtered=%d connects=%d saved=%d\n",
+           portScanner.getOpenPortCount(), portScanner.getClosedPortCount(),
+           portScanner.getFilteredPortCount(), portScanner.getConnectsMade(),
+           portScanner.getConnectsSaved());
+    printf("rtt   srtt=%lu rttvar=%lu min=%lu max=%lu samples=%u\n",
+           (unsigned long)rtt.getSmoothedRtt(), (unsigned long)rtt.getRttVariance(),
+           (unsigned long)rtt.getMinRtt(), (unsigned long)rtt.getMaxRtt(),
+           rtt.getSampleCount());
+}
+
+static int runPorts(const char *target, uint16_t startPort, uint16_t endPort, bool analyze)
+{
+    preparePortScan();
+    unsigned long start = millis();
+    if (portScanner.scanPorts(target, startPort, endPort, printPort, nullptr,
+                              false, options.serviceVersion || analyze) < 0)
+    {
+        fprintf(stderr, "Scan failed for %s\n", target);
+        return 1;
+    }
+    printTiming("ports", millis() - start, endPort - startPort + 1);
+    printPortSummary();
+
+    if (analyze)
+    {
+        vulnDB.init();
+        int count = vulnDB.analyzeAllPorts(portScanner, printVuln);
+        printf("vulns %d (max severity %d)\n", count, vulnDB.getMaxSeverity());
+    }
+    return 0;
+}
+
+static int runTop(const char *target, int count)
+{
+    preparePortScan();
+    count = clampTopPortCount(count);
+    unsigned long start = millis();
+    if (portScanner.scanTopPorts(target, count, printPort, nullptr,
+                                 false, options.serviceVersion) < 0)
+    {
+        fprintf(stderr, "Scan failed for %s\n", target);
+        return 1;
+    }
+    printTiming("top", millis() - start, count);
+    printPortSummary();
+    return 0;
+}
+
+static int runCommand(const char *json)
+{
+    hal::setBleNotifySink(printBleNotify);
+    bleHandler.init();
+    hal::bleConnect();
+
+    bleHandler.onDataReceived(json, strlen(json));
+    if (!bleHandler.hasCommand())
+    {
+        return 1;
+    }
+
+    CommandData cmd = bleHandler.getCommand();
+    bleHandler.clearCommand();
+    printf("cmd   id=%d target=%s ports=%u-%u top=%u syn=%d os=%d sv=%d rate=%u udp=%u range=%u method=%d names=%d\n",
+           (int)cmd.cmd, cmd.targetIP, cmd.portStart, cmd.portEnd, cmd.topPorts,
+           cmd.synScan, cmd.osDetect, cmd.serviceVersion, cmd.rate, cmd.udpPortCount,
+           (unsigned)cmd.netRange.size(), (int)cmd.netMethod, cmd.resolveNames);
+    return 0;
+}
+
+static int usage()
+{
+    fprintf(stderr,
+            "usage: netstick [-q] [-s] [-v] [-n] [-r pps] [-m arp|icmp|both] <command>\n"
+            "  hosts [cidr|range]\n"
+            "  delta [cidr|range]\n"
+            "  listen <seconds> [cidr|range]\n"
+            "  ports <ip> [start] [end]\n"
+            "  top <ip> [count]\n"
+            "  analyze <ip> [start] [end]\n"
+            "  command '<json>'\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; arg++)
+    {
+        if (strcmp(argv[arg], "-q") == 0)
+            hal::setSerialEnabled(false);
+        else if (strcmp(argv[arg], "-s") == 0)
+            options.synScan = true;
+        else if (strcmp(argv[arg], "-v") == 0)
+            options.serviceVersion = true;
+        else if (strcmp(argv[arg], "-n") == 0)
+            options.resolveNames = true;
+        else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+            options.rate = strtoul(argv[++arg], nullptr, 10);
+        else if (strcmp(argv[arg], "-m") == 0 && arg + 1 < argc)
+        {
+            const char *method = argv[++arg];
+            if (strcmp(method, "arp") == 0)
+                options.method = DiscoveryMethod::ARP;
+            else if (strcmp(method, "icmp") == 0)
+                options.method = DiscoveryMethod::ICMP;
+            else if (strcmp(method, "both") == 0)
+                options.method = DiscoveryMethod::BOTH;
+            else
+                return usage();
+        }
+        else
+            return usage();
+    }
+    if (arg >= argc)
+        return usage();
+
+    const char *command = argv[arg++];
+    int remaining = argc - arg;
+    char **args = argv + arg;
+
+    if (strcmp(command, "hosts") == 0)
+        return runHosts(remaining >= 1 ? args[0] : nullptr);
+
+    if (strcmp(command, "delta") == 0)
+        return runDelta(remaining >= 1 ? args[0] : nullptr);
+
+    if (strcmp(command, "command") == 0 && remaining >= 1)
+        return runCommand(args[0]);
+
+    if (remaining < 1)
+        return usage();
+
+    if (strcmp(command, "listen") == 0)
+        return runListen(strtoul(args[0], nullptr, 10), remaining >= 2 ? args[1] : nullptr);
+
+    if (strcmp(command, "top") == 0)
+        return runTop(args[0], remaining >= 2 ? atoi(args[1]) : 100);
+
+    if (strcmp(command, "ports") == 0 || strcmp(command, "analyze") == 0)
+    {
+        uint16_t startPort = remaining >= 2 ? (uint16_t)atoi(args[1]) : DEFAULT_PORT_RANGE_START;
+        uint16_t endPort = remaining >= 3 ? (uint16_t)atoi(args[2]) : DEFAULT_PORT_RANGE_END;
+        if (startPort == 0 || endPort < startPort)
+            return usage();
+        return runPorts(args[0], startPort, endPort, strcmp(command, "analyze") == 0);
+    }
+
+    return usage();
+}
+#endif // PIO_UNIT_TESTING
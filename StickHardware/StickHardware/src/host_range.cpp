@@ -0,0 +1,179 @@
+#include "host_range.h"
+#include <stdlib.h>
+
+// ============================================================================
+// Host Range - Implementation
+// ============================================================================
+
+HostRange HostRange::intersect(const HostRange &other) const
+{
+    HostRange result;
+    if (isEmpty() || other.isEmpty())
+    {
+        return result;
+    }
+    result.first = first > other.first ? first : other.first;
+    result.last = last < other.last ? last : other.last;
+    return result;
+}
+
+uint32_t toHostOrder(const IPAddress &ip)
+{
+    return ((uint32_t)ip[0] << 24) | ((uint32_t)ip[1] << 16) | ((uint32_t)ip[2] << 8) | ip[3];
+}
+
+IPAddress fromHostOrder(uint32_t ip)
+{
+    return IPAddress((uint8_t)(ip >> 24), (uint8_t)(ip >> 16), (uint8_t)(ip >> 8), (uint8_t)ip);
+}
+
+// Network and broadcast addresses are not hosts, except on /31 and /32
+static HostRange prefixHostRange(uint32_t address, uint32_t mask)
+{
+    HostRange range;
+    range.first = address & mask;
+    range.last = range.first | ~mask;
+    if (range.last - range.first >= 3)
+    {
+        range.first++;
+        range.last--;
+    }
+    return range;
+}
+
+HostRange subnetHostRange(const IPAddress &ip, const IPAddress &mask)
+{
+    return prefixHostRange(toHostOrder(ip), toHostOrder(mask));
+}
+
+// Dotted quad; *end is set past the last digit consumed
+static bool parseAddress(const char *text, uint32_t &out, const char **end)
+{
+    uint32_t value = 0;
+    const char *p = text;
+    for (int octet = 0; octet < 4; octet++)
+    {
+        if (octet > 0)
+        {
+            if (*p != '.')
+            {
+                return false;
+            }
+            p++;
+        }
+        if (*p < '0' || *p > '9')
+        {
+            return false;
+        }
+        char *stop;
+        unsigned long part = strtoul(p, &stop, 10);
+        if (part > 255 || stop - p > 3)
+        {
+            return false;
+        }
+        value = (value << 8) | (uint32_t)part;
+        p = stop;
+    }
+    out = value;
+    *end = p;
+    return true;
+}
+
+bool parseHostRange(const char *spec, HostRange &out)
+{
+    if (!spec)
+    {
+        return false;
+    }
+
+    uint32_t first;
+    const char *p;
+    if (!parseAddress(spec, first, &p))
+    {
+        return false;
+    }
+
+    HostRange range;
+    if (*p == '\0')
+    {
+        range.first = first;
+        range.last = first;
+    }
+    else if (*p == '/')
+    {
+        char *stop;
+        unsigned long prefix = strtoul(p + 1, &stop, 10);
+        if (stop == p + 1 || *stop != '\0' || prefix > 32)
+        {
+            return false;
+        }
+        uint32_t mask = prefix == 0 ? 0 : 0xFFFFFFFFu << (32 - prefix);
+        range = prefixHostRange(first, mask);
+    }
+    else if (*p == '-')
+    {
+        uint32_t last;
+        const char *tail;
+        if (parseAddress(p + 1, last, &tail))
+        {
+            if (*tail != '\0')
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // Last-octet shorthand: 192.168.1.10-50
+            char *stop;
+            unsigned long octet = strtoul(p + 1, &stop, 10);
+            if (stop == p + 1 || *stop != '\0' || octet > 255)
+            {
+                return false;
+            }
+            last = (first & 0xFFFFFF00u) | (uint32_t)octet;
+        }
+        range.first = first;
+        range.last = last;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (range.isEmpty() || range.last - range.first >= NETWORK_SCAN_MAX_HOSTS)
+    {
+        return false;
+    }
+    out = range;
+    return true;
+}
+
+void HostIterator::begin(const HostRange &range, uint32_t skipAddress)
+{
+    cursor = range.first;
+    last = range.last;
+    skip = skipAddress;
+    exhausted = range.isEmpty();
+}
+
+bool HostIterator::next(uint32_t &ip)
+{
+    while (!exhausted)
+    {
+        uint32_t current = cursor;
+        if (current == last)
+        {
+            exhausted = true; // also stops at 255.255.255.255 without wrapping
+        }
+        else
+        {
+            cursor++;
+        }
+        if (current != skip)
+        {
+            ip = current;
+            return true;
+        }
+    }
+    return false;
+}
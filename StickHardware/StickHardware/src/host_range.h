@@ -0,0 +1,58 @@
+#ifndef HOST_RANGE_H
+#define HOST_RANGE_H
+
+#include <WiFi.h>
+#include "config.h"
+
+// ============================================================================
+// Host Range - Inclusive IPv4 address ranges for network sweeps
+// ============================================================================
+// Addresses are kept in host byte order so a range can be walked with ++.
+// Accepted target strings:
+//
+//   192.168.1.0/24             CIDR (network and broadcast excluded up to /30)
+//   192.168.1.10-192.168.1.50  explicit range
+//   192.168.1.10-50            last-octet shorthand
+//   192.168.1.7                single address
+//
+// Ranges larger than NETWORK_SCAN_MAX_HOSTS are rejected.
+// ============================================================================
+
+struct HostRange
+{
+    uint32_t first = 1;
+    uint32_t last = 0; // first > last: empty
+
+    bool isEmpty() const { return first > last; }
+    uint32_t size() const { return isEmpty() ? 0 : last - first + 1; }
+    bool contains(uint32_t ip) const { return ip >= first && ip <= last; }
+
+    // Overlap with another range (empty when disjoint)
+    HostRange intersect(const HostRange &other) const;
+};
+
+uint32_t toHostOrder(const IPAddress &ip);
+IPAddress fromHostOrder(uint32_t ip);
+
+// Usable host addresses of the subnet ip/mask
+HostRange subnetHostRange(const IPAddress &ip, const IPAddress &mask);
+
+// Parse one of the target forms above; false on syntax error or oversize
+bool parseHostRange(const char *spec, HostRange &out);
+
+// Streams the addresses of a range, skipping one (our own) address
+class HostIterator
+{
+public:
+    void begin(const HostRange &range, uint32_t skipAddress = 0);
+    bool next(uint32_t &ip);
+    bool done() const { return exhausted; }
+
+private:
+    uint32_t cursor = 0;
+    uint32_t last = 0;
+    uint32_t skip = 0;
+    bool exhausted = true;
+};
+
+#endif // HOST_RANGE_H
@@ -0,0 +1,195 @@
+#include "icmp_prober.h"
+#include <lwip/sockets.h>
+#include <esp_system.h>
+
+// ============================================================================
+// ICMP Prober - Implementation
+// ============================================================================
+
+static const uint8_t ICMP_ECHO_REPLY = 0;
+static const uint8_t ICMP_ECHO_REQUEST = 8;
+static const size_t ICMP_HEADER_SIZE = 8;
+static const size_t ICMP_PAYLOAD_SIZE = 16;  // Some stacks ignore empty echoes
+
+static uint16_t icmpChecksum(const uint8_t *data, size_t len)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i + 1 < len; i += 2)
+    {
+        sum += (uint32_t)((data[i] << 8) | data[i + 1]);
+    }
+    if (len & 1)
+    {
+        sum += (uint32_t)data[len - 1] << 8;
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return (uint16_t)~sum;
+}
+
+bool IcmpProber::begin()
+{
+    end();
+
+    fd = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+    if (fd < 0)
+    {
+        Serial.println("[IcmpScan] Raw socket unavailable (LWIP_RAW disabled?)");
+        return false;
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    identifier = (uint16_t)esp_random();
+    generation = (uint16_t)esp_random();
+    return true;
+}
+
+void IcmpProber::end()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    for (int i = 0; i < MAX_PENDING; i++)
+    {
+        pending[i].used = false;
+    }
+    pendingUsed = 0;
+    nextFree = 0;
+}
+
+bool IcmpProber::send(uint32_t ip, uint8_t attempt)
+{
+    if (fd < 0 || !hasRoom())
+    {
+        return false;
+    }
+
+    int slot = nextFree;
+    while (pending[slot].used)
+    {
+        slot = (slot + 1) % MAX_PENDING;
+    }
+    uint16_t sequence = (uint16_t)(generation++ * MAX_PENDING + slot);
+
+    uint8_t packet[ICMP_HEADER_SIZE + ICMP_PAYLOAD_SIZE];
+    memset(packet, 0, sizeof(packet));
+    packet[0] = ICMP_ECHO_REQUEST;
+    packet[4] = (uint8_t)(identifier >> 8);
+    packet[5] = (uint8_t)identifier;
+    packet[6] = (uint8_t)(sequence >> 8);
+    packet[7] = (uint8_t)sequence;
+    memcpy(packet + ICMP_HEADER_SIZE, "NetStick echo   ", ICMP_PAYLOAD_SIZE);
+    uint16_t sum = icmpChecksum(packet, sizeof(packet));
+    packet[2] = (uint8_t)(sum >> 8);
+    packet[3] = (uint8_t)sum;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip;
+
+    if (sendto(fd, packet, sizeof(packet), 0, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        return false; // out of pbufs or no route - caller counts the attempt
+    }
+
+    Pending &entry = pending[slot];
+    entry.sentMs = millis();
+    entry.ip = ip;
+    entry.sequence = sequence;
+    entry.attempt = attempt;
+    entry.used = true;
+    pendingUsed++;
+    nextFree = (slot + 1) % MAX_PENDING;
+    return true;
+}
+
+int IcmpProber::receive(IcmpEcho *out, int maxOut, uint32_t waitMs)
+{
+    if (fd < 0 || maxOut <= 0)
+    {
+        return 0;
+    }
+
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    struct timeval tv;
+    tv.tv_sec = waitMs / 1000;
+    tv.tv_usec = (waitMs % 1000) * 1000;
+    if (select(fd + 1, &readSet, nullptr, nullptr, &tv) <= 0)
+    {
+        return 0;
+    }
+
+    // IP header (up to 60) + ICMP header; the echoed payload is not needed
+    uint8_t packet[96];
+    int produced = 0;
+    while (produced < maxOut)
+    {
+        int n = recv(fd, packet, sizeof(packet), MSG_DONTWAIT);
+        if (n <= 0)
+        {
+            break;
+        }
+
+        size_t ipHeader = (size_t)(packet[0] & 0x0F) * 4;
+        if ((packet[0] >> 4) != 4 || packet[9] != IPPROTO_ICMP || ipHeader < 20 ||
+            (size_t)n < ipHeader + ICMP_HEADER_SIZE)
+        {
+            continue;
+        }
+        const uint8_t *icmp = packet + ipHeader;
+        uint16_t id = (uint16_t)((icmp[4] << 8) | icmp[5]);
+        uint16_t sequence = (uint16_t)((icmp[6] << 8) | icmp[7]);
+        if (icmp[0] != ICMP_ECHO_REPLY || icmp[1] != 0 || id != identifier)
+        {
+            continue;
+        }
+
+        // Same slot, same sequence and the address it was sent to
+        uint32_t from;
+        memcpy(&from, packet + 12, 4);
+        Pending &entry = pending[sequence % MAX_PENDING];
+        if (!entry.used || entry.sequence != sequence || entry.ip != from)
+        {
+            continue; // Late reply to an expired request, or a duplicate
+        }
+
+        out[produced].ip = from;
+        out[produced].rttMs = millis() - entry.sentMs;
+        produced++;
+        entry.used = false;
+        pendingUsed--;
+    }
+    return produced;
+}
+
+bool IcmpProber::takeExpired(uint32_t timeoutMs, uint32_t &ip, uint8_t &attempt)
+{
+    if (pendingUsed == 0)
+    {
+        return false;
+    }
+
+    unsigned long now = millis();
+    for (int i = 0; i < MAX_PENDING; i++)
+    {
+        Pending &entry = pending[i];
+        if (entry.used && now - entry.sentMs >= timeoutMs)
+        {
+            ip = entry.ip;
+            attempt = entry.attempt;
+            entry.used = false;
+            pendingUsed--;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,66 @@
+#ifndef ICMP_PROBER_H
+#define ICMP_PROBER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// ICMP Prober - Echo requests through an lwIP raw socket
+// ============================================================================
+// Every request carries the prober's identifier and a sequence number whose
+// low bits name its pending slot, so a reply is matched to the one request
+// (first send or retry) that caused it and its RTT is exact. lwIP hands raw
+// PCBs a copy of each ICMP packet before it answers or drops it, so echo
+// replies are read from the same socket. Addresses are network byte order.
+// ============================================================================
+
+struct IcmpEcho
+{
+    uint32_t ip;
+    uint32_t rttMs;
+};
+
+class IcmpProber
+{
+public:
+    static const int MAX_PENDING = ICMP_MAX_IN_FLIGHT;
+
+    bool begin();
+    void end();
+    bool isOpen() const { return fd >= 0; }
+
+    // Send an echo request and queue it as pending. attempt 0 is the first send.
+    bool send(uint32_t ip, uint8_t attempt);
+
+    // Wait up to waitMs for replies; matched requests leave the pending set.
+    // Returns how many were written to out.
+    int receive(IcmpEcho *out, int maxOut, uint32_t waitMs);
+
+    // Take one request older than timeoutMs out of the pending set
+    bool takeExpired(uint32_t timeoutMs, uint32_t &ip, uint8_t &attempt);
+
+    int pendingCount() const { return pendingUsed; }
+    bool hasRoom() const { return pendingUsed < MAX_PENDING; }
+
+private:
+    static_assert((MAX_PENDING & (MAX_PENDING - 1)) == 0, "ICMP_MAX_IN_FLIGHT must be a power of two");
+
+    struct Pending
+    {
+        unsigned long sentMs;
+        uint32_t ip;
+        uint16_t sequence;
+        uint8_t attempt;
+        bool used;
+    };
+
+    int fd = -1;
+    uint16_t identifier = 0;
+    uint16_t generation = 0;  // Upper sequence bits; advances with every send
+
+    Pending pending[MAX_PENDING];
+    int pendingUsed = 0;
+    int nextFree = 0;  // Where the search for a free slot starts
+};
+
+#endif // ICMP_PROBER_H
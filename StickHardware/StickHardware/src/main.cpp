@@ -11,7 +11,12 @@
 #include "bluetooth_handler.h"
 #include "wifi_scanner.h"
 #include "network_scanner.h"
+#include "passive_listener.h"
 #include "port_scanner.h"
+#include "udp_scanner.h"
+#include "scan_checkpoint.h"
+#include "device_inventory.h"
+#include "name_resolver.h"
 #include "vulnerability_db.h"
 #include <mbedtls/base64.h>
 #include <time.h>
@@ -23,21 +28,17 @@
 static unsigned long lastActivityTime = 0;
 static bool legalWarningAcknowledged = false;
 static int batteryLevel = 100;
-<<<<<<< HEAD
-=======
 static const char *progressStage = "port_scan";
 static unsigned long lastStatusUpdate = 0;
 static const unsigned long STATUS_UPDATE_INTERVAL_MS = 5000;
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 
 // Progress helpers (to avoid capturing lambdas with function pointers)
 static char progressSubnet[24] = {0};
 static char progressTargetIP[16] = {0};
+static const char *progressNetworkOperation = "network_scan";  // Or "network_delta"
 static uint16_t progressTotalPorts = 0;
-<<<<<<< HEAD
-=======
-static char currentPortTarget[16] = {0};
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+static bool streamPortRaw = false;
+static bool resumePending = false;  // Set while a resume command replays its job
 
 // Map command to human-readable label for on-screen echo
 const char *commandName(BLECommand cmd)
@@ -50,8 +51,20 @@ const char *commandName(BLECommand cmd)
         return "network_scan";
     case BLECommand::PORT_SCAN:
         return "port_scan";
+    case BLECommand::ADVANCED_SCAN:
+        return "advanced_scan";
     case BLECommand::WIFI_CONNECT:
         return "wifi_connect";
+    case BLECommand::SWEEP:
+        return "sweep";
+    case BLECommand::TOP_PORTS:
+        return "top_ports";
+    case BLECommand::UDP_SCAN:
+        return "udp_scan";
+    case BLECommand::NETWORK_DELTA:
+        return "network_delta";
+    case BLECommand::RESUME:
+        return "resume";
     case BLECommand::CANCEL:
         return "cancel";
     default:
@@ -110,23 +123,6 @@ const char *securityStringLower(wifi_auth_mode_t encType)
     }
 }
 
-uint32_t simpleCrc32(const uint8_t *data, size_t len)
-{
-    uint32_t crc = 0xFFFFFFFF;
-    for (size_t i = 0; i < len; i++)
-    {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++)
-        {
-            uint32_t mask = -(crc & 1);
-            crc = (crc >> 1) ^ (0xEDB88320 & mask);
-        }
-    }
-    return ~crc;
-}
-
-<<<<<<< HEAD
-=======
 void sendStatusUpdate(const char *stageOverride = nullptr, int progressOverride = -1)
 {
     if (!bleHandler.isConnected())
@@ -148,7 +144,7 @@ void sendStatusUpdate(const char *stageOverride = nullptr, int progressOverride
     }
     else if (networkScanner.isScanning())
     {
-        operation = "network_scan";
+        operation = progressNetworkOperation;
         progress = networkScanner.getScanProgress();
     }
     else if (portScanner.isScanning())
@@ -166,7 +162,6 @@ void sendStatusUpdate(const char *stageOverride = nullptr, int progressOverride
                           ssid.c_str(), rssi, operation, progress, uptimeSeconds);
 }
 
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 bool base64Encode(const uint8_t *data, size_t len, String &out)
 {
     size_t needed = 0;
@@ -185,23 +180,55 @@ bool base64Encode(const uint8_t *data, size_t len, String &out)
 // Total counts for progress calculation
 static int progressNetworkTotal = 254;
 static int progressPortTotal = 1000;
+static int progressPortBase = 0;  // Sweep probes finished in earlier host batches
 
 void onNetworkProgress(int percent, int devicesFound)
 {
     displayManager.showNetworkScan(progressSubnet, percent, devicesFound);
     int current = (percent * progressNetworkTotal) / 100;
-    bleHandler.sendProgress("network_scan", current, progressNetworkTotal);
+    bleHandler.sendProgress(progressNetworkOperation, current, progressNetworkTotal);
+}
+
+// A BLE disconnect or cancel command stops the running port job
+static void pollPortCancel()
+{
+    if (bleHandler.isCancelRequested() && portScanner.isScanning())
+    {
+        portScanner.cancelScan();
+    }
 }
 
 void onPortProgress(uint16_t currentPort, int percent, int openCount)
 {
+    pollPortCancel();
     displayManager.showPortScan(progressTargetIP, currentPort, progressTotalPorts, openCount);
-    int current = (percent * progressPortTotal) / 100;
-<<<<<<< HEAD
-    bleHandler.sendProgress("port_scan", current, progressPortTotal);
-=======
-    bleHandler.sendProgress(progressStage, current, progressPortTotal);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+    // percent covers the running scan: every port on each of its targets
+    int64_t running = (int64_t)progressTotalPorts * portScanner.getTargetCount();
+    int current = progressPortBase + (int)(percent * running / 100);
+    bleHandler.sendProgress("discover", progressStage, current, progressPortTotal,
+                            (int)portScanner.getCurrentRate());
+}
+
+void onEnrichProgress(int enriched, int discovered)
+{
+    bleHandler.sendProgress("enrich", progressStage, enriched, discovered);
+}
+
+void onScanCheckpoint(int resumeIndex)
+{
+    pollPortCancel();
+    scanCheckpoint.save(portScanner, resumeIndex);
+}
+
+void onUdpProgress(int done, int total, int openCount)
+{
+    // Same as pollPortCancel(): a BLE disconnect or cancel stops the job
+    if (bleHandler.isCancelRequested())
+    {
+        udpScanner.cancelScan();
+    }
+    displayManager.showPortScan(progressTargetIP, done, total, openCount);
+    bleHandler.sendProgress("udp_scan", done, total, (int)udpScanner.getCurrentRate());
 }
 
 // ============================================================================
@@ -214,7 +241,9 @@ void onDeviceFound(const NetworkDevice &device)
     bleHandler.sendDevice(
         device.ip.toString().c_str(),
         device.macStr,
-        device.vendor);
+        device.vendor,
+        device.hostname,
+        device.rttMs);
 
     // Update display with progress
     displayManager.showNetworkScan(
@@ -223,6 +252,75 @@ void onDeviceFound(const NetworkDevice &device)
         networkScanner.getDeviceCount());
 }
 
+void onInventoryEvent(const InventoryEvent &event)
+{
+    static const char *TYPES[] = {"joined", "left", "changed_ip"};
+
+    char mac[18];
+    snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+             event.mac[0], event.mac[1], event.mac[2], event.mac[3], event.mac[4], event.mac[5]);
+    String ip = fromHostOrder(event.ip).toString();
+    String oldIp = fromHostOrder(event.oldIp).toString();
+    const PassiveHost *heard = passiveListener.findHost(event.ip);
+
+    bleHandler.sendInventoryEvent(
+        TYPES[(int)event.change],
+        ip.c_str(),
+        mac,
+        lookupVendor(event.mac),
+        heard ? heard->name : nullptr,
+        event.change == InventoryChange::CHANGED_IP ? oldIp.c_str() : nullptr,
+        event.firstSeen,
+        event.lastSeen);
+}
+
+void onDeviceName(uint32_t ip, const char *name, NameSource source)
+{
+    bleHandler.sendDeviceName(fromHostOrder(ip).toString().c_str(), name,
+                              NameResolver::sourceName(source));
+}
+
+void onNameProgress(int done, int total)
+{
+    if (bleHandler.isCancelRequested())
+    {
+        nameResolver.cancel();
+    }
+    bleHandler.sendProgress("resolve", "network_scan", done, total);
+}
+
+// Name stage after a sweep: devices the passive listener has not named
+static void resolveDeviceNames()
+{
+    int count = networkScanner.getDeviceCount();
+    uint32_t *ips = (uint32_t *)malloc(count * sizeof(uint32_t));
+    if (!ips)
+    {
+        return;
+    }
+
+    int unnamed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        NetworkDevice device = networkScanner.getDevice(i);
+        if (device.hostname[0] == '\0')
+        {
+            ips[unnamed++] = toHostOrder(device.ip);
+        }
+    }
+    if (unnamed > 0)
+    {
+        nameResolver.resolve(ips, unnamed, onDeviceName, onNameProgress);
+    }
+    free(ips);
+}
+
+// Inventory of the network we are on (SSID and subnet)
+static bool selectInventory()
+{
+    return deviceInventory.select(wifiScanner.getSSID().c_str(), networkScanner.getLocalRange());
+}
+
 void onPortFound(const PortResult &result)
 {
     // Send port result using new protocol format
@@ -230,20 +328,27 @@ void onPortFound(const PortResult &result)
         result.port,
         result.service,
         result.banner);
-<<<<<<< HEAD
-=======
 
     // Extended raw event with version/target
-    if (currentPortTarget[0] != '\0')
+    if (streamPortRaw)
     {
         bleHandler.sendPortRaw(
             result.port,
-            currentPortTarget,
+            result.ip,
             result.service,
             result.banner,
             (result.version[0] != '\0') ? result.version : nullptr);
     }
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+}
+
+void onUdpResult(const UdpResult &result)
+{
+    bleHandler.sendUdpPortRaw(
+        result.port,
+        result.ip,
+        udpStateName(result.state),
+        result.service,
+        result.banner[0] ? result.banner : nullptr);
 }
 
 void onVulnFound(const Vulnerability &vuln)
@@ -256,6 +361,26 @@ void onVulnFound(const Vulnerability &vuln)
     bleHandler.sendRaw(buf);
 }
 
+// Single-target port jobs checkpoint as they go; a resume picks up the
+// stored job instead of starting over
+static void beginCheckpointedScan(const CommandData &cmd)
+{
+    if (resumePending && scanCheckpoint.restore(portScanner))
+    {
+        return;
+    }
+    scanCheckpoint.start(cmd);
+}
+
+// Keep the checkpoint only when the job stopped early
+static void endCheckpointedScan()
+{
+    if (!portScanner.wasCancelled())
+    {
+        scanCheckpoint.clear();
+    }
+}
+
 // ============================================================================
 // Command Processing - New Protocol
 // ============================================================================
@@ -387,9 +512,20 @@ void processCommand(const CommandData &cmd)
             break;
         }
 
+        // ARP stays on the local link; echo requests are routed
+        HostRange range = cmd.netRange.isEmpty() ? networkScanner.getLocalRange() : cmd.netRange;
+        if (cmd.netMethod == DiscoveryMethod::ARP && networkScanner.getLocalRange().intersect(range).isEmpty())
+        {
+            bleHandler.sendError("Target outside local subnet");
+            displayManager.showError("Not local");
+            break;
+        }
+
         displayManager.showMessage("Network scan...", COLOR_PROGRESS, 3000);
 
         networkScanner.init();
+        networkScanner.setMethod(cmd.netMethod);
+        progressNetworkOperation = "network_scan";
         String subnetStr = networkScanner.getNetworkAddress().toString();
         strncpy(progressSubnet, subnetStr.c_str(), sizeof(progressSubnet) - 1);
         progressSubnet[sizeof(progressSubnet) - 1] = '\0';
@@ -397,16 +533,96 @@ void processCommand(const CommandData &cmd)
         displayManager.showNetworkScan(progressSubnet, 0, 0);
 
         // Scan network - onDeviceFound will send each device via BLE
-        int deviceCount = networkScanner.scanNetwork(onDeviceFound, onNetworkProgress);
+        int deviceCount = networkScanner.scanRange(range, onDeviceFound, onNetworkProgress);
+
+        // Names follow as device_name updates; net_done closes the scan
+        if (deviceCount > 0 && cmd.resolveNames)
+        {
+            resolveDeviceNames();
+        }
 
         // Send completion event
         bleHandler.sendNetDone(deviceCount);
 
+        // Refresh the inventory quietly; only ARP sweeps see every MAC
+        if (deviceCount >= 0 && cmd.netMethod != DiscoveryMethod::ICMP && !networkScanner.wasCancelled() &&
+            selectInventory())
+        {
+            deviceInventory.apply(networkScanner, range.intersect(networkScanner.getLocalRange()));
+            deviceInventory.save();
+        }
+
         displayManager.showNetworkScan(progressSubnet, 100, deviceCount);
         displayManager.showMessage("Network scan done", COLOR_OK, 2000);
         break;
     }
 
+    case BLECommand::NETWORK_DELTA:
+    {
+        Serial.println("[Main] Processing: network_delta");
+
+        if (!wifiScanner.isConnected())
+        {
+            bleHandler.sendError("WiFi not connected");
+            displayManager.showError("Not connected");
+            break;
+        }
+
+        HostRange local = networkScanner.getLocalRange();
+        HostRange range = cmd.netRange.isEmpty() ? local : cmd.netRange.intersect(local);
+        if (range.isEmpty())
+        {
+            bleHandler.sendError("Target outside local subnet");
+            displayManager.showError("Not local");
+            break;
+        }
+        if (!selectInventory())
+        {
+            bleHandler.sendError("Inventory unavailable");
+            displayManager.showError("No inventory");
+            break;
+        }
+
+        displayManager.showMessage("Network delta...", COLOR_PROGRESS, 3000);
+
+        // Known devices first with full retries, the rest of the range once
+        int knownCount = 0;
+        const uint32_t *known = deviceInventory.knownAddresses(range, knownCount);
+        networkScanner.init();
+        networkScanner.setKnownHosts(known, knownCount);
+        progressNetworkOperation = "network_delta";
+        String subnetStr = networkScanner.getNetworkAddress().toString();
+        strncpy(progressSubnet, subnetStr.c_str(), sizeof(progressSubnet) - 1);
+        progressSubnet[sizeof(progressSubnet) - 1] = '\0';
+
+        displayManager.showNetworkScan(progressSubnet, 0, 0);
+
+        // Devices are not streamed; only the differences are
+        int deviceCount = networkScanner.scanRange(range, nullptr, onNetworkProgress);
+        networkScanner.setKnownHosts(nullptr, 0);
+        if (deviceCount < 0)
+        {
+            bleHandler.sendError("Network delta failed");
+            displayManager.showError("Delta failed");
+            break;
+        }
+        if (networkScanner.wasCancelled())
+        {
+            // A partial sweep would report everything it missed as gone
+            displayManager.showMessage("Cancelled", COLOR_WARNING, 2000);
+            break;
+        }
+
+        InventorySummary summary = deviceInventory.apply(networkScanner, range, onInventoryEvent);
+        deviceInventory.save();
+        bleHandler.sendDeltaDone(summary.seen, summary.joined, summary.left, summary.changedIp,
+                                 deviceInventory.getCount());
+
+        displayManager.showNetworkScan(progressSubnet, 100, deviceCount);
+        displayManager.showMessage("Network delta done", COLOR_OK, 2000);
+        break;
+    }
+
     case BLECommand::PORT_SCAN:
     {
         Serial.printf("[Main] Processing: port_scan %s:%d-%d\n",
@@ -424,37 +640,31 @@ void processCommand(const CommandData &cmd)
         strncpy(progressTargetIP, cmd.targetIP, sizeof(progressTargetIP) - 1);
         progressTotalPorts = cmd.portEnd - cmd.portStart + 1;
         progressPortTotal = progressTotalPorts;
-<<<<<<< HEAD
-=======
         progressStage = "port_scan";
-        strncpy(currentPortTarget, cmd.targetIP, sizeof(currentPortTarget) - 1);
-        currentPortTarget[sizeof(currentPortTarget) - 1] = '\0';
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+        streamPortRaw = true;
 
         displayManager.showPortScan(cmd.targetIP, 0, progressTotalPorts, 0);
 
         portScanner.init();
+        portScanner.setScanMode(cmd.synScan ? ScanMode::SYN : ScanMode::CONNECT);
+        portScanner.setRateCeiling(cmd.rate);
+
+        beginCheckpointedScan(cmd);
 
         // Scan ports - callback sends each open port via BLE
-<<<<<<< HEAD
-        portScanner.scanPorts(cmd.targetIP, cmd.portStart, cmd.portEnd, [](const PortResult &result)
-                              { bleHandler.sendPortResult(result.port, result.service, result.banner); }, onPortProgress);
-=======
         portScanner.scanPorts(cmd.targetIP, cmd.portStart, cmd.portEnd,
                               onPortFound,
                               onPortProgress,
                               false,
                               true);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+        endCheckpointedScan();
 
         // Send completion event
         bleHandler.sendPortDone(portScanner.getOpenPortCount());
 
         displayManager.showPortScan(cmd.targetIP, 100, 100, portScanner.getOpenPortCount());
         displayManager.showMessage("Port scan done", COLOR_OK, 2000);
-<<<<<<< HEAD
-=======
-        currentPortTarget[0] = '\0';
+        streamPortRaw = false;
         break;
     }
 
@@ -476,18 +686,22 @@ void processCommand(const CommandData &cmd)
         progressTotalPorts = cmd.portEnd - cmd.portStart + 1;
         progressPortTotal = progressTotalPorts;
         progressStage = "advanced_scan";
-        strncpy(currentPortTarget, cmd.targetIP, sizeof(currentPortTarget) - 1);
-        currentPortTarget[sizeof(currentPortTarget) - 1] = '\0';
+        streamPortRaw = true;
 
         displayManager.showPortScan(cmd.targetIP, 0, progressTotalPorts, 0);
 
         portScanner.init();
+        portScanner.setScanMode(cmd.synScan ? ScanMode::SYN : ScanMode::CONNECT);
+        portScanner.setRateCeiling(cmd.rate);
+
+        beginCheckpointedScan(cmd);
 
         portScanner.scanPorts(cmd.targetIP, cmd.portStart, cmd.portEnd,
                               onPortFound,
                               onPortProgress,
                               cmd.osDetect,
                               cmd.serviceVersion);
+        endCheckpointedScan();
 
         const char *osLabel = cmd.osDetect ? portScanner.getDetectedOS() : "unknown";
         bleHandler.sendPortSummary(cmd.portStart, cmd.portEnd, cmd.targetIP, osLabel, portScanner);
@@ -497,7 +711,233 @@ void processCommand(const CommandData &cmd)
 
         displayManager.showPortScan(cmd.targetIP, 100, 100, portScanner.getOpenPortCount());
         displayManager.showMessage("Advanced scan done", COLOR_OK, 2000);
-        currentPortTarget[0] = '\0';
+        streamPortRaw = false;
+        break;
+    }
+
+    case BLECommand::TOP_PORTS:
+    {
+        Serial.printf("[Main] Processing: top_ports %s (top %d)\n", cmd.targetIP, cmd.topPorts);
+
+        if (!wifiScanner.isConnected())
+        {
+            bleHandler.sendError("WiFi not connected");
+            displayManager.showError("Not connected");
+            break;
+        }
+
+        displayManager.showMessage("Top ports...", COLOR_PROGRESS, 3000);
+
+        strncpy(progressTargetIP, cmd.targetIP, sizeof(progressTargetIP) - 1);
+        progressTotalPorts = cmd.topPorts;
+        progressPortTotal = progressTotalPorts;
+        progressStage = "top_ports";
+        streamPortRaw = true;
+
+        displayManager.showPortScan(cmd.targetIP, 0, progressTotalPorts, 0);
+
+        portScanner.init();
+        portScanner.setScanMode(cmd.synScan ? ScanMode::SYN : ScanMode::CONNECT);
+        portScanner.setRateCeiling(cmd.rate);
+
+        beginCheckpointedScan(cmd);
+
+        portScanner.scanTopPorts(cmd.targetIP, cmd.topPorts,
+                                 onPortFound,
+                                 onPortProgress,
+                                 cmd.osDetect,
+                                 cmd.serviceVersion);
+        endCheckpointedScan();
+
+        // Ranked scans have no contiguous range; start/end are reported as 0
+        const char *osLabel = cmd.osDetect ? portScanner.getDetectedOS() : "unknown";
+        bleHandler.sendPortSummary(0, 0, cmd.targetIP, osLabel, portScanner);
+
+        // Send completion event
+        bleHandler.sendPortDone(portScanner.getOpenPortCount());
+
+        displayManager.showPortScan(cmd.targetIP, 100, 100, portScanner.getOpenPortCount());
+        displayManager.showMessage("Top ports done", COLOR_OK, 2000);
+        streamPortRaw = false;
+        break;
+    }
+
+    case BLECommand::SWEEP:
+    {
+        Serial.println("[Main] Processing: sweep");
+
+        if (!wifiScanner.isConnected())
+        {
+            bleHandler.sendError("WiFi not connected");
+            displayManager.showError("Not connected");
+            break;
+        }
+
+        int hostCount = networkScanner.getDeviceCount();
+        if (hostCount <= 0)
+        {
+            bleHandler.sendError("No hosts - run network_scan first");
+            displayManager.showError("No hosts");
+            break;
+        }
+
+        IPAddress *hosts = new IPAddress[hostCount];
+        for (int i = 0; i < hostCount; i++)
+        {
+            hosts[i] = networkScanner.getDevice(i).ip;
+        }
+
+        const uint16_t *portList = nullptr;
+        int portCount = cmd.portEnd - cmd.portStart + 1;
+        if (cmd.commonPorts)
+        {
+            portList = COMMON_PORTS;
+            portCount = COMMON_PORTS_COUNT;
+        }
+        else if (cmd.topPorts > 0)
+        {
+            portList = topPortsTable();
+            portCount = cmd.topPorts;
+        }
+
+        displayManager.showMessage("Sweep...", COLOR_PROGRESS, 3000);
+
+        snprintf(progressTargetIP, sizeof(progressTargetIP), "%d hosts", hostCount);
+        progressTotalPorts = portCount;
+        progressPortTotal = portCount * hostCount; // MAX_DEVICES_IN_SCAN x 65535 fits an int
+        progressPortBase = 0;
+        progressStage = "sweep";
+        streamPortRaw = true;
+
+        displayManager.showPortScan(progressTargetIP, 0, progressTotalPorts, 0);
+
+        portScanner.init();
+        portScanner.setRateCeiling(cmd.rate);
+
+        // PortScanner keeps per-target state for MAX_SWEEP_HOSTS hosts, so
+        // larger networks are swept a batch at a time. Results stream per
+        // host through onPortFound as port_raw events.
+        int openCount = 0;
+        int swept = 0;
+        while (swept < hostCount && !bleHandler.isCancelRequested())
+        {
+            int batch = hostCount - swept < MAX_SWEEP_HOSTS ? hostCount - swept : MAX_SWEEP_HOSTS;
+            openCount += portScanner.sweepHosts(hosts + swept, batch, portList, cmd.portStart, portCount,
+                                                onPortFound,
+                                                onPortProgress,
+                                                cmd.serviceVersion);
+            swept += portScanner.getTargetCount();
+            progressPortBase += portCount * portScanner.getTargetCount();
+            if (portScanner.wasCancelled())
+            {
+                break;
+            }
+        }
+        delete[] hosts;
+        progressPortBase = 0;
+
+        bleHandler.sendSweepDone(swept, openCount);
+
+        displayManager.showPortScan(progressTargetIP, 100, 100, openCount);
+        displayManager.showMessage("Sweep done", COLOR_OK, 2000);
+        streamPortRaw = false;
+        break;
+    }
+
+    case BLECommand::UDP_SCAN:
+    {
+        Serial.println("[Main] Processing: udp_scan");
+
+        if (!wifiScanner.isConnected())
+        {
+            bleHandler.sendError("WiFi not connected");
+            displayManager.showError("Not connected");
+            break;
+        }
+
+        int hostCount = 1;
+        IPAddress single;
+        if (cmd.targetIP[0] != '\0')
+        {
+            if (!single.fromString(cmd.targetIP))
+            {
+                bleHandler.sendError("Invalid 'target' IP");
+                break;
+            }
+        }
+        else
+        {
+            hostCount = networkScanner.getDeviceCount();
+            if (hostCount <= 0)
+            {
+                bleHandler.sendError("No hosts - run network_scan first");
+                displayManager.showError("No hosts");
+                break;
+            }
+        }
+
+        IPAddress *hosts = new IPAddress[hostCount];
+        if (cmd.targetIP[0] != '\0')
+        {
+            hosts[0] = single;
+        }
+        else
+        {
+            for (int i = 0; i < hostCount; i++)
+            {
+                hosts[i] = networkScanner.getDevice(i).ip;
+            }
+        }
+
+        displayManager.showMessage("UDP scan...", COLOR_PROGRESS, 3000);
+
+        if (hostCount == 1)
+        {
+            strncpy(progressTargetIP, hosts[0].toString().c_str(), sizeof(progressTargetIP) - 1);
+        }
+        else
+        {
+            snprintf(progressTargetIP, sizeof(progressTargetIP), "%d hosts", hostCount);
+        }
+
+        const uint16_t *ports = cmd.udpPortCount > 0 ? cmd.udpPorts : nullptr;
+        udpScanner.setRateCeiling(cmd.rate);
+        int openCount = udpScanner.scan(hosts, hostCount, ports, cmd.udpPortCount,
+                                        onUdpResult,
+                                        onUdpProgress);
+        delete[] hosts;
+
+        bleHandler.sendUdpDone(hostCount, openCount,
+                               udpScanner.getOpenFilteredCount(),
+                               udpScanner.getClosedCount(),
+                               udpScanner.getFilteredCount());
+
+        displayManager.showPortScan(progressTargetIP, 100, 100, openCount);
+        displayManager.showMessage("UDP scan done", COLOR_OK, 2000);
+        break;
+    }
+
+    case BLECommand::RESUME:
+    {
+        Serial.println("[Main] Processing: resume");
+
+        CommandData resumed;
+        if (!scanCheckpoint.load(resumed))
+        {
+            bleHandler.sendError("No scan to resume");
+            displayManager.showError("Nothing to resume");
+            break;
+        }
+
+        char buf[96];
+        snprintf(buf, sizeof(buf), "{\"type\":\"resumed\",\"cmd\":\"%s\",\"target\":\"%s\"}",
+                 commandName(resumed.cmd), resumed.targetIP);
+        bleHandler.sendRaw(buf);
+
+        // Replays the stored job; its scan case restores the checkpoint
+        resumePending = true;
+        processCommand(resumed);
+        resumePending = false;
         break;
     }
 
@@ -506,7 +946,6 @@ void processCommand(const CommandData &cmd)
         Serial.println("[Main] Processing: status");
         sendStatusUpdate();
         displayManager.showMessage("Status sent", COLOR_INFO, 1500);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
         break;
     }
 
@@ -553,6 +992,14 @@ void setup()
 
     // Initialize port scanner
     portScanner.init();
+    portScanner.setEnrichProgressCallback(onEnrichProgress);
+    portScanner.setCheckpointCallback(onScanCheckpoint);
+
+    // Checkpoints for resumable scans
+    scanCheckpoint.begin();
+
+    // Devices seen per network, for network_delta
+    deviceInventory.begin();
 
     // Initialize vulnerability database
     vulnDB.init();
@@ -590,15 +1037,27 @@ void loop()
     bleHandler.update();
     if (bleHandler.hasCommand())
     {
+        // Commands get the whole socket budget; listening resumes afterwards
+        passiveListener.stop();
         CommandData cmd = bleHandler.getCommand();
         processCommand(cmd);
     }
 
+    // Passive host discovery while idle on a network
+    if (wifiScanner.isConnected())
+    {
+        passiveListener.begin();
+        passiveListener.poll();
+    }
+    else if (passiveListener.isRunning() || passiveListener.getHostCount() > 0)
+    {
+        passiveListener.stop();
+        passiveListener.clear();
+    }
+
     // Update display periodically
     displayManager.refresh();
 
-<<<<<<< HEAD
-=======
     // Periodic status push
     if (millis() - lastStatusUpdate > STATUS_UPDATE_INTERVAL_MS)
     {
@@ -606,7 +1065,6 @@ void loop()
         sendStatusUpdate();
     }
 
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
     // Check button for status display
     if (M5.BtnA.wasPressed())
     {
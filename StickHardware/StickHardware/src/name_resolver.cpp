@@ -0,0 +1,358 @@
+#include "name_resolver.h"
+#include "host_range.h"
+#include "dns_message.h"
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <esp_system.h>
+
+// ============================================================================
+// Name Resolver - Implementation
+// ============================================================================
+
+NameResolver nameResolver;
+
+static const uint16_t DNS_PORT = 53;
+static const uint16_t MDNS_PORT = 5353;
+static const uint16_t NBNS_PORT = 137;
+
+// "*" padded with NULs, first-level encoded: asks for the whole name table
+static const char *NBSTAT_WILDCARD = "CKAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA";
+static const size_t NBSTAT_ENTRY_SIZE = 18;  // 15-char name, suffix, flags
+static const uint16_t NBSTAT_GROUP_FLAG = 0x8000;
+static const uint8_t NETBIOS_WORKSTATION = 0x00;
+
+static uint8_t datagram[1472]; // One Ethernet MTU of UDP payload
+
+static inline uint8_t sourceBit(NameSource source)
+{
+    return (uint8_t)(1 << (int)source);
+}
+
+static const uint8_t ALL_SOURCES = (1 << 0) | (1 << 1) | (1 << 2);
+
+const char *NameResolver::sourceName(NameSource source)
+{
+    switch (source)
+    {
+    case NameSource::MDNS:
+        return "mdns";
+    case NameSource::DNS:
+        return "dns";
+    default:
+        return "netbios";
+    }
+}
+
+bool NameResolver::openSocket()
+{
+    fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0)
+    {
+        Serial.println("[Names] No UDP socket available");
+        return false;
+    }
+
+    // An ephemeral source port: mDNS responders then answer by unicast
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = 0;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    bind(fd, (struct sockaddr *)&local, sizeof(local));
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    return true;
+}
+
+void NameResolver::closeSocket()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+bool NameResolver::sendQuery(int slot, NameSource source)
+{
+    const Pending &entry = pending[slot];
+    uint16_t id = (uint16_t)(idBase + slot);
+
+    char name[32];
+    uint8_t query[64];
+    size_t len;
+    uint32_t to;
+    uint16_t port;
+    switch (source)
+    {
+    case NameSource::DNS:
+        reverseDnsName(entry.ip, name, sizeof(name));
+        len = writeDnsQuery(query, sizeof(query), id, DNS_FLAG_RECURSION_DESIRED, name,
+                            DNS_TYPE_PTR, DNS_CLASS_IN);
+        to = dnsServer;
+        port = DNS_PORT;
+        break;
+    case NameSource::MDNS:
+        reverseDnsName(entry.ip, name, sizeof(name));
+        len = writeDnsQuery(query, sizeof(query), id, 0, name, DNS_TYPE_PTR, DNS_CLASS_IN);
+        to = entry.ip;
+        port = MDNS_PORT;
+        break;
+    default:
+        len = writeDnsQuery(query, sizeof(query), id, 0, NBSTAT_WILDCARD, DNS_TYPE_NBSTAT, DNS_CLASS_IN);
+        to = entry.ip;
+        port = NBNS_PORT;
+        break;
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(to);
+    return len > 0 && sendto(fd, query, len, 0, (struct sockaddr *)&addr, sizeof(addr)) == (int)len;
+}
+
+void NameResolver::answered(Pending &entry, NameSource source)
+{
+    if (entry.waiting == 0)
+    {
+        return;
+    }
+    entry.waiting &= ~sourceBit(source);
+    if (entry.waiting == 0)
+    {
+        settled++;
+    }
+}
+
+// Unique workstation name from an NBSTAT answer, else the first unique one
+static bool pickNetbiosName(const uint8_t *data, size_t len, char *out, size_t outSize)
+{
+    if (len < 1)
+    {
+        return false;
+    }
+    int names = data[0];
+    const uint8_t *chosen = nullptr;
+    for (int i = 0; i < names && 1 + (i + 1) * NBSTAT_ENTRY_SIZE <= len; i++)
+    {
+        const uint8_t *entry = data + 1 + i * NBSTAT_ENTRY_SIZE;
+        uint16_t flags = (uint16_t)((entry[16] << 8) | entry[17]);
+        if (flags & NBSTAT_GROUP_FLAG)
+        {
+            continue;
+        }
+        if (entry[15] == NETBIOS_WORKSTATION)
+        {
+            chosen = entry;
+            break;
+        }
+        if (!chosen)
+        {
+            chosen = entry;
+        }
+    }
+    if (!chosen)
+    {
+        return false;
+    }
+
+    size_t end = 15;
+    while (end > 0 && (chosen[end - 1] == ' ' || chosen[end - 1] == '\0'))
+    {
+        end--;
+    }
+    size_t written = 0;
+    for (size_t i = 0; i < end && written + 1 < outSize; i++)
+    {
+        char c = (char)chosen[i];
+        out[written++] = (c >= 0x20 && c < 0x7F) ? c : '?';
+    }
+    out[written] = '\0';
+    return written > 0;
+}
+
+void NameResolver::handleReply(const uint8_t *data, size_t len, uint32_t from, uint16_t port,
+                               NameFoundCallback callback)
+{
+    DnsReader reader(data, len);
+    DnsHeader header;
+    if (!reader.readHeader(header) || !header.isResponse())
+    {
+        return;
+    }
+    uint16_t slot = (uint16_t)(header.id - idBase);
+    if (slot >= batchCount)
+    {
+        return; // Late answer from an earlier batch
+    }
+    Pending &entry = pending[slot];
+
+    // The protocol is the port it came from, and only the asked host answers
+    NameSource source;
+    if (port == DNS_PORT && from == dnsServer)
+    {
+        source = NameSource::DNS;
+    }
+    else if (port == MDNS_PORT && from == entry.ip)
+    {
+        source = NameSource::MDNS;
+    }
+    else if (port == NBNS_PORT && from == entry.ip)
+    {
+        source = NameSource::NETBIOS;
+    }
+    else
+    {
+        return;
+    }
+    if (!(entry.waiting & sourceBit(source)))
+    {
+        return; // Duplicate
+    }
+    answered(entry, source);
+
+    // NXDOMAIN and friends still settle the query
+    if (header.rcode() != 0)
+    {
+        return;
+    }
+
+    DnsRecord record;
+    for (int i = 0; i < header.questions; i++)
+    {
+        if (!reader.readQuestion(record))
+        {
+            return;
+        }
+    }
+
+    char name[NAME_RESOLVE_NAME_SIZE] = {0};
+    for (int i = 0; i < header.answers && name[0] == '\0' && reader.readRecord(record); i++)
+    {
+        if (source == NameSource::NETBIOS)
+        {
+            if (record.type == DNS_TYPE_NBSTAT)
+            {
+                pickNetbiosName(data + record.dataOffset, record.dataLength, name, sizeof(name));
+            }
+        }
+        else if (record.type == DNS_TYPE_PTR)
+        {
+            reader.readName(record.dataOffset, name, sizeof(name));
+        }
+    }
+
+    if (name[0] != '\0' && (int)source > entry.best)
+    {
+        if (entry.best < 0)
+        {
+            named++;
+        }
+        entry.best = (int8_t)source;
+        Serial.printf("[Names] %s: %s (%s)\n", fromHostOrder(entry.ip).toString().c_str(),
+                      name, sourceName(source));
+        if (callback)
+        {
+            callback(entry.ip, name, source);
+        }
+    }
+
+    // Nothing beats mDNS; stop waiting for the others
+    if (entry.best == (int8_t)NameSource::MDNS && entry.waiting != 0)
+    {
+        entry.waiting = 0;
+        settled++;
+    }
+}
+
+void NameResolver::drain(NameFoundCallback callback)
+{
+    while (true)
+    {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int n = recvfrom(fd, datagram, sizeof(datagram), MSG_DONTWAIT,
+                         (struct sockaddr *)&from, &fromLen);
+        if (n <= 0)
+        {
+            return;
+        }
+        handleReply(datagram, n, ntohl(from.sin_addr.s_addr), ntohs(from.sin_port), callback);
+    }
+}
+
+int NameResolver::resolve(const uint32_t *ips, int count, NameFoundCallback callback,
+                          NameProgressCallback progressCb)
+{
+    if (!openSocket())
+    {
+        return -1;
+    }
+
+    cancelled = false;
+    named = 0;
+    dnsServer = toHostOrder(WiFi.dnsIP());
+    Serial.printf("[Names] Resolving %d devices (DNS %s)\n", count,
+                  dnsServer ? fromHostOrder(dnsServer).toString().c_str() : "none");
+
+    int done = 0;
+    for (int first = 0; first < count && !cancelled; first += BATCH)
+    {
+        batchCount = count - first < BATCH ? count - first : BATCH;
+        settled = 0;
+        idBase = (uint16_t)esp_random();
+        for (int i = 0; i < batchCount; i++)
+        {
+            pending[i].ip = ips[first + i];
+            pending[i].waiting = dnsServer ? ALL_SOURCES : ALL_SOURCES & ~sourceBit(NameSource::DNS);
+            pending[i].best = -1;
+        }
+
+        // Queries go out a burst per tick, interleaved so each device's
+        // three are close together; replies are read between bursts
+        int next = 0;
+        int total = batchCount * QUERIES_PER_DEVICE;
+        unsigned long lastSent = millis();
+        while (!cancelled && settled < batchCount)
+        {
+            for (int sent = 0; sent < NAME_QUERY_BURST && next < total; next++)
+            {
+                int slot = next / QUERIES_PER_DEVICE;
+                NameSource source = (NameSource)(QUERIES_PER_DEVICE - 1 - next % QUERIES_PER_DEVICE);
+                if (!(pending[slot].waiting & sourceBit(source)))
+                {
+                    continue;
+                }
+                if (!sendQuery(slot, source))
+                {
+                    answered(pending[slot], source); // Refused by the stack: no answer coming
+                    continue;
+                }
+                sent++;
+                lastSent = millis();
+            }
+
+            delay(NAME_RESOLVE_POLL_MS);
+            yield(); // Prevent watchdog timeout
+            drain(callback);
+
+            if (next >= total && millis() - lastSent >= NAME_RESOLVE_TIMEOUT_MS)
+            {
+                break;
+            }
+        }
+
+        done += batchCount;
+        if (progressCb)
+        {
+            progressCb(done, count);
+        }
+    }
+
+    closeSocket();
+    Serial.printf("[Names] Named %d of %d devices\n", named, count);
+    return named;
+}
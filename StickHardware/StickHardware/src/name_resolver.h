@@ -0,0 +1,81 @@
+#ifndef NAME_RESOLVER_H
+#define NAME_RESOLVER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Name Resolver - Hostnames for discovered devices, asked for in batches
+// ============================================================================
+// Every device of a batch gets three queries at once from one UDP socket:
+//
+//   DNS server :53     PTR for d.c.b.a.in-addr.arpa (router's DHCP names)
+//   device :5353       the same PTR as a legacy unicast mDNS query
+//   device :137        NetBIOS node status (NBSTAT) for "*"
+//
+// The transaction ID names the device's slot and the source port the
+// protocol, so replies are taken in any order and a silent resolver only
+// costs the batch timeout, never a wait per device. A batch ends when every
+// device has answered on all three or NAME_RESOLVE_TIMEOUT_MS after its
+// last query went out. Addresses are host byte order.
+// ============================================================================
+
+// In ascending preference: a later, better answer replaces a name
+enum class NameSource : uint8_t
+{
+    NETBIOS,
+    DNS,
+    MDNS
+};
+
+// A device's first name, and again whenever a preferred source answers
+typedef void (*NameFoundCallback)(uint32_t ip, const char *name, NameSource source);
+
+// Devices settled so far out of total, after each batch
+typedef void (*NameProgressCallback)(int done, int total);
+
+class NameResolver
+{
+public:
+    // Returns how many addresses got a name, -1 without a socket
+    int resolve(const uint32_t *ips, int count, NameFoundCallback callback,
+                NameProgressCallback progressCb = nullptr);
+
+    void cancel() { cancelled = true; }
+
+    // "dns", "mdns" or "netbios"
+    static const char *sourceName(NameSource source);
+
+private:
+    static const int BATCH = NAME_RESOLVE_BATCH;
+    static const int QUERIES_PER_DEVICE = 3;
+
+    struct Pending
+    {
+        uint32_t ip;
+        uint8_t waiting; // Bit per NameSource still expected to answer
+        int8_t best;     // Best NameSource named so far, -1 for none
+    };
+
+    int fd = -1;
+    uint32_t dnsServer = 0; // Host order; 0 skips reverse DNS
+    uint16_t idBase = 0;
+    bool cancelled = false;
+
+    Pending pending[BATCH];
+    int batchCount = 0;
+    int settled = 0;
+    int named = 0;
+
+    bool openSocket();
+    void closeSocket();
+    bool sendQuery(int slot, NameSource source);
+    void drain(NameFoundCallback callback);
+    void handleReply(const uint8_t *data, size_t len, uint32_t from, uint16_t port,
+                     NameFoundCallback callback);
+    void answered(Pending &entry, NameSource source);
+};
+
+extern NameResolver nameResolver;
+
+#endif // NAME_RESOLVER_H
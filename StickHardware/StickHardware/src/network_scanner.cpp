@@ -1,8 +1,14 @@
 #include "network_scanner.h"
+#include "passive_listener.h"
+#include "icmp_prober.h"
+#include "generated/oui_table.h"
 #include <lwip/ip4_addr.h>
 #include <lwip/inet.h>
+#include <lwip/pbuf.h>
 #include <esp_netif.h>
 #include <esp_wifi.h>
+#include <stdlib.h>
+#include <atomic>
 
 // ============================================================================
 // Network Scanner - Implementation
@@ -11,35 +17,74 @@
 NetworkScanner networkScanner;
 
 // ============================================================================
-// OUI Database (common vendors) - stored in PROGMEM to save RAM
+// OUI Database - generated from the IEEE registry (src/generated/oui_table.h)
 // ============================================================================
+// Three sorted record arrays (36-, 28- and 24-bit prefixes) in flash. A
+// lookup binary-searches the longest prefixes first, since MA-M and MA-S
+// blocks are carved out of MA-L ranges registered to the IEEE itself.
 
-struct OUIEntry
+struct OuiTable
 {
-    uint8_t oui[3];
-    const char *vendor;
+    const uint8_t *records;
+    size_t count;
+    uint8_t keyBytes;
+    uint8_t lastByteMask; // Clears the bits past the prefix in its last byte
 };
 
-// Common OUI prefixes (add more as needed)
-static const OUIEntry OUI_DATABASE[] PROGMEM = {
-    {{0xB4, 0xE6, 0x2D}, "Espressif"},
-    {{0x24, 0x0A, 0xC4}, "Espressif"},
-    {{0x00, 0x17, 0xF2}, "Apple"},
-    {{0xAC, 0xBC, 0x32}, "Apple"},
-    {{0x00, 0x00, 0x0C}, "Cisco"},
-    {{0x00, 0x0C, 0x43}, "TP-Link"},
-    {{0x00, 0x00, 0x00}, nullptr} // Terminator
+static const OuiTable OUI_TABLES[] = {
+    {OUI_MAS_RECORDS, OUI_MAS_COUNT, 5, 0xF0},
+    {OUI_MAM_RECORDS, OUI_MAM_COUNT, 4, 0xF0},
+    {OUI_MAL_RECORDS, OUI_MAL_COUNT, 3, 0xFF},
 };
 
-#define OUI_DATABASE_SIZE (sizeof(OUI_DATABASE) / sizeof(OUI_DATABASE[0]) - 1)
+static const char *searchOuiTable(const OuiTable &table, const uint8_t *mac)
+{
+    uint8_t key[5];
+    memcpy(key, mac, table.keyBytes);
+    key[table.keyBytes - 1] &= table.lastByteMask;
+
+    const size_t recordSize = table.keyBytes + OUI_OFFSET_BYTES;
+    size_t low = 0;
+    size_t high = table.count;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        const uint8_t *record = table.records + mid * recordSize;
+        int order = memcmp(record, key, table.keyBytes);
+        if (order == 0)
+        {
+            uint32_t offset = 0;
+            for (size_t i = 0; i < OUI_OFFSET_BYTES; i++)
+            {
+                offset = (offset << 8) | record[table.keyBytes + i];
+            }
+            return OUI_VENDOR_POOL + offset;
+        }
+        if (order < 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return nullptr;
+}
 
 const char *lookupVendor(const uint8_t *mac)
 {
-    for (size_t i = 0; i < OUI_DATABASE_SIZE; i++)
+    // Locally administered: randomized (phones, VMs), never registered
+    if (mac[0] & 0x02)
+    {
+        return "Randomized";
+    }
+    for (const OuiTable &table : OUI_TABLES)
     {
-        if (memcmp(mac, OUI_DATABASE[i].oui, 3) == 0)
+        const char *vendor = searchOuiTable(table, mac);
+        if (vendor)
         {
-            return OUI_DATABASE[i].vendor;
+            return vendor;
         }
     }
     return "Unknown";
@@ -55,6 +100,9 @@ void NetworkScanner::init()
     scanProgress = 0;
     scanning = false;
     scanCancelled = false;
+    method = DiscoveryMethod::ARP;
+    knownHosts = nullptr;
+    knownCount = 0;
 }
 
 void NetworkScanner::formatMac(const uint8_t *mac, char *str)
@@ -97,56 +145,314 @@ int NetworkScanner::getSubnetSize() const
     return (1 << hostBits) - 2; // Minus network and broadcast addresses
 }
 
-bool NetworkScanner::arpProbe(IPAddress ip, uint8_t *mac, int timeoutMs)
+HostRange NetworkScanner::getLocalRange() const
 {
-    // Use ESP-IDF low-level ARP functionality
-    ip4_addr_t ipaddr;
-    IP4_ADDR(&ipaddr, ip[0], ip[1], ip[2], ip[3]);
+    IPAddress ip = WiFi.localIP();
+    HostRange range = subnetHostRange(ip, WiFi.subnetMask());
+    if (range.size() > NETWORK_SCAN_MAX_HOSTS)
+    {
+        // Wider than a /16: sweep the /16 around our own address
+        range = range.intersect(subnetHostRange(ip, IPAddress(255, 255, 0, 0)));
+    }
+    return range;
+}
 
-    // Try to find in ARP cache first
-    struct eth_addr *eth_ret;
-    const ip4_addr_t *ip_ret;
+// ============================================================================
+// ARP reply capture (station netif input hook)
+// ============================================================================
+// lwIP keeps about 10 ARP entries, so a fast sweep cannot rely on reading
+// replies back from the table: newer replies evict unread ones. While a
+// sweep runs, the station netif's input function is wrapped. ARP replies
+// are copied into a ring and every frame then continues to the stack
+// unchanged. The WiFi task is the only producer and the scan loop the only
+// consumer, so two indices are all the synchronization needed.
+
+struct CapturedArp
+{
+    uint32_t ip; // Network byte order
+    uint8_t mac[6];
+};
+
+static const size_t ETH_ARP_FRAME_SIZE = 42; // Ethernet header + ARP for IPv4
+
+static CapturedArp arpRing[ARP_CAPTURE_RING_SIZE];
+static std::atomic<uint32_t> arpRingHead(0); // Advanced by the input hook
+static std::atomic<uint32_t> arpRingTail(0); // Advanced by the scan loop
+static netif_input_fn stackInput = nullptr;
+
+static err_t arpCaptureInput(struct pbuf *p, struct netif *inp)
+{
+    const uint8_t *frame = (const uint8_t *)p->payload;
 
-    // Get network interface
+    // EtherType ARP, Ethernet/IPv4, opcode reply
+    if (p->len >= ETH_ARP_FRAME_SIZE && frame[12] == 0x08 && frame[13] == 0x06 &&
+        frame[14] == 0x00 && frame[15] == 0x01 && frame[16] == 0x08 && frame[17] == 0x00 &&
+        frame[20] == 0x00 && frame[21] == 0x02)
+    {
+        uint32_t head = arpRingHead.load(std::memory_order_relaxed);
+        if (head - arpRingTail.load(std::memory_order_acquire) < ARP_CAPTURE_RING_SIZE)
+        {
+            CapturedArp &slot = arpRing[head % ARP_CAPTURE_RING_SIZE];
+            memcpy(&slot.ip, frame + 28, 4);  // Sender protocol address
+            memcpy(slot.mac, frame + 22, 6);  // Sender hardware address
+            arpRingHead.store(head + 1, std::memory_order_release);
+        }
+    }
+    return stackInput(p, inp);
+}
+
+static void startArpCapture(struct netif *netif)
+{
+    if (netif->input == arpCaptureInput)
+    {
+        return;
+    }
+    arpRingTail.store(arpRingHead.load(std::memory_order_acquire), std::memory_order_release);
+    stackInput = netif->input;
+    netif->input = arpCaptureInput;
+}
+
+static void stopArpCapture(struct netif *netif)
+{
+    if (netif->input == arpCaptureInput)
+    {
+        netif->input = stackInput;
+    }
+}
+
+static bool takeCapturedArp(CapturedArp &out)
+{
+    uint32_t tail = arpRingTail.load(std::memory_order_relaxed);
+    if (tail == arpRingHead.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    out = arpRing[tail % ARP_CAPTURE_RING_SIZE];
+    arpRingTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// ============================================================================
+// Network sweep
+// ============================================================================
+
+// First interface that is up with an address (the WiFi station)
+struct netif *NetworkScanner::findStationNetif()
+{
     struct netif *netif = netif_list;
     while (netif != nullptr)
     {
         if (netif_is_up(netif) && !ip4_addr_isany(netif_ip4_addr(netif)))
         {
-            break;
+            return netif;
         }
         netif = netif->next;
     }
+    return nullptr;
+}
 
-    if (netif == nullptr)
+void NetworkScanner::sendArpRequest(struct netif *netif, IPAddress ip)
+{
+    ip4_addr_t ipaddr;
+    IP4_ADDR(&ipaddr, ip[0], ip[1], ip[2], ip[3]);
+    etharp_request(netif, &ipaddr);
+}
+
+bool NetworkScanner::findArpEntry(struct netif *netif, IPAddress ip, uint8_t *mac)
+{
+    ip4_addr_t ipaddr;
+    IP4_ADDR(&ipaddr, ip[0], ip[1], ip[2], ip[3]);
+
+    struct eth_addr *eth_ret;
+    const ip4_addr_t *ip_ret;
+    int8_t idx = etharp_find_addr(netif, &ipaddr, &eth_ret, &ip_ret);
+    if (idx >= 0 && eth_ret != nullptr)
+    {
+        memcpy(mac, eth_ret->addr, 6);
+        return true;
+    }
+    return false;
+}
+
+bool NetworkScanner::reserveRecord()
+{
+    if (deviceCount < recordCapacity)
+    {
+        return true;
+    }
+    if (recordCapacity >= MAX_DEVICES)
     {
         return false;
     }
 
-    // Send ARP request
-    etharp_request(netif, &ipaddr);
+    // Grow geometrically; a /16 with many hosts never needs one big block up front
+    int capacity = recordCapacity ? recordCapacity * 2 : DEVICE_RECORDS_INITIAL;
+    if (capacity > MAX_DEVICES)
+    {
+        capacity = MAX_DEVICES;
+    }
+    DeviceRecord *grown = (DeviceRecord *)realloc(records, capacity * sizeof(DeviceRecord));
+    if (!grown)
+    {
+        return false;
+    }
+    records = grown;
+    recordCapacity = capacity;
+    return true;
+}
 
-    // Wait for response
-    unsigned long startTime = millis();
-    while (millis() - startTime < (unsigned long)timeoutMs)
+void NetworkScanner::fillDevice(const DeviceRecord &record, NetworkDevice &dev)
+{
+    static const uint8_t NO_MAC[6] = {0};
+
+    dev.valid = true;
+    dev.ip = fromHostOrder(record.ip);
+    memcpy(dev.mac, record.mac, 6);
+    dev.hasMac = memcmp(record.mac, NO_MAC, 6) != 0;
+    dev.rttMs = record.rttMs == RTT_UNKNOWN ? -1 : record.rttMs;
+    if (dev.hasMac)
     {
-        delay(5);
-        yield();
+        formatMac(record.mac, dev.macStr);
+    }
+    else
+    {
+        dev.macStr[0] = '\0';
+    }
+
+    const char *vendor = dev.hasMac ? lookupVendor(record.mac) : "Unknown";
+    strncpy(dev.vendor, vendor, sizeof(dev.vendor) - 1);
+    dev.vendor[sizeof(dev.vendor) - 1] = '\0';
 
-        // Check ARP table
-        int8_t idx = etharp_find_addr(netif, &ipaddr, &eth_ret, &ip_ret);
-        if (idx >= 0 && eth_ret != nullptr)
+    const PassiveHost *heard = passiveListener.findHost(record.ip);
+    strncpy(dev.hostname, heard ? heard->name : "", sizeof(dev.hostname) - 1);
+    dev.hostname[sizeof(dev.hostname) - 1] = '\0';
+}
+
+void NetworkScanner::addDevice(uint32_t ip, const uint8_t *mac, uint16_t rttMs, DeviceFoundCallback callback)
+{
+    if (!reserveRecord())
+    {
+        if (!deviceTableFull)
         {
-            memcpy(mac, eth_ret->addr, 6);
-            return true;
+            Serial.printf("[NetScan] Device table full (%d), not keeping more\n", deviceCount);
+            deviceTableFull = true;
         }
+        return;
     }
 
+    DeviceRecord &record = records[deviceCount];
+    record.ip = ip;
+    memcpy(record.mac, mac, 6);
+    record.rttMs = rttMs;
+    deviceCount++;
+
+    NetworkDevice dev;
+    fillDevice(record, dev);
+
+    if (dev.rttMs >= 0)
+    {
+        Serial.printf("[NetScan] Found: %s - %s (%s) %d ms\n", dev.ip.toString().c_str(),
+                      dev.hasMac ? dev.macStr : "no MAC", dev.vendor, dev.rttMs);
+    }
+    else
+    {
+        Serial.printf("[NetScan] Found: %s - %s (%s)\n",
+                      dev.ip.toString().c_str(), dev.macStr, dev.vendor);
+    }
+
+    if (callback)
+    {
+        callback(dev);
+    }
+}
+
+int NetworkScanner::findRecord(uint32_t ip, int count) const
+{
+    int low = 0;
+    int high = count;
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        if (records[mid].ip == ip)
+        {
+            return mid;
+        }
+        if (records[mid].ip < ip)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+bool NetworkScanner::isKnownHost(uint32_t ip) const
+{
+    int low = 0;
+    int high = knownCount;
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        if (knownHosts[mid] == ip)
+        {
+            return true;
+        }
+        if (knownHosts[mid] < ip)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
     return false;
 }
 
+static int compareRecords(const void *a, const void *b)
+{
+    uint32_t ipA = *(const uint32_t *)a;
+    uint32_t ipB = *(const uint32_t *)b;
+    return ipA < ipB ? -1 : (ipA > ipB ? 1 : 0);
+}
+
+void NetworkScanner::sortRecords()
+{
+    // Replies arrive in any order; keep the device list in address order
+    if (deviceCount > 1)
+    {
+        qsort(records, deviceCount, sizeof(DeviceRecord), compareRecords);
+    }
+}
+
+void NetworkScanner::reportProgress(int finished)
+{
+    scanProgress = sweepSize > 0 ? (int)(((long)finished * 100) / sweepSize) : 100;
+    if (progressCallback && scanProgress != lastReported)
+    {
+        lastReported = scanProgress;
+        progressCallback(scanProgress, deviceCount);
+    }
+}
+
 int NetworkScanner::scanNetwork(DeviceFoundCallback callback,
                                 NetworkProgressCallback progressCb)
+{
+    return scanRange(getLocalRange(), callback, progressCb);
+}
+
+static IcmpProber echoProber;
+
+static int sweepCount(const HostRange &range, uint32_t self)
+{
+    return range.isEmpty() ? 0 : (int)range.size() - (range.contains(self) ? 1 : 0);
+}
+
+int NetworkScanner::scanRange(const HostRange &requested, DeviceFoundCallback callback,
+                              NetworkProgressCallback progressCb)
 {
     if (WiFi.status() != WL_CONNECTED)
     {
@@ -154,107 +460,430 @@ int NetworkScanner::scanNetwork(DeviceFoundCallback callback,
         return -1;
     }
 
+    struct netif *netif = findStationNetif();
+    if (netif == nullptr)
+    {
+        Serial.println("[NetScan] No station interface!");
+        return -1;
+    }
+
+    // ARP only reaches the local link; echo requests are routed
+    HostRange arpRange;
+    HostRange icmpRange;
+    if (method != DiscoveryMethod::ICMP)
+    {
+        arpRange = requested.intersect(getLocalRange());
+    }
+    if (method != DiscoveryMethod::ARP)
+    {
+        icmpRange = requested;
+    }
+    if (arpRange.isEmpty() && icmpRange.isEmpty())
+    {
+        Serial.println("[NetScan] Target is outside the local subnet");
+        return -1;
+    }
+
+    if (!icmpRange.isEmpty() && !echoProber.begin())
+    {
+        if (arpRange.isEmpty())
+        {
+            Serial.println("[NetScan] No raw ICMP socket - cannot ping");
+            return -1;
+        }
+        Serial.println("[NetScan] No raw ICMP socket - ARP only");
+        icmpRange = HostRange();
+    }
+
     Serial.println("[NetScan] Starting network scan...");
 
     scanning = true;
     scanCancelled = false;
     deviceCount = 0;
+    deviceTableFull = false;
     scanProgress = 0;
+    progressCallback = progressCb;
+    lastReported = -1;
 
     IPAddress myIP = WiFi.localIP();
-    IPAddress netAddr = getNetworkAddress();
-    IPAddress bcastAddr = getBroadcastAddress();
-    int subnetSize = getSubnetSize();
+    uint32_t self = toHostOrder(myIP);
+    sweepSize = sweepCount(arpRange, self) + sweepCount(icmpRange, self);
 
     Serial.printf("[NetScan] Local IP: %s\n", myIP.toString().c_str());
-    Serial.printf("[NetScan] Network: %s\n", netAddr.toString().c_str());
-    Serial.printf("[NetScan] Broadcast: %s\n", bcastAddr.toString().c_str());
-    Serial.printf("[NetScan] Subnet size: %d hosts\n", subnetSize);
+    Serial.printf("[NetScan] Network: %s\n", getNetworkAddress().toString().c_str());
+
+    // Hosts the passive listener resolved and heard from lately are reported
+    // up front; the ARP sweep only probes the gaps between them. A delta
+    // (known hosts set) probes them all the same: it has to tell a device
+    // that left from one that was only heard before it did.
+    int heardCount = 0;
+    unsigned long now = millis();
+    for (int i = 0; i < passiveListener.getHostCount() && knownCount == 0; i++)
+    {
+        const PassiveHost *heard = passiveListener.getHost(i);
+        if (heard->hasMac && requested.contains(heard->ip) && heard->ip != self &&
+            now - heard->lastSeenMs < PASSIVE_TRUST_MS)
+        {
+            addDevice(heard->ip, heard->mac, RTT_UNKNOWN, callback);
+            heardCount++;
+        }
+    }
+    if (heardCount > 0)
+    {
+        Serial.printf("[NetScan] %d hosts known from passive discovery\n", heardCount);
+    }
+
+    int finished = 0;
+    bool ok = true;
+    if (!arpRange.isEmpty())
+    {
+        ok = arpSweep(netif, arpRange, self, callback, finished);
+    }
+    if (ok && !icmpRange.isEmpty() && !scanCancelled)
+    {
+        sortRecords();
+        icmpSweep(netif, icmpRange, self, callback, finished);
+    }
+    echoProber.end();
+
+    sortRecords();
+
+    scanProgress = 100;
+    scanning = false;
+    if (!ok)
+    {
+        return -1;
+    }
+    if (progressCb)
+    {
+        progressCb(100, deviceCount);
+    }
 
-    int scannedCount = 0;
-    int lastReported = -1;
+    Serial.printf("[NetScan] Scan complete. Found %d devices.\n", deviceCount);
+
+    return deviceCount;
+}
 
-    // Scan all addresses in subnet
-    for (int lastOctet = 1; lastOctet < 255 && !scanCancelled; lastOctet++)
+bool NetworkScanner::arpSweep(struct netif *netif, const HostRange &range, uint32_t self,
+                              DeviceFoundCallback callback, int &finished)
+{
+    // One bit per address: replied (late replies and retries check it)
+    size_t answeredWords = (range.size() + 31) / 32;
+    uint32_t *answered = (uint32_t *)calloc(answeredWords, sizeof(uint32_t));
+    if (!answered)
     {
-        IPAddress targetIP(netAddr[0], netAddr[1], netAddr[2], lastOctet);
+        Serial.println("[NetScan] Allocation failed");
+        return false;
+    }
+
+    Serial.printf("[NetScan] ARP sweep: %s - %s (%d hosts)\n",
+                  fromHostOrder(range.first).toString().c_str(),
+                  fromHostOrder(range.last).toString().c_str(), sweepCount(range, self));
 
-        // Skip our own IP
-        if (targetIP == myIP)
+    // Passively heard hosts are already reported
+    for (int i = 0; i < deviceCount; i++)
+    {
+        if (range.contains(records[i].ip))
         {
-            scannedCount++;
-            continue;
+            uint32_t index = records[i].ip - range.first;
+            answered[index / 32] |= 1u << (index % 32);
+            finished++;
         }
+    }
 
-        // Update progress
-        scanProgress = (scannedCount * 100) / 254;
-        if (progressCb && scanProgress != lastReported)
+    // Burst sweep: fresh addresses stream from the iterator ARP_BURST_SIZE
+    // per tick, and replies captured on the input path are matched on every
+    // tick. An address that stays silent for ARP_TIMEOUT_MS is queued for a
+    // retry, which goes out ahead of fresh addresses. A request only moves
+    // between the in-flight table and the retry queue, so together they
+    // never hold more than ARP_MAX_IN_FLIGHT entries.
+    //
+    // With known hosts set (network_delta), those go out first with the
+    // full ARP_RETRIES; the addresses between them are only confirmed empty
+    // with DELTA_UNKNOWN_ATTEMPTS, since a newcomer usually announces itself
+    // (DHCP, gratuitous ARP) and is caught by the next delta if it missed one.
+    // Addresses the passive listener heard from keep the full retries too.
+    struct ArpAttempt
+    {
+        uint32_t ip;
+        uint8_t attempts;
+        uint8_t maxAttempts;
+        unsigned long sentAt;
+    };
+    ArpAttempt pending[ARP_MAX_IN_FLIGHT];
+    ArpAttempt retries[ARP_MAX_IN_FLIGHT];
+    int inFlight = 0;
+    int retryHead = 0;
+    int retryCount = 0;
+    int knownNext = 0;
+    uint8_t freshAttempts = knownCount > 0 ? DELTA_UNKNOWN_ATTEMPTS : ARP_RETRIES;
+
+    HostIterator hosts;
+    hosts.begin(range, self);
+
+    startArpCapture(netif);
+
+    while ((!hosts.done() || retryCount > 0 || inFlight > 0) && !scanCancelled)
+    {
+        // Paced burst: retries first, then known hosts, then fresh addresses
+        for (int sent = 0; sent < ARP_BURST_SIZE && inFlight < ARP_MAX_IN_FLIGHT; sent++)
         {
-            lastReported = scanProgress;
-            progressCb(scanProgress, deviceCount);
+            ArpAttempt attempt;
+            if (retryCount > 0)
+            {
+                attempt = retries[retryHead];
+                retryHead = (retryHead + 1) % ARP_MAX_IN_FLIGHT;
+                retryCount--;
+                uint32_t index = attempt.ip - range.first;
+                if (answered[index / 32] & (1u << (index % 32)))
+                {
+                    finished++; // Late reply to the earlier attempt
+                    continue;
+                }
+            }
+            else if (knownNext < knownCount)
+            {
+                attempt.ip = knownHosts[knownNext++];
+                if (!range.contains(attempt.ip) || attempt.ip == self)
+                {
+                    continue;
+                }
+                uint32_t index = attempt.ip - range.first;
+                if (answered[index / 32] & (1u << (index % 32)))
+                {
+                    continue; // Reported from passive discovery
+                }
+                attempt.attempts = 0;
+                attempt.maxAttempts = ARP_RETRIES;
+            }
+            else if (hosts.next(attempt.ip))
+            {
+                uint32_t index = attempt.ip - range.first;
+                if (answered[index / 32] & (1u << (index % 32)) || isKnownHost(attempt.ip))
+                {
+                    continue; // Reported from passive discovery, or probed above
+                }
+                attempt.attempts = 0;
+                attempt.maxAttempts = passiveListener.findHost(attempt.ip) ? ARP_RETRIES : freshAttempts;
+            }
+            else
+            {
+                break;
+            }
+
+            sendArpRequest(netif, fromHostOrder(attempt.ip));
+            attempt.attempts++;
+            attempt.sentAt = millis();
+            pending[inFlight++] = attempt;
         }
 
-        uint8_t mac[6] = {0};
-        bool found = false;
+        delay(ARP_POLL_MS);
+        yield(); // Prevent watchdog timeout
 
-        // Try ARP probe with retries
-        for (int retry = 0; retry < ARP_RETRIES && !found; retry++)
+        // Replies from the range, whichever attempt they answer
+        CapturedArp reply;
+        while (takeCapturedArp(reply))
         {
-            if (arpProbe(targetIP, mac, ARP_TIMEOUT_MS))
+            uint32_t ip = toHostOrder(IPAddress(reply.ip));
+            if (!range.contains(ip) || ip == self)
+            {
+                continue;
+            }
+            uint32_t index = ip - range.first;
+            if (answered[index / 32] & (1u << (index % 32)))
             {
-                found = true;
+                continue;
             }
+            answered[index / 32] |= 1u << (index % 32);
+            addDevice(ip, reply.mac, RTT_UNKNOWN, callback);
         }
 
-        if (found && deviceCount < MAX_DEVICES)
+        // Retire answered requests; expire the silent
+        unsigned long now = millis();
+        for (int i = 0; i < inFlight;)
         {
-            NetworkDevice &dev = devices[deviceCount];
-            dev.valid = true;
-            dev.ip = targetIP;
-            memcpy(dev.mac, mac, 6);
-            formatMac(mac, dev.macStr);
+            ArpAttempt &attempt = pending[i];
+            uint32_t index = attempt.ip - range.first;
 
-            const char *vendor = lookupVendor(mac);
-            strncpy(dev.vendor, vendor, sizeof(dev.vendor) - 1);
-            dev.vendor[sizeof(dev.vendor) - 1] = '\0';
+            if (!(answered[index / 32] & (1u << (index % 32))))
+            {
+                if (now - attempt.sentAt < (unsigned long)ARP_TIMEOUT_MS)
+                {
+                    i++;
+                    continue;
+                }
+
+                // The table still catches a reply the hook could not see
+                // (e.g. one that arrived before the sweep started)
+                uint8_t mac[6];
+                if (findArpEntry(netif, fromHostOrder(attempt.ip), mac))
+                {
+                    answered[index / 32] |= 1u << (index % 32);
+                    addDevice(attempt.ip, mac, RTT_UNKNOWN, callback);
+                }
+                else if (attempt.attempts < attempt.maxAttempts)
+                {
+                    retries[(retryHead + retryCount) % ARP_MAX_IN_FLIGHT] = attempt;
+                    retryCount++;
+                    pending[i] = pending[--inFlight];
+                    continue;
+                }
+            }
+
+            finished++;
+            pending[i] = pending[--inFlight]; // slot i now holds the last request
+        }
+
+        reportProgress(finished);
+    }
 
-            Serial.printf("[NetScan] Found: %s - %s (%s)\n",
-                          targetIP.toString().c_str(), dev.macStr, dev.vendor);
+    stopArpCapture(netif);
+    free(answered);
+    return true;
+}
 
-            if (callback)
+void NetworkScanner::icmpSweep(struct netif *netif, const HostRange &range, uint32_t self,
+                               DeviceFoundCallback callback, int &finished)
+{
+    Serial.printf("[NetScan] ICMP sweep: %s - %s (%d hosts)\n",
+                  fromHostOrder(range.first).toString().c_str(),
+                  fromHostOrder(range.last).toString().c_str(), sweepCount(range, self));
+
+    // Records so far (passive and ARP finds) are sorted. An echo from one of
+    // them only adds its RTT; any other sender is a new device.
+    int known = deviceCount;
+    HostRange local = getLocalRange();
+    int replied = 0;
+
+    // Same pacing as the ARP sweep. Every request (retries included) has
+    // its own sequence number, so each reply times exactly one request.
+    struct EchoRetry
+    {
+        uint32_t ip; // Network byte order
+        uint8_t attempt;
+    };
+    EchoRetry retries[ICMP_MAX_IN_FLIGHT];
+    int retryHead = 0;
+    int retryCount = 0;
+    IcmpEcho echoes[ICMP_MAX_IN_FLIGHT];
+
+    HostIterator hosts;
+    hosts.begin(range, self);
+
+    while ((!hosts.done() || retryCount > 0 || echoProber.pendingCount() > 0) && !scanCancelled)
+    {
+        // Paced burst: retries first, then fresh addresses
+        for (int sent = 0; sent < ICMP_BURST_SIZE && echoProber.hasRoom(); sent++)
+        {
+            EchoRetry request;
+            uint32_t fresh;
+            if (retryCount > 0)
+            {
+                request = retries[retryHead];
+                retryHead = (retryHead + 1) % ICMP_MAX_IN_FLIGHT;
+                retryCount--;
+            }
+            else if (hosts.next(fresh))
             {
-                callback(dev);
+                request.ip = (uint32_t)fromHostOrder(fresh);
+                request.attempt = 0;
+            }
+            else
+            {
+                break;
             }
 
-            deviceCount++;
+            if (!echoProber.send(request.ip, request.attempt))
+            {
+                // Refused by the stack (no pbufs or no route): the attempt is spent
+                if (request.attempt + 1 < ICMP_RETRIES)
+                {
+                    request.attempt++;
+                    retries[(retryHead + retryCount) % ICMP_MAX_IN_FLIGHT] = request;
+                    retryCount++;
+                }
+                else
+                {
+                    finished++;
+                }
+            }
         }
 
-        scannedCount++;
+        delay(ICMP_POLL_MS);
         yield(); // Prevent watchdog timeout
-    }
 
-    scanProgress = 100;
-    scanning = false;
-    if (progressCb)
-    {
-        progressCb(100, deviceCount);
+        int count = echoProber.receive(echoes, ICMP_MAX_IN_FLIGHT, 0);
+        for (int i = 0; i < count; i++)
+        {
+            uint32_t ip = toHostOrder(IPAddress(echoes[i].ip));
+            uint16_t rttMs = echoes[i].rttMs < RTT_UNKNOWN ? (uint16_t)echoes[i].rttMs : RTT_UNKNOWN - 1;
+            finished++;
+            replied++;
+
+            int index = findRecord(ip, known);
+            if (index >= 0)
+            {
+                records[index].rttMs = rttMs;
+                continue;
+            }
+
+            // An on-link host was ARP-resolved for the request to go out
+            uint8_t mac[6] = {0};
+            if (local.contains(ip))
+            {
+                findArpEntry(netif, fromHostOrder(ip), mac);
+            }
+            addDevice(ip, mac, rttMs, callback);
+        }
+
+        uint32_t expired;
+        uint8_t attempt;
+        while (echoProber.takeExpired(ICMP_TIMEOUT_MS, expired, attempt))
+        {
+            if (attempt + 1 < ICMP_RETRIES)
+            {
+                retries[(retryHead + retryCount) % ICMP_MAX_IN_FLIGHT] = {expired, (uint8_t)(attempt + 1)};
+                retryCount++;
+            }
+            else
+            {
+                finished++;
+            }
+        }
+
+        reportProgress(finished);
     }
 
-    Serial.printf("[NetScan] Scan complete. Found %d devices.\n", deviceCount);
+    Serial.printf("[NetScan] Echo replies from %d hosts\n", replied);
+}
 
-    return deviceCount;
+bool NetworkScanner::getRtt(const IPAddress &ip, uint32_t &rttMs) const
+{
+    // Records are only sorted between scans
+    if (scanning)
+    {
+        return false;
+    }
+    int index = findRecord(toHostOrder(ip), deviceCount);
+    if (index < 0 || records[index].rttMs == RTT_UNKNOWN)
+    {
+        return false;
+    }
+    rttMs = records[index].rttMs;
+    return true;
 }
 
 NetworkDevice NetworkScanner::getDevice(int index) const
 {
+    NetworkDevice dev;
     if (index >= 0 && index < deviceCount)
     {
-        return devices[index];
+        fillDevice(records[index], dev);
+        return dev;
     }
 
-    NetworkDevice empty;
-    memset(&empty, 0, sizeof(empty));
-    empty.valid = false;
-    empty.ip = IPAddress();
-    return empty;
+    memset(&dev, 0, sizeof(dev));
+    dev.valid = false;
+    dev.ip = IPAddress();
+    return dev;
 }
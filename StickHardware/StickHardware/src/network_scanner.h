@@ -5,17 +5,29 @@
 #include <lwip/etharp.h>
 #include <lwip/netif.h>
 #include "config.h"
+#include "host_range.h"
 
 // ============================================================================
-// Network Scanner - ARP scanning and device discovery
+// Network Scanner - ARP and ICMP echo sweeps, device discovery
 // ============================================================================
 
+// How a sweep finds hosts
+enum class DiscoveryMethod : uint8_t
+{
+    ARP,   // Broadcast ARP over the local link: MACs, no RTT
+    ICMP,  // Echo requests: reaches routed ranges and measures RTT
+    BOTH   // ARP first, then echo every address for RTTs and ARP-silent hosts
+};
+
 struct NetworkDevice
 {
     IPAddress ip;
     uint8_t mac[6];
-    char macStr[18];
+    char macStr[18];                  // Empty when the MAC is unknown (routed host)
     char vendor[32];
+    char hostname[PASSIVE_NAME_SIZE]; // Heard passively (mDNS, NetBIOS, DHCP); may be empty
+    bool hasMac;
+    int rttMs;                        // Echo round trip, -1 if the host was not pinged
     bool valid;
 };
 
@@ -26,7 +38,8 @@ typedef void (*DeviceFoundCallback)(const NetworkDevice &device);
 typedef void (*NetworkProgressCallback)(int percent, int devicesFound);
 
 // OUI (Organizationally Unique Identifier) lookup
-// Returns vendor name based on MAC address prefix
+// Returns vendor name based on MAC address prefix (MA-S, MA-M, then MA-L);
+// "Randomized" for locally administered addresses, else "Unknown"
 const char *lookupVendor(const uint8_t *mac);
 
 class NetworkScanner
@@ -41,32 +54,97 @@ public:
     int scanNetwork(DeviceFoundCallback callback = nullptr,
                     NetworkProgressCallback progressCb = nullptr);
 
-    // Get scan results
+    // Scan a range. ARP clips it to the local subnet (-1 if nothing is
+    // left); ICMP echo also reaches routed addresses.
+    int scanRange(const HostRange &range, DeviceFoundCallback callback = nullptr,
+                  NetworkProgressCallback progressCb = nullptr);
+
+    // Discovery method for the next scan (init() resets it to ARP)
+    void setMethod(DiscoveryMethod value) { method = value; }
+    DiscoveryMethod getMethod() const { return method; }
+
+    // Addresses the ARP pass probes first with full retries (sorted, host
+    // order, unique; the caller keeps them alive through the scan). Every
+    // other address then gets DELTA_UNKNOWN_ATTEMPTS. Cleared by init().
+    void setKnownHosts(const uint32_t *ips, int count)
+    {
+        knownHosts = ips;
+        knownCount = count;
+    }
+
+    // Get scan results (sorted by address once the scan completes)
     int getDeviceCount() const { return deviceCount; }
     NetworkDevice getDevice(int index) const;
 
+    // Echo RTT measured for ip by the last scan; false if it was not pinged
+    bool getRtt(const IPAddress &ip, uint32_t &rttMs) const;
+
     // Get subnet info from current connection
     IPAddress getNetworkAddress() const;
     IPAddress getBroadcastAddress() const;
     int getSubnetSize() const;
 
+    // Host addresses scanNetwork() covers: the subnet, at most the /16 around us
+    HostRange getLocalRange() const;
+
+    // Probes sent by the last scan: one per address and pass (ARP, echo)
+    int getSweepSize() const { return sweepSize; }
+
     // Progress tracking
     int getScanProgress() const { return scanProgress; }
     bool isScanning() const { return scanning; }
 
     // Cancel ongoing scan
     void cancelScan() { scanCancelled = true; }
+    bool wasCancelled() const { return scanCancelled; }
+
+    // Link-layer helpers, shared with the passive listener (never block)
+    static struct netif *findStationNetif();
+    static void sendArpRequest(struct netif *netif, IPAddress ip);
+    static bool findArpEntry(struct netif *netif, IPAddress ip, uint8_t *mac);
 
 private:
     static const int MAX_DEVICES = MAX_DEVICES_IN_SCAN;
-    NetworkDevice devices[MAX_DEVICES];
+    static const int DEVICE_RECORDS_INITIAL = 64;
+
+    static const uint16_t RTT_UNKNOWN = 0xFFFF;
+
+    // Compact per-device record; getDevice() rebuilds the display fields
+    struct DeviceRecord
+    {
+        uint32_t ip; // Host byte order (sorts numerically)
+        uint8_t mac[6]; // All zero if unknown
+        uint16_t rttMs; // RTT_UNKNOWN until an echo comes back
+    };
+    DeviceRecord *records = nullptr; // Heap, grown on demand up to MAX_DEVICES
+    int recordCapacity = 0;
     int deviceCount = 0;
+    bool deviceTableFull = false;
+    int sweepSize = 0;
     int scanProgress = 0;
     bool scanning = false;
     bool scanCancelled = false;
-
-    // Send ARP request and wait for reply
-    bool arpProbe(IPAddress ip, uint8_t *mac, int timeoutMs = ARP_TIMEOUT_MS);
+    DiscoveryMethod method = DiscoveryMethod::ARP;
+    const uint32_t *knownHosts = nullptr;
+    int knownCount = 0;
+
+    // Progress across both passes of a scan
+    NetworkProgressCallback progressCallback = nullptr;
+    int lastReported = -1;
+
+    bool reserveRecord();
+    void addDevice(uint32_t ip, const uint8_t *mac, uint16_t rttMs, DeviceFoundCallback callback);
+    int findRecord(uint32_t ip, int count) const; // Among the first count (sorted) records
+    bool isKnownHost(uint32_t ip) const;
+    static void fillDevice(const DeviceRecord &record, NetworkDevice &dev);
+    void sortRecords();
+    void reportProgress(int finished);
+
+    // Sweep passes; finished counts addresses settled so far
+    bool arpSweep(struct netif *netif, const HostRange &range, uint32_t self,
+                  DeviceFoundCallback callback, int &finished);
+    void icmpSweep(struct netif *netif, const HostRange &range, uint32_t self,
+                   DeviceFoundCallback callback, int &finished);
 
     // Format MAC address to string
     static void formatMac(const uint8_t *mac, char *str);
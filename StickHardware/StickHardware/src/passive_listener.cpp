@@ -0,0 +1,534 @@
+#include "passive_listener.h"
+#include "network_scanner.h"
+#include "dns_message.h"
+#include <lwip/sockets.h>
+#include <string.h>
+#include <strings.h>
+
+// ============================================================================
+// Passive Listener - Implementation
+// ============================================================================
+
+PassiveListener passiveListener;
+
+static const unsigned long RESTART_BACKOFF_MS = 5000;  // After begin() found no sockets
+static const int DATAGRAMS_PER_POLL = 8;               // Per channel, keeps poll() short
+static const int ARP_REQUESTS_PER_TICK = 4;            // Stays inside lwIP's ~10-entry ARP table
+
+static const uint8_t NBNS_OPCODE_REGISTRATION = 5;
+static const uint8_t NBNS_OPCODE_RELEASE = 6;
+static const uint8_t NBNS_OPCODE_REFRESH = 8;
+static const uint8_t NBNS_OPCODE_REFRESH_ALT = 9;  // Refresh as sent by Windows
+
+static const uint8_t DHCP_OPTION_HOSTNAME = 12;
+static const uint8_t DHCP_OPTION_REQUESTED_IP = 50;
+static const uint8_t DHCP_OPTION_MESSAGE_TYPE = 53;
+static const uint8_t DHCP_REQUEST = 3;
+static const uint8_t DHCP_DECLINE = 4;
+static const uint8_t DHCP_RELEASE = 7;
+
+static uint8_t datagram[1472]; // One Ethernet MTU of UDP payload
+static unsigned long lastStartAttemptMs = 0;
+
+static inline uint32_t readBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Higher wins when two protocols name the same host
+static uint8_t nameRank(uint8_t source)
+{
+    switch (source)
+    {
+    case PASSIVE_DHCP:
+        return 3;
+    case PASSIVE_MDNS:
+        return 2;
+    case PASSIVE_NBNS:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// Sockets
+// ============================================================================
+
+int PassiveListener::openChannel(uint16_t port, const char *group)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    // Share 5353/1900 with other responders; accept broadcasts on 67/137
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &on, sizeof(on));
+
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (struct sockaddr *)&local, sizeof(local)) < 0)
+    {
+        Serial.printf("[Passive] Cannot bind port %u\n", port);
+        close(fd);
+        return -1;
+    }
+
+    if (group)
+    {
+        struct ip_mreq membership;
+        membership.imr_multiaddr.s_addr = inet_addr(group);
+        membership.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0)
+        {
+            Serial.printf("[Passive] Cannot join %s\n", group);
+        }
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    return fd;
+}
+
+bool PassiveListener::begin()
+{
+    if (running)
+    {
+        return true;
+    }
+    if (WiFi.status() != WL_CONNECTED ||
+        (lastStartAttemptMs != 0 && millis() - lastStartAttemptMs < RESTART_BACKOFF_MS))
+    {
+        return false;
+    }
+    lastStartAttemptMs = millis();
+
+    IPAddress ip = WiFi.localIP();
+    HostRange range = subnetHostRange(ip, WiFi.subnetMask());
+    if (range.first != subnet.first || range.last != subnet.last)
+    {
+        hostCount = 0; // Another network: what we heard no longer applies
+        subnet = range;
+    }
+    self = toHostOrder(ip);
+
+    fds[CHANNEL_MDNS] = openChannel(5353, "224.0.0.251");
+    fds[CHANNEL_SSDP] = openChannel(1900, "239.255.255.250");
+    fds[CHANNEL_NBNS] = openChannel(137, nullptr);
+    fds[CHANNEL_DHCP] = openChannel(67, nullptr);
+
+    int opened = 0;
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        if (fds[i] >= 0)
+        {
+            opened++;
+        }
+    }
+    if (opened == 0)
+    {
+        Serial.println("[Passive] No sockets available");
+        return false;
+    }
+
+    running = true;
+    lastStartAttemptMs = 0;
+    lastMaintenanceMs = millis();
+    Serial.printf("[Passive] Listening on %d/%d channels (%d hosts known)\n",
+                  opened, CHANNEL_COUNT, hostCount);
+    return true;
+}
+
+void PassiveListener::stop()
+{
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        if (fds[i] >= 0)
+        {
+            close(fds[i]);
+            fds[i] = -1;
+        }
+    }
+    running = false;
+}
+
+void PassiveListener::poll()
+{
+    if (!running)
+    {
+        return;
+    }
+
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    int maxFd = -1;
+    for (int i = 0; i < CHANNEL_COUNT; i++)
+    {
+        if (fds[i] >= 0)
+        {
+            FD_SET(fds[i], &readSet);
+            if (fds[i] > maxFd)
+            {
+                maxFd = fds[i];
+            }
+        }
+    }
+
+    struct timeval tv = {0, 0};
+    if (select(maxFd + 1, &readSet, nullptr, nullptr, &tv) > 0)
+    {
+        for (int i = 0; i < CHANNEL_COUNT; i++)
+        {
+            if (fds[i] >= 0 && FD_ISSET(fds[i], &readSet))
+            {
+                drain((Channel)i);
+            }
+        }
+    }
+
+    if (millis() - lastMaintenanceMs >= PASSIVE_MAINTENANCE_MS)
+    {
+        lastMaintenanceMs = millis();
+        maintain();
+    }
+}
+
+void PassiveListener::drain(Channel channel)
+{
+    for (int i = 0; i < DATAGRAMS_PER_POLL; i++)
+    {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int n = recvfrom(fds[channel], datagram, sizeof(datagram), MSG_DONTWAIT,
+                         (struct sockaddr *)&from, &fromLen);
+        if (n <= 0)
+        {
+            return;
+        }
+
+        uint32_t sender = ntohl(from.sin_addr.s_addr);
+        switch (channel)
+        {
+        case CHANNEL_MDNS:
+            handleMdns(datagram, n, sender);
+            break;
+        case CHANNEL_SSDP:
+            handleSsdp(datagram, n, sender);
+            break;
+        case CHANNEL_NBNS:
+            handleNbns(datagram, n, sender);
+            break;
+        case CHANNEL_DHCP:
+            handleDhcp(datagram, n); // Clients have no address yet; chaddr names them
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// ============================================================================
+// Protocol parsers
+// ============================================================================
+
+void PassiveListener::handleMdns(const uint8_t *data, size_t len, uint32_t from)
+{
+    DnsReader reader(data, len);
+    DnsHeader header;
+    if (!reader.readHeader(header))
+    {
+        return;
+    }
+
+    // Queries reveal the sender; responses also carry names
+    touch(from, PASSIVE_MDNS);
+    if (!header.isResponse())
+    {
+        return;
+    }
+
+    DnsRecord record;
+    for (int i = 0; i < header.questions; i++)
+    {
+        if (!reader.readQuestion(record))
+        {
+            return;
+        }
+    }
+
+    int records = header.answers + header.authorities + header.additionals;
+    for (int i = 0; i < records && reader.readRecord(record); i++)
+    {
+        size_t nameLength = strlen(record.name);
+        if (record.type != DNS_TYPE_A || record.dataLength != 4 || nameLength <= 6 ||
+            strcasecmp(record.name + nameLength - 6, ".local") != 0)
+        {
+            continue;
+        }
+        record.name[nameLength - 6] = '\0';
+
+        PassiveHost *host = touch(readBe32(data + record.dataOffset), PASSIVE_MDNS);
+        if (host)
+        {
+            setName(*host, record.name, PASSIVE_MDNS);
+        }
+    }
+}
+
+void PassiveListener::handleSsdp(const uint8_t *data, size_t len, uint32_t from)
+{
+    // Announcements, searches and unicast search replies all come from a host
+    static const char *const STARTS[] = {"NOTIFY ", "M-SEARCH ", "HTTP/1.1 200"};
+    for (const char *start : STARTS)
+    {
+        size_t startLength = strlen(start);
+        if (len >= startLength && memcmp(data, start, startLength) == 0)
+        {
+            touch(from, PASSIVE_SSDP);
+            return;
+        }
+    }
+}
+
+void PassiveListener::handleNbns(const uint8_t *data, size_t len, uint32_t from)
+{
+    DnsReader reader(data, len);
+    DnsHeader header;
+    if (!reader.readHeader(header))
+    {
+        return;
+    }
+
+    uint8_t opcode = header.opcode();
+    if (opcode == NBNS_OPCODE_RELEASE)
+    {
+        return; // Leaving; it will be forgotten once it stays silent
+    }
+    touch(from, PASSIVE_NBNS);
+    if (header.isResponse() || header.questions != 1 ||
+        (opcode != NBNS_OPCODE_REGISTRATION && opcode != NBNS_OPCODE_REFRESH &&
+         opcode != NBNS_OPCODE_REFRESH_ALT))
+    {
+        return;
+    }
+
+    DnsRecord question;
+    char name[16];
+    uint8_t suffix;
+    if (!reader.readQuestion(question) ||
+        !decodeNetbiosName(question.name, name, sizeof(name), suffix) ||
+        (suffix != 0x00 && suffix != 0x20)) // Workstation or file server name
+    {
+        return;
+    }
+
+    // The NB record holds flags (group bit first) and the registered address
+    DnsRecord record;
+    int records = header.answers + header.authorities + header.additionals;
+    for (int i = 0; i < records && reader.readRecord(record); i++)
+    {
+        if (record.type != DNS_TYPE_NB || record.dataLength < 6)
+        {
+            continue;
+        }
+        const uint8_t *rdata = data + record.dataOffset;
+        if (rdata[0] & 0x80)
+        {
+            return; // Group name (the workgroup), not the host's own
+        }
+        PassiveHost *host = touch(readBe32(rdata + 2), PASSIVE_NBNS);
+        if (host)
+        {
+            setName(*host, name, PASSIVE_NBNS);
+        }
+        return;
+    }
+}
+
+void PassiveListener::handleDhcp(const uint8_t *data, size_t len)
+{
+    // BOOTREQUEST over Ethernet with the DHCP magic cookie
+    static const uint8_t COOKIE[] = {99, 130, 83, 99};
+    if (len < 240 || data[0] != 1 || data[1] != 1 || data[2] != 6 ||
+        memcmp(data + 236, COOKIE, sizeof(COOKIE)) != 0)
+    {
+        return;
+    }
+
+    uint32_t ip = readBe32(data + 12); // ciaddr: renewing or informing clients
+    uint32_t requested = 0;
+    uint8_t messageType = 0;
+    char hostname[PASSIVE_NAME_SIZE] = "";
+
+    size_t i = 240;
+    while (i < len && data[i] != 255)
+    {
+        if (data[i] == 0)
+        {
+            i++; // Pad
+            continue;
+        }
+        if (i + 2 > len || i + 2 + data[i + 1] > len)
+        {
+            break;
+        }
+        uint8_t option = data[i];
+        uint8_t optionLength = data[i + 1];
+        const uint8_t *value = data + i + 2;
+
+        if (option == DHCP_OPTION_HOSTNAME)
+        {
+            size_t n = optionLength < sizeof(hostname) - 1 ? optionLength : sizeof(hostname) - 1;
+            for (size_t c = 0; c < n; c++)
+            {
+                hostname[c] = (value[c] >= 0x20 && value[c] < 0x7F) ? (char)value[c] : '?';
+            }
+            hostname[n] = '\0';
+        }
+        else if (option == DHCP_OPTION_REQUESTED_IP && optionLength == 4)
+        {
+            requested = readBe32(value);
+        }
+        else if (option == DHCP_OPTION_MESSAGE_TYPE && optionLength == 1)
+        {
+            messageType = value[0];
+        }
+        i += 2 + optionLength;
+    }
+
+    if (messageType == DHCP_RELEASE || messageType == DHCP_DECLINE)
+    {
+        return;
+    }
+    // A REQUEST names the address being taken; a DISCOVER only wishes for one
+    if (ip == 0 && messageType == DHCP_REQUEST)
+    {
+        ip = requested;
+    }
+
+    PassiveHost *host = touch(ip, PASSIVE_DHCP);
+    if (!host)
+    {
+        return;
+    }
+    memcpy(host->mac, data + 28, 6);
+    host->hasMac = true;
+    if (hostname[0])
+    {
+        setName(*host, hostname, PASSIVE_DHCP);
+    }
+}
+
+// ============================================================================
+// Host table
+// ============================================================================
+
+const PassiveHost *PassiveListener::getHost(int index) const
+{
+    if (index < 0 || index >= hostCount)
+    {
+        return nullptr;
+    }
+    return &hosts[index];
+}
+
+const PassiveHost *PassiveListener::findHost(uint32_t ip) const
+{
+    for (int i = 0; i < hostCount; i++)
+    {
+        if (hosts[i].ip == ip)
+        {
+            return &hosts[i];
+        }
+    }
+    return nullptr;
+}
+
+PassiveHost *PassiveListener::touch(uint32_t ip, uint8_t source)
+{
+    if (!subnet.contains(ip) || ip == self)
+    {
+        return nullptr;
+    }
+
+    PassiveHost *host = const_cast<PassiveHost *>(findHost(ip));
+    if (!host)
+    {
+        if (hostCount < PASSIVE_MAX_HOSTS)
+        {
+            host = &hosts[hostCount++];
+        }
+        else
+        {
+            // Full: replace the host heard from longest ago
+            host = &hosts[0];
+            for (int i = 1; i < hostCount; i++)
+            {
+                if (millis() - hosts[i].lastSeenMs > millis() - host->lastSeenMs)
+                {
+                    host = &hosts[i];
+                }
+            }
+        }
+        memset(host, 0, sizeof(PassiveHost));
+        host->ip = ip;
+        Serial.printf("[Passive] Heard %s\n", fromHostOrder(ip).toString().c_str());
+    }
+
+    host->sources |= source;
+    host->lastSeenMs = millis();
+    return host;
+}
+
+void PassiveListener::setName(PassiveHost &host, const char *name, uint8_t source)
+{
+    if (host.name[0] && nameRank(source) < nameRank(host.nameSource))
+    {
+        return;
+    }
+    strncpy(host.name, name, sizeof(host.name) - 1);
+    host.name[sizeof(host.name) - 1] = '\0';
+    host.nameSource = source;
+}
+
+// Expire silent hosts and resolve MACs for the new ones in the background
+void PassiveListener::maintain()
+{
+    unsigned long now = millis();
+    struct netif *netif = NetworkScanner::findStationNetif();
+    int requests = 0;
+
+    for (int i = 0; i < hostCount;)
+    {
+        PassiveHost &host = hosts[i];
+        if (now - host.lastSeenMs > PASSIVE_HOST_TTL_MS)
+        {
+            host = hosts[--hostCount];
+            continue;
+        }
+
+        if (!host.hasMac && netif != nullptr)
+        {
+            IPAddress ip = fromHostOrder(host.ip);
+            if (NetworkScanner::findArpEntry(netif, ip, host.mac))
+            {
+                host.hasMac = true;
+            }
+            else if (host.arpAttempts < PASSIVE_ARP_RETRIES && requests < ARP_REQUESTS_PER_TICK &&
+                     (host.arpAttempts == 0 || now - host.arpSentMs >= PASSIVE_ARP_RETRY_MS))
+            {
+                NetworkScanner::sendArpRequest(netif, ip);
+                host.arpAttempts++;
+                host.arpSentMs = now;
+                requests++;
+            }
+        }
+        i++;
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef PASSIVE_LISTENER_H
+#define PASSIVE_LISTENER_H
+
+#include <WiFi.h>
+#include "config.h"
+#include "host_range.h"
+
+// ============================================================================
+// Passive Listener - Host discovery from broadcast and multicast chatter
+// ============================================================================
+// While the device is idle on a network, four UDP sockets listen for traffic
+// hosts send on their own:
+//
+//   5353  mDNS (224.0.0.251)        A records give "<name>.local"
+//   1900  SSDP (239.255.255.250)    NOTIFY / M-SEARCH senders
+//   137   NetBIOS-NS broadcasts     name registrations and refreshes
+//   67    DHCP client broadcasts    MAC (chaddr), hostname (option 12)
+//
+// Port 68 is left to the lwIP DHCP client. Each new address gets a few
+// background ARP requests so its MAC is known too; a network_scan then
+// reports the hosts heard within PASSIVE_TRUST_MS at once and only sweeps
+// the rest of the range (a network_delta sweeps them as well).
+// ============================================================================
+
+enum PassiveSource : uint8_t
+{
+    PASSIVE_MDNS = 0x01,
+    PASSIVE_SSDP = 0x02,
+    PASSIVE_NBNS = 0x04,
+    PASSIVE_DHCP = 0x08
+};
+
+struct PassiveHost
+{
+    uint32_t ip; // Host byte order
+    uint8_t mac[6];
+    bool hasMac;
+    uint8_t sources;     // PassiveSource bits
+    uint8_t nameSource;  // Source of name; a DHCP name beats mDNS beats NetBIOS
+    uint8_t arpAttempts;
+    char name[PASSIVE_NAME_SIZE];
+    unsigned long lastSeenMs;
+    unsigned long arpSentMs;
+};
+
+class PassiveListener
+{
+public:
+    // Open the sockets on the current network. The table survives a
+    // stop()/begin() cycle unless the subnet changed.
+    bool begin();
+    void stop();
+    void clear() { hostCount = 0; }
+    bool isRunning() const { return running; }
+
+    // Drain pending datagrams and run maintenance; never blocks
+    void poll();
+
+    int getHostCount() const { return hostCount; }
+    const PassiveHost *getHost(int index) const;
+    const PassiveHost *findHost(uint32_t ip) const;
+
+private:
+    enum Channel
+    {
+        CHANNEL_MDNS,
+        CHANNEL_SSDP,
+        CHANNEL_NBNS,
+        CHANNEL_DHCP,
+        CHANNEL_COUNT
+    };
+
+    int fds[CHANNEL_COUNT] = {-1, -1, -1, -1};
+    PassiveHost hosts[PASSIVE_MAX_HOSTS];
+    int hostCount = 0;
+    HostRange subnet;
+    uint32_t self = 0;
+    bool running = false;
+    unsigned long lastMaintenanceMs = 0;
+
+    static int openChannel(uint16_t port, const char *group);
+    void drain(Channel channel);
+
+    void handleMdns(const uint8_t *data, size_t len, uint32_t from);
+    void handleSsdp(const uint8_t *data, size_t len, uint32_t from);
+    void handleNbns(const uint8_t *data, size_t len, uint32_t from);
+    void handleDhcp(const uint8_t *data, size_t len);
+
+    // Record (or refresh) a host; nullptr if the address is not a neighbour
+    PassiveHost *touch(uint32_t ip, uint8_t source);
+    static void setName(PassiveHost &host, const char *name, uint8_t source);
+    void maintain();
+};
+
+extern PassiveListener passiveListener;
+
+#endif // PASSIVE_LISTENER_H
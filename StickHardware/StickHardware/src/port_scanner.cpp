@@ -1,9 +1,11 @@
 #include "port_scanner.h"
-<<<<<<< HEAD
-=======
+#include "tls_fingerprint.h"
+#include "network_scanner.h"
+#include "generated/top_ports_table.h"
+#include "generated/service_probes_table.h"
+#include <lwip/sockets.h>
 #include <ctype.h>
 #include <Arduino.h>
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 
 // ============================================================================
 // Port Scanner - Implementation
@@ -12,79 +14,241 @@
 PortScanner portScanner;
 
 // ============================================================================
-// Service Database
+// Service Probe Table - generated from tables/service_probes.txt
+// ============================================================================
+// Each probe names the ports it is sent to and the patterns that identify a
+// service in the reply. Patterns are bytecode (see gen_service_probes.py),
+// so new services are table rows rather than code paths.
 // ============================================================================
-
-struct ServiceEntry
-{
-    uint16_t port;
-    const char *name;
-};
-
-static const ServiceEntry SERVICE_DATABASE[] PROGMEM = {
-    {21, "FTP"},
-    {22, "SSH"},
-    {23, "Telnet"},
-    {53, "DNS"},
-    {80, "HTTP"},
-    {443, "HTTPS"},
-    {445, "SMB"},
-    {3306, "MySQL"},
-    {3389, "RDP"},
-    {5432, "PostgreSQL"},
-    {6379, "Redis"},
-    {8080, "HTTP Proxy"},
-    {0, nullptr} // terminator
-};
 
 const char *identifyService(uint16_t port)
 {
-    for (int i = 0; SERVICE_DATABASE[i].name != nullptr; i++)
+    for (size_t i = 0; i < SERVICE_PORT_NAME_COUNT; i++)
     {
-        if (SERVICE_DATABASE[i].port == port)
+        if (SERVICE_PORT_NAMES[i].port == port)
         {
-            return SERVICE_DATABASE[i].name;
+            return (const char *)SERVICE_PROBE_POOL + SERVICE_PORT_NAMES[i].service;
         }
     }
     return "unknown";
 }
 
-const char *identifyServiceByBanner(const char *banner, uint16_t port)
+static const ServiceProbeDef &probeForPort(uint16_t port)
 {
-<<<<<<< HEAD
-    // Trimmed banner heuristics to save flash; fall back to port-based mapping
-    (void)banner;
-=======
-    if (banner && banner[0] != '\0')
+    for (size_t p = 1; p < SERVICE_PROBE_COUNT; p++)
     {
-        if (strstr(banner, "SSH") != nullptr)
+        const ServiceProbeDef &probe = SERVICE_PROBES[p];
+        for (uint8_t i = 0; i < probe.portCount; i++)
         {
-            return "SSH";
+            if (SERVICE_PROBE_PORTS[probe.firstPort + i] == port)
+            {
+                return probe;
+            }
         }
-        if (strstr(banner, "HTTP") != nullptr || strstr(banner, "GET") != nullptr || strstr(banner, "POST") != nullptr)
+    }
+    return SERVICE_PROBES[0]; // NULL probe: wait for a greeting
+}
+
+struct PatternCapture
+{
+    const char *start;
+    size_t length;
+};
+
+static inline bool bytesEqual(uint8_t a, uint8_t b, bool nocase)
+{
+    return a == b || (nocase && tolower(a) == tolower(b));
+}
+
+// Runs pattern bytecode at s. Wildcards are lazy and backtrack by recursion,
+// which stays shallow because a pattern holds only a few wildcards.
+static bool runPattern(const uint8_t *op, const char *s, const char *end, bool nocase, PatternCapture &capture)
+{
+    while (true)
+    {
+        switch (*op)
+        {
+        case PAT_END:
+            return true;
+
+        case PAT_LIT:
         {
-            return "HTTP";
+            uint8_t n = op[1];
+            if ((size_t)(end - s) < n)
+            {
+                return false;
+            }
+            for (uint8_t i = 0; i < n; i++)
+            {
+                if (!bytesEqual((uint8_t)s[i], op[2 + i], nocase))
+                {
+                    return false;
+                }
+            }
+            s += n;
+            op += 2 + n;
+            break;
         }
-        if ((port == 21 || strstr(banner, "FTP") != nullptr) && strncmp(banner, "220", 3) == 0)
+
+        case PAT_ONE:
+            if (s >= end)
+            {
+                return false;
+            }
+            s++;
+            op++;
+            break;
+
+        case PAT_ANY:
+        case PAT_CAPTURE:
         {
-            return "FTP";
+            bool capturing = (*op == PAT_CAPTURE);
+            op++;
+
+            if (capturing && *op == PAT_END)
+            {
+                // Trailing capture takes the rest of the line
+                const char *eol = s;
+                while (eol < end && *eol != '\r' && *eol != '\n')
+                {
+                    eol++;
+                }
+                if (eol == s)
+                {
+                    return false;
+                }
+                capture.start = s;
+                capture.length = eol - s;
+                return true;
+            }
+
+            for (const char *t = capturing ? s + 1 : s; t <= end; t++)
+            {
+                if (capturing && (t[-1] == '\r' || t[-1] == '\n'))
+                {
+                    return false;
+                }
+                if (runPattern(op, t, end, nocase, capture))
+                {
+                    if (capturing)
+                    {
+                        capture.start = s;
+                        capture.length = t - s;
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        default:
+            return false;
         }
-        if (port == 25 || strstr(banner, "SMTP") != nullptr)
+    }
+}
+
+static bool matchPattern(const ServiceMatchDef &match, const char *response, size_t length, PatternCapture &capture)
+{
+    const uint8_t *code = SERVICE_PROBE_POOL + match.pattern;
+    bool nocase = (match.flags & MATCH_NOCASE) != 0;
+    const char *end = response + length;
+
+    if (match.flags & MATCH_ANCHORED)
+    {
+        return runPattern(code, response, end, nocase, capture);
+    }
+    for (const char *s = response; s < end; s++)
+    {
+        if (runPattern(code, s, end, nocase, capture))
         {
-            return "SMTP";
+            return true;
         }
-        if (strstr(banner, "POP3") != nullptr)
+    }
+    return false;
+}
+
+static const ServiceMatchDef *matchProbe(const ServiceProbeDef &probe, const char *response, size_t length,
+                                         const SignatureSet &hits, PatternCapture &capture)
+{
+    for (uint16_t i = 0; i < probe.matchCount; i++)
+    {
+        const ServiceMatchDef &match = SERVICE_MATCHES[probe.firstMatch + i];
+        if (match.signature != SIG_NONE && !hits.has(match.signature))
         {
-            return "POP3";
+            continue; // required literal absent - pattern cannot match
         }
-        if (strstr(banner, "IMAP") != nullptr)
+        capture.start = nullptr;
+        capture.length = 0;
+        if (matchPattern(match, response, length, capture))
         {
-            return "IMAP";
+            return &match;
         }
     }
+    return nullptr;
+}
+
+const char *matchServiceResponse(const char *response, size_t length, uint16_t port,
+                                 char *version, size_t versionSize)
+{
+    // One automaton pass decides which patterns are worth running
+    SignatureSet hits;
+    if (response && length > 0)
+    {
+        hits = scanBannerSignatures(response, length);
+    }
+    return matchServiceResponse(response, length, port, hits, version, versionSize);
+}
+
+const char *matchServiceResponse(const char *response, size_t length, uint16_t port,
+                                 const SignatureSet &hits, char *version, size_t versionSize)
+{
+    if (versionSize > 0)
+    {
+        version[0] = '\0';
+    }
+    if (!response || length == 0)
+    {
+        return identifyService(port);
+    }
+
+    // The probe that was sent first, then greetings sent before any request
+    PatternCapture capture;
+    const ServiceProbeDef &sent = probeForPort(port);
+    const ServiceMatchDef *match = matchProbe(sent, response, length, hits, capture);
+    if (!match && &sent != &SERVICE_PROBES[0])
+    {
+        match = matchProbe(SERVICE_PROBES[0], response, length, hits, capture);
+    }
+    if (!match)
+    {
+        return identifyService(port);
+    }
+
+    if (capture.start && versionSize > 0)
+    {
+        size_t n = capture.length < versionSize - 1 ? capture.length : versionSize - 1;
+        memcpy(version, capture.start, n);
+        version[n] = '\0';
+    }
+    return (const char *)SERVICE_PROBE_POOL + match->service;
+}
+
+const uint16_t *topPortsTable()
+{
+    return TOP_PORTS_TCP;
+}
 
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
-    return identifyService(port);
+int clampTopPortCount(int count)
+{
+    if (count <= 0)
+    {
+        return DEFAULT_TOP_PORTS;
+    }
+    if (count > (int)TOP_PORTS_TCP_COUNT)
+    {
+        return TOP_PORTS_TCP_COUNT;
+    }
+    return count;
 }
 
 // ============================================================================
@@ -94,100 +258,172 @@ const char *identifyServiceByBanner(const char *banner, uint16_t port)
 void PortScanner::init()
 {
     openPortCount = 0;
+    closedPortCount = 0;
+    filteredPortCount = 0;
+    store.clear();
     scanProgress = 0;
     scanning = false;
     scanCancelled = false;
-<<<<<<< HEAD
-=======
     detectOSFlag = false;
     serviceVersionFlag = false;
     osDetected = false;
     strncpy(detectedOS, "unknown", sizeof(detectedOS) - 1);
     detectedOS[sizeof(detectedOS) - 1] = '\0';
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+    resetTargets();
+    scanMode = ScanMode::CONNECT;
+    rateCeiling = 0;
+    parallelism = 0;
+    resumeIndex = 0;
 }
 
-bool PortScanner::tcpConnect(const char *host, uint16_t port, int timeoutMs)
+void PortScanner::configureScanOptions(bool detectOS, bool serviceVersion)
 {
-    WiFiClient client;
-    client.setTimeout(timeoutMs);
-
-    bool connected = client.connect(host, port, timeoutMs);
+    detectOSFlag = detectOS;
+    serviceVersionFlag = serviceVersion;
+    osDetected = false;
+    strncpy(detectedOS, "unknown", sizeof(detectedOS) - 1);
+    detectedOS[sizeof(detectedOS) - 1] = '\0';
+    connectsMade = 0;
+    connectsSaved = 0;
+}
 
-    if (connected)
-    {
-        client.stop();
-    }
-<<<<<<< HEAD
-=======
-    else
+static PortState toPortState(ProbeState state)
+{
+    switch (state)
     {
-        client.stop(); // ensure socket cleanup
-        delay(1);
-        yield();
+    case ProbeState::OPEN:
+        return PortState::OPEN;
+    case ProbeState::CLOSED:
+        return PortState::CLOSED;
+    default:
+        return PortState::FILTERED;
     }
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+}
 
-    return connected;
+static void resetResult(PortResult &result, uint16_t port)
+{
+    memset(result.ip, 0, sizeof(result.ip));
+    result.port = port;
+    result.open = false;
+    result.valid = true;
+    memset(result.service, 0, sizeof(result.service));
+    memset(result.banner, 0, sizeof(result.banner));
+    memset(result.version, 0, sizeof(result.version));
+    memset(result.os, 0, sizeof(result.os));
 }
 
-bool PortScanner::grabBanner(WiFiClient &client, char *buffer, size_t bufferSize, int timeoutMs)
+static bool containsNoCase(const char *haystack, const char *needle)
 {
-    if (!client.connected())
+    size_t n = strlen(needle);
+    for (; *haystack; haystack++)
     {
-        return false;
+        if (strncasecmp(haystack, needle, n) == 0)
+        {
+            return true;
+        }
     }
+    return false;
+}
 
-    memset(buffer, 0, bufferSize);
-
-    unsigned long startTime = millis();
-    size_t bytesRead = 0;
+// OS guess from a cached response. probesAvoided is how many dedicated
+// connects the old detectOS() would have spent to learn the same thing.
+static bool osHintFromSession(const ProbeSession &session, char *buffer, size_t bufferSize, int &probesAvoided)
+{
+    const char *os = nullptr;
+    char line[96];
 
-    // Wait for data
-    while (client.connected() && millis() - startTime < (unsigned long)timeoutMs)
+    if (session.header("Server", line, sizeof(line)))
     {
-        if (client.available())
+        if (containsNoCase(line, "windows") || containsNoCase(line, "iis"))
         {
-            while (client.available() && bytesRead < bufferSize - 1)
-            {
-                char c = client.read();
-                // Only keep printable ASCII
-                if (c >= 32 && c < 127)
-                {
-                    buffer[bytesRead++] = c;
-                }
-                else if (c == '\n' || c == '\r')
-                {
-                    buffer[bytesRead++] = ' ';
-                }
-            }
-            break; // Got some data, stop waiting
+            os = "Windows";
         }
-        delay(10);
-        yield();
+        else if (containsNoCase(line, "linux") || containsNoCase(line, "ubuntu") || containsNoCase(line, "debian"))
+        {
+            os = "Linux";
+        }
+        else if (containsNoCase(line, "freebsd"))
+        {
+            os = "FreeBSD";
+        }
+        probesAvoided = 1; // HEAD to port 80
+    }
+    else if (session.firstLine(line, sizeof(line)) && strncmp(line, "SSH-", 4) == 0)
+    {
+        if (containsNoCase(line, "openssh"))
+        {
+            os = "Linux/Unix";
+        }
+        else if (containsNoCase(line, "windows"))
+        {
+            os = "Windows";
+        }
+        probesAvoided = 2; // port 80 attempt, then port 22
     }
 
-    // Trim trailing spaces
-    while (bytesRead > 0 && buffer[bytesRead - 1] == ' ')
+    if (!os)
     {
-        buffer[--bytesRead] = '\0';
+        return false;
     }
 
-    return bytesRead > 0;
+    strncpy(buffer, os, bufferSize - 1);
+    buffer[bufferSize - 1] = '\0';
+    return true;
 }
 
-<<<<<<< HEAD
-=======
-void PortScanner::configureScanOptions(bool detectOS, bool serviceVersion)
+// Open a probe session on a connected socket and send the port's probe
+static void startProbe(ProbeSession &session, int fd, uint16_t port, unsigned long deadline, const char *hostIp)
 {
-    detectOSFlag = detectOS;
-    serviceVersionFlag = serviceVersion;
-    osDetected = false;
-    strncpy(detectedOS, "unknown", sizeof(detectedOS) - 1);
-    detectedOS[sizeof(detectedOS) - 1] = '\0';
+    const ServiceProbeDef &probe = probeForPort(port);
+    ResponseFraming framing = (probe.flags & PROBE_HTTP)  ? ResponseFraming::HTTP
+                              : (probe.flags & PROBE_TLS) ? ResponseFraming::TLS
+                              : probe.payloadLen > 0      ? ResponseFraming::REPLY
+                                                          : ResponseFraming::GREETING;
+    session.begin(fd, port, deadline, framing);
+    session.sendProbe(SERVICE_PROBE_POOL + probe.payload, probe.payloadLen, hostIp);
+}
+
+bool PortScanner::connectAndRead(ScanTarget &target, uint16_t port, ProbeSession &session)
+{
+    engine.begin(1);
+    if (!engine.submit(target.addr, port, target.rtt.connectTimeoutMs()))
+    {
+        return false;
+    }
+    connectsMade++;
+
+    ConnectOutcome outcome;
+    while (engine.poll(&outcome, 1, RTT_CLOCK_GRANULARITY_MS) == 0)
+    {
+        yield();
+    }
+
+    if (outcome.state != ProbeState::FILTERED)
+    {
+        target.rtt.addSample(outcome.rttMs);
+    }
+    if (outcome.state != ProbeState::OPEN)
+    {
+        return false;
+    }
+
+    startProbe(session, outcome.fd, port, millis() + target.rtt.bannerTimeoutMs(), target.ip);
+
+    while (!session.readAvailable() && (long)(millis() - session.getDeadline()) < 0)
+    {
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(session.getFd(), &readSet);
+        struct timeval tv = {0, ENRICH_POLL_MS * 1000};
+        select(session.getFd() + 1, &readSet, nullptr, nullptr, &tv);
+        yield();
+    }
+
+    session.close();
+    return true;
 }
 
-void PortScanner::ensureOsDetected(const char *targetIP)
+void PortScanner::ensureOsDetected(ScanTarget &target)
 {
     if (!detectOSFlag || osDetected)
     {
@@ -195,7 +431,7 @@ void PortScanner::ensureOsDetected(const char *targetIP)
     }
 
     char osBuf[sizeof(detectedOS)] = {0};
-    if (detectOS(targetIP, osBuf, sizeof(osBuf)))
+    if (detectOS(target, osBuf, sizeof(osBuf)))
     {
         strncpy(detectedOS, osBuf, sizeof(detectedOS) - 1);
     }
@@ -207,367 +443,807 @@ void PortScanner::ensureOsDetected(const char *targetIP)
     osDetected = true;
 }
 
-bool PortScanner::detectOS(const char *targetIP, char *buffer, size_t bufferSize)
+bool PortScanner::detectOS(ScanTarget &target, char *buffer, size_t bufferSize)
 {
     if (!buffer || bufferSize == 0)
     {
         return false;
     }
 
-    String os = "Unknown";
-    WiFiClient client;
+    strncpy(buffer, "Unknown", bufferSize - 1);
+    buffer[bufferSize - 1] = '\0';
 
-    // Try HTTP server header first
-    if (client.connect(targetIP, 80, PORT_CONNECT_TIMEOUT_MS))
+    // Dedicated probes, only for hints the scan itself did not see.
+    // Ports the scan already found closed or filtered are not retried.
+    static const uint16_t OS_PROBE_PORTS[] = {80, 22};
+    for (uint16_t port : OS_PROBE_PORTS)
     {
-        client.print("HEAD / HTTP/1.0\r\nHost: ");
-        client.print(targetIP);
-        client.print("\r\n\r\n");
-
-        unsigned long timeout = millis() + BANNER_READ_TIMEOUT_MS;
-        while (millis() < timeout && client.connected())
+        PortState state = (targetCount == 1) ? store.getState(port) : PortState::UNKNOWN;
+        if (state == PortState::CLOSED || state == PortState::FILTERED)
         {
-            if (client.available())
-            {
-                String line = client.readStringUntil('\n');
-                line.trim();
-                line.toLowerCase();
-                if (line.startsWith("server:"))
-                {
-                    if (line.indexOf("windows") != -1 || line.indexOf("iis") != -1)
-                    {
-                        os = "Windows";
-                    }
-                    else if (line.indexOf("linux") != -1 || line.indexOf("ubuntu") != -1 || line.indexOf("debian") != -1)
-                    {
-                        os = "Linux";
-                    }
-                    else if (line.indexOf("freebsd") != -1)
-                    {
-                        os = "FreeBSD";
-                    }
-                    break;
-                }
-            }
-            delay(10);
-            yield();
+            continue;
         }
-        client.stop();
-    }
 
-    // Fallback to SSH banner
-    if (os == "Unknown")
-    {
-        if (client.connect(targetIP, 22, PORT_CONNECT_TIMEOUT_MS))
+        ProbeSession session;
+        int avoided = 0;
+        if (connectAndRead(target, port, session) &&
+            osHintFromSession(session, buffer, bufferSize, avoided))
         {
-            unsigned long timeout = millis() + BANNER_READ_TIMEOUT_MS;
-            while (!client.available() && millis() < timeout)
-            {
-                delay(10);
-            }
-            if (client.available())
-            {
-                String banner = client.readStringUntil('\n');
-                banner.toLowerCase();
-                if (banner.indexOf("openssh") != -1)
-                {
-                    os = "Linux/Unix";
-                }
-                else if (banner.indexOf("windows") != -1)
-                {
-                    os = "Windows";
-                }
-            }
-            client.stop();
+            return true;
         }
     }
 
-    strncpy(buffer, os.c_str(), bufferSize - 1);
-    buffer[bufferSize - 1] = '\0';
-    return os != "Unknown";
+    return false;
 }
 
-bool PortScanner::fetchServiceVersion(const char *targetIP, uint16_t port, const char *service, const char *banner, char *buffer, size_t bufferSize)
+void PortScanner::determineService(const ScanTarget &target, const ProbeSession &session, PortResult &result)
 {
-    if (!buffer || bufferSize == 0)
-    {
-        return false;
-    }
-
-    buffer[0] = '\0';
-
-    if (banner && strstr(banner, "SSH-2.0-") != nullptr)
-    {
-        const char *verStart = strstr(banner, "SSH-2.0-") + strlen("SSH-2.0-");
-        strncpy(buffer, verStart, bufferSize - 1);
-        buffer[bufferSize - 1] = '\0';
-        return true;
-    }
+    char version[sizeof(result.version)];
+    const char *service = matchServiceResponse(session.raw(), session.rawLength(), result.port,
+                                               version, sizeof(version));
+    strncpy(result.service, service, sizeof(result.service) - 1);
+    result.service[sizeof(result.service) - 1] = '\0';
 
-    if (banner && strncmp(banner, "220", 3) == 0 && (port == 21 || port == 25))
+    // TLS ports answer in binary: the banner becomes the handshake fingerprint
+    TlsFingerprint tls;
+    if (session.isTls() && parseTlsFlight((const uint8_t *)session.raw(), session.rawLength(), tls))
     {
-        strncpy(buffer, banner + 4, bufferSize - 1);
-        buffer[bufferSize - 1] = '\0';
-        return true;
+        formatTlsFingerprint(tls, result.banner, sizeof(result.banner));
+        if (tls.serverHello)
+        {
+            strncpy(version, tlsVersionName(tls.version), sizeof(version) - 1);
+            version[sizeof(version) - 1] = '\0';
+        }
     }
 
-    bool isHttp = false;
-    if (service)
+    if (serviceVersionFlag && version[0] != '\0')
     {
-        if (strncmp(service, "HTTP", 4) == 0 || strncmp(service, "https", 5) == 0 || strncmp(service, "Http", 4) == 0)
+        strncpy(result.version, version, sizeof(result.version) - 1);
+        result.version[sizeof(result.version) - 1] = '\0';
+        if (session.isHttp())
         {
-            isHttp = true;
+            connectsSaved++; // previously a second connection for HEAD
         }
     }
-    if (!isHttp && (port == 80 || port == 8080 || port == 8000 || port == 8008 || port == 3000))
-    {
-        isHttp = true;
-    }
 
-    if (isHttp)
+    if (detectOSFlag)
     {
-        WiFiClient client;
-        if (client.connect(targetIP, port, PORT_CONNECT_TIMEOUT_MS))
+        int avoided = 0;
+        char osBuf[sizeof(detectedOS)];
+        if (!osDetected && osHintFromSession(session, osBuf, sizeof(osBuf), avoided))
         {
-            client.print("HEAD / HTTP/1.0\r\nHost: ");
-            client.print(targetIP);
-            client.print("\r\n\r\n");
-
-            unsigned long timeout = millis() + BANNER_READ_TIMEOUT_MS;
-            while (millis() < timeout && client.connected())
-            {
-                if (client.available())
-                {
-                    String line = client.readStringUntil('\n');
-                    line.trim();
-                    if (line.startsWith("Server: "))
-                    {
-                        String version = line.substring(8);
-                        strncpy(buffer, version.c_str(), bufferSize - 1);
-                        buffer[bufferSize - 1] = '\0';
-                        client.stop();
-                        return true;
-                    }
-                    if (line.length() == 0)
-                    {
-                        break;
-                    }
-                }
-                delay(10);
-                yield();
-            }
-            client.stop();
+            strncpy(detectedOS, osBuf, sizeof(detectedOS) - 1);
+            detectedOS[sizeof(detectedOS) - 1] = '\0';
+            osDetected = true;
+            connectsSaved += avoided;
         }
+        strncpy(result.os, detectedOS, sizeof(result.os) - 1);
+        result.os[sizeof(result.os) - 1] = '\0';
     }
 
-    return buffer[0] != '\0';
+    Serial.printf("[PortScan] %s:%d OPEN (%s) %s\n",
+                  target.ip, result.port, result.service,
+                  result.banner[0] ? result.banner : "");
 }
 
-void PortScanner::determineService(const char *targetIP, uint16_t port, PortResult &result)
+// ============================================================================
+// Enrichment Stage - banner reads on sockets handed over by discovery
+// ============================================================================
+
+void PortScanner::startEnrichment(const ConnectOutcome &outcome)
 {
-    const char *service = identifyServiceByBanner(result.banner, port);
-    strncpy(result.service, service, sizeof(result.service) - 1);
-    result.service[sizeof(result.service) - 1] = '\0';
+    ScanTarget &target = targets[outcome.tag];
 
-    if (serviceVersionFlag)
+    if (enrichCount >= ENRICH_QUEUE_DEPTH)
     {
-        char version[sizeof(result.version)] = {0};
-        if (fetchServiceVersion(targetIP, port, result.service, result.banner, version, sizeof(version)))
-        {
-            strncpy(result.version, version, sizeof(result.version) - 1);
-        }
+        // Discovery is gated on queue space, so this only guards against misuse
+        close(outcome.fd);
+        return;
     }
 
-    if (detectOSFlag)
-    {
-        ensureOsDetected(targetIP);
-        strncpy(result.os, detectedOS, sizeof(result.os) - 1);
-        result.os[sizeof(result.os) - 1] = '\0';
-    }
+    EnrichJob &job = enrichJobs[enrichCount++];
+    job.target = (uint8_t)outcome.tag;
+    startProbe(job.session, outcome.fd, outcome.port, millis() + target.rtt.bannerTimeoutMs(), target.ip);
 }
 
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
-bool PortScanner::checkPort(const char *targetIP, uint16_t port, PortResult &result)
+int PortScanner::enrichStep(uint32_t waitMs, PortFoundCallback callback)
 {
-    result.port = port;
-    result.open = false;
-    result.valid = true;
-    memset(result.service, 0, sizeof(result.service));
-    memset(result.banner, 0, sizeof(result.banner));
-<<<<<<< HEAD
-=======
-    memset(result.version, 0, sizeof(result.version));
-    memset(result.os, 0, sizeof(result.os));
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
-
-    WiFiClient client;
-    client.setTimeout(PORT_CONNECT_TIMEOUT_MS);
-
-    if (client.connect(targetIP, port, PORT_CONNECT_TIMEOUT_MS))
+    if (enrichCount == 0)
     {
-        result.open = true;
+        return 0;
+    }
 
-        // Try to grab banner
-        // Some services need a probe (HTTP GET, etc.)
-        if (port == 80 || port == 8080 || port == 8000 || port == 8008 || port == 3000)
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    int maxFd = -1;
+    for (int i = 0; i < enrichCount; i++)
+    {
+        int fd = enrichJobs[i].session.getFd();
+        FD_SET(fd, &readSet);
+        if (fd > maxFd)
         {
-            // Send HTTP request for HTTP ports
-            client.print("GET / HTTP/1.0\r\nHost: ");
-            client.print(targetIP);
-            client.print("\r\n\r\n");
+            maxFd = fd;
         }
+    }
 
-        // Read banner/response
-        grabBanner(client, result.banner, sizeof(result.banner), BANNER_READ_TIMEOUT_MS);
+    struct timeval tv;
+    tv.tv_sec = waitMs / 1000;
+    tv.tv_usec = (waitMs % 1000) * 1000;
+    int ready = select(maxFd + 1, &readSet, nullptr, nullptr, &tv);
 
-<<<<<<< HEAD
-        // Identify service
-        const char *service = identifyServiceByBanner(result.banner, port);
-        strncpy(result.service, service, sizeof(result.service) - 1);
-=======
-        // Identify service/version/OS
-        determineService(targetIP, port, result);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+    unsigned long now = millis();
+    int finished = 0;
+    for (int i = 0; i < enrichCount;)
+    {
+        ProbeSession &session = enrichJobs[i].session;
+        bool done = false;
 
-        client.stop();
+        if (ready > 0 && FD_ISSET(session.getFd(), &readSet))
+        {
+            done = session.readAvailable();
+        }
+        if (!done && (long)(now - session.getDeadline()) >= 0)
+        {
+            if (session.rawLength() == 0)
+            {
+                bannerTimeouts++;
+            }
+            done = true;
+        }
 
-        Serial.printf("[PortScan] %s:%d OPEN (%s) %s\n",
-                      targetIP, port, result.service,
-                      result.banner[0] ? result.banner : "");
-    }
-<<<<<<< HEAD
-=======
-    else
-    {
-        client.stop(); // ensure socket cleanup on failures
+        if (done)
+        {
+            completeEnrichment(i, callback);
+            finished++;
+            continue; // slot i now holds the last job
+        }
+        i++;
     }
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
 
-    return result.open;
+    return finished;
 }
 
-int PortScanner::scanPorts(const char *targetIP, uint16_t startPort, uint16_t endPort,
-                           PortFoundCallback callback,
-<<<<<<< HEAD
-                           PortProgressCallback progressCb)
+void PortScanner::completeEnrichment(int index, PortFoundCallback callback)
 {
-    Serial.printf("[PortScan] Scanning %s ports %d-%d\n", targetIP, startPort, endPort);
+    EnrichJob &job = enrichJobs[index];
+    job.session.close();
 
-=======
-                           PortProgressCallback progressCb,
-                           bool detectOS,
-                           bool serviceVersion)
+    ScanTarget &target = targets[job.target];
+    PortResult result;
+    resetResult(result, job.session.getPort());
+    result.open = true;
+    snprintf(result.ip, sizeof(result.ip), "%s", target.ip);
+    job.session.bannerText(result.banner, sizeof(result.banner));
+
+    determineService(target, job.session, result);
+
+    uint8_t targetIndex = job.target;
+    enrichJobs[index] = enrichJobs[--enrichCount];
+
+    recordOpenPort(targetIndex, result);
+    enrichedCount++;
+
+    if (callback)
+    {
+        callback(result);
+    }
+}
+
+void PortScanner::recordOpenPort(uint8_t targetIndex, const PortResult &result)
 {
-    Serial.printf("[PortScan] Scanning %s ports %d-%d\n", targetIP, startPort, endPort);
+    store.addOpenPort(targetIndex, result.port, result.service,
+                      result.banner, result.version, result.os);
+}
 
-    configureScanOptions(detectOS, serviceVersion);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+void PortScanner::abortEnrichment()
+{
+    for (int i = 0; i < enrichCount; i++)
+    {
+        enrichJobs[i].session.close();
+    }
+    enrichCount = 0;
+}
+
+void PortScanner::resetTargets()
+{
+    targetCount = 0;
+    connectTimeouts = 0;
+    bannerTimeouts = 0;
+}
+
+bool PortScanner::addTarget(const IPAddress &ip)
+{
+    if (targetCount >= MAX_TARGETS)
+    {
+        return false;
+    }
+
+    ScanTarget &target = targets[targetCount++];
+    target.addr = (uint32_t)ip;
+    strncpy(target.ip, ip.toString().c_str(), sizeof(target.ip) - 1);
+    target.ip[sizeof(target.ip) - 1] = '\0';
+    target.rtt.reset();
+    uint32_t echoMs;
+    if (networkScanner.getRtt(ip, echoMs))
+    {
+        target.rtt.seed(echoMs); // Pinged by the last network_scan
+    }
+    target.nextPort = 0;
+    target.inFlight = 0;
+    target.openCount = 0;
+    return true;
+}
+
+int PortScanner::pickNextTarget(int portCount, int perHostCap) const
+{
+    // Round-robin over hosts that still have ports left and spare slots
+    for (int i = 0; i < targetCount; i++)
+    {
+        int index = (nextTargetCursor + i) % targetCount;
+        const ScanTarget &target = targets[index];
+        if (target.nextPort < portCount && target.inFlight < perHostCap)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+bool PortScanner::checkPort(const char *targetIP, uint16_t port, PortResult &result)
+{
+    resetResult(result, port);
+
+    IPAddress ip;
+    if (!ip.fromString(targetIP))
+    {
+        return false;
+    }
+    if (targetCount == 0 || targets[0].addr != (uint32_t)ip)
+    {
+        resetTargets();
+        addTarget(ip);
+    }
+    ScanTarget &target = targets[0];
+
+    ProbeSession session;
+    if (!connectAndRead(target, port, session))
+    {
+        return false;
+    }
+
+    result.open = true;
+    snprintf(result.ip, sizeof(result.ip), "%s", target.ip);
+    if (session.bannerText(result.banner, sizeof(result.banner)) == 0)
+    {
+        bannerTimeouts++;
+    }
+    determineService(target, session, result);
+
+    return true;
+}
+
+int PortScanner::runScan(const uint16_t *portList, uint16_t startPort, int portCount,
+                         PortFoundCallback callback,
+                         PortProgressCallback progressCb)
+{
     scanning = true;
     scanCancelled = false;
     openPortCount = 0;
+    closedPortCount = 0;
+    filteredPortCount = 0;
     scanProgress = 0;
+    nextTargetCursor = 0;
+    enrichCount = 0;
+    enrichedCount = 0;
 
-    int totalPorts = endPort - startPort + 1;
-    int scanned = 0;
-    int lastReported = -1;
+    if (resumeIndex >= portCount || targetCount != 1)
+    {
+        resumeIndex = 0; // checkpoint does not belong to this job
+    }
 
-    for (uint16_t port = startPort; port <= endPort && !scanCancelled; port++)
+    // Without storage results still stream through the callback. A resumed
+    // scan keeps the open ports restored into the store.
+    bool storeReady = (resumeIndex > 0) || store.begin();
+    bool trackStates = (targetCount == 1);
+
+    if (targetCount == 0 || portCount <= 0)
     {
-        PortResult result;
+        scanning = false;
+        return 0;
+    }
+
+    rate.begin(rateCeiling);
+    checkpointIndex = 0;
+    reportedCheckpointIndex = -1;
+    lastCheckpointMs = millis();
+    long skipped = applyResume(callback);
+
+    // Half-open discovery needs the state bitmaps to drop duplicate replies
+    if (scanMode == ScanMode::SYN)
+    {
+        if (trackStates && storeReady)
+        {
+            int found = runSynScan(portList, startPort, portCount, callback, progressCb);
+            if (found >= 0)
+            {
+                return found;
+            }
+        }
+        Serial.println("[PortScan] SYN mode unavailable, using connect scan");
+        scanMode = ScanMode::CONNECT; // so the summary reports what ran
+    }
+
+    engine.begin(parallelism > 0 ? parallelism : PARALLEL_PORT_SCANS);
+    ConnectOutcome outcomes[ConnectEngine::MAX_SLOTS];
+
+    // Spread slots evenly so one unresponsive host holds at most its share
+    int perHostCap = engine.capacity() / targetCount;
+    if (perHostCap < 1)
+    {
+        perHostCap = 1;
+    }
 
-        if (checkPort(targetIP, port, result))
+    long totalProbes = (long)portCount * targetCount;
+    long scanned = skipped;
+    int lastReported = -1;
+    int lastEnrichReported = -1;
+    uint16_t lastPort = portList ? portList[0] : startPort;
+
+    // Stage 1 (discover) fills connect slots; stage 2 (enrich) reads banners
+    // from sockets discovery handed over. Neither stage waits on the other:
+    // they share the socket budget, so discovery only submits while every
+    // in-flight connect could still find room in the enrichment queue and
+    // the rate controller has a token to spend.
+    while ((scanned < totalProbes || enrichCount > 0) && !scanCancelled)
+    {
+        while (engine.hasFreeSlot() && engine.inFlight() + enrichCount < ENRICH_QUEUE_DEPTH)
         {
-            if (openPortCount < MAX_OPEN_PORTS)
+            // Pick before taking a token, so one is not spent on no probe
+            int index = pickNextTarget(portCount, perHostCap);
+            if (index < 0 || !rate.tryAcquire())
             {
-                results[openPortCount++] = result;
+                break;
             }
+            nextTargetCursor = (index + 1) % targetCount;
 
-            if (callback)
+            ScanTarget &target = targets[index];
+            uint16_t port = portList ? portList[target.nextPort] : (uint16_t)(startPort + target.nextPort);
+            if (!engine.submit(target.addr, port, target.rtt.connectTimeoutMs(), index))
             {
-                callback(result);
+                rate.onLoss();
+                if (engine.inFlight() == 0)
+                {
+                    // Nothing will drain to free a socket - give up on this port
+                    Serial.printf("[PortScan] No socket available for %s:%d\n", target.ip, port);
+                    target.nextPort++;
+                    scanned++;
+                }
+                break;
             }
+            target.nextPort++;
+            target.inFlight++;
+            connectsMade++;
         }
 
-        scanned++;
-        scanProgress = (scanned * 100) / totalPorts;
+        uint32_t discoverWait = (enrichCount > 0) ? ENRICH_POLL_MS : RTT_CLOCK_GRANULARITY_MS;
+        if (scanned < totalProbes && engine.hasFreeSlot())
+        {
+            // Wake up in time to spend the next token
+            uint32_t tokenWait = rate.msUntilToken();
+            if (tokenWait < discoverWait)
+            {
+                discoverWait = tokenWait;
+            }
+        }
+        int completed = engine.poll(outcomes, ConnectEngine::MAX_SLOTS, discoverWait);
+        for (int i = 0; i < completed; i++)
+        {
+            const ConnectOutcome &outcome = outcomes[i];
+            ScanTarget &target = targets[outcome.tag];
+            target.inFlight--;
+
+            if (outcome.state == ProbeState::FILTERED)
+            {
+                // Not a loss: a port that drops probes looks the same, and
+                // the kernel's own SYN retries hide which one this was
+                connectTimeouts++;
+                filteredPortCount++;
+            }
+            else
+            {
+                rate.onAnswered();
+                target.rtt.addSample(outcome.rttMs);
+                if (outcome.state == ProbeState::CLOSED)
+                {
+                    closedPortCount++;
+                }
+            }
+
+            if (trackStates)
+            {
+                store.setState(outcome.port, toPortState(outcome.state));
+            }
+
+            if (outcome.state == ProbeState::OPEN)
+            {
+                target.openCount++;
+                openPortCount++;
+                startEnrichment(outcome);
+            }
+
+            lastPort = outcome.port;
+            scanned++;
+        }
+
+        enrichStep(engine.inFlight() > 0 ? 0 : ENRICH_POLL_MS, callback);
+
+        if (trackStates)
+        {
+            checkpoint(portList, startPort, false);
+        }
+
+        scanProgress = (int)((scanned * 100) / totalProbes);
 
         if (progressCb && scanProgress != lastReported)
         {
             lastReported = scanProgress;
-            progressCb(port, scanProgress, openPortCount);
+            progressCb(lastPort, scanProgress, openPortCount);
+        }
+
+        if (enrichProgressCb && enrichedCount != lastEnrichReported)
+        {
+            lastEnrichReported = enrichedCount;
+            enrichProgressCb(enrichedCount, openPortCount);
         }
 
         yield(); // Prevent watchdog timeout
+    }
 
-        // Small delay between connections to avoid overwhelming target
-        delay(5);
+    if (scanCancelled && trackStates)
+    {
+        checkpoint(portList, startPort, true);
     }
+    return finishScan(lastPort, progressCb);
+}
 
-    scanProgress = 100;
-    scanning = false;
+// ============================================================================
+// Half-open (SYN) discovery
+// ============================================================================
 
-    if (progressCb)
+void PortScanner::recordBareOpenPort(uint8_t targetIndex, uint16_t port, PortFoundCallback callback)
+{
+    // Answered SYN-ACK but no banner connection could be made
+    PortResult result;
+    resetResult(result, port);
+    result.open = true;
+    snprintf(result.ip, sizeof(result.ip), "%s", targets[targetIndex].ip);
+    strncpy(result.service, identifyService(port), sizeof(result.service) - 1);
+    if (detectOSFlag)
     {
-        progressCb(endPort, 100, openPortCount);
+        snprintf(result.os, sizeof(result.os), "%s", detectedOS);
     }
 
-    Serial.printf("[PortScan] Complete. Found %d open ports.\n", openPortCount);
+    recordOpenPort(targetIndex, result);
+    enrichedCount++;
 
-    return openPortCount;
+    if (callback)
+    {
+        callback(result);
+    }
 }
 
-int PortScanner::scanCommonPorts(const char *targetIP, PortFoundCallback callback,
-<<<<<<< HEAD
-                                 PortProgressCallback progressCb)
+int PortScanner::runSynScan(const uint16_t *portList, uint16_t startPort, int portCount,
+                            PortFoundCallback callback,
+                            PortProgressCallback progressCb)
 {
-    Serial.printf("[PortScan] Scanning %s (common ports)\n", targetIP);
+    ScanTarget &target = targets[0];
+    if (!synProber.begin((uint32_t)WiFi.localIP()))
+    {
+        return -1;
+    }
 
-=======
-                                 PortProgressCallback progressCb,
-                                 bool detectOS,
-                                 bool serviceVersion)
-{
-    Serial.printf("[PortScan] Scanning %s (common ports)\n", targetIP);
+    Serial.printf("[PortScan] SYN scan from port %d, up to %d probes in flight\n",
+                  synProber.getLocalPort(), SYN_MAX_IN_FLIGHT);
 
-    configureScanOptions(detectOS, serviceVersion);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
-    scanning = true;
-    scanCancelled = false;
-    openPortCount = 0;
-    scanProgress = 0;
+    engine.begin(parallelism > 0 ? parallelism : PARALLEL_PORT_SCANS);
+    ConnectOutcome outcomes[ConnectEngine::MAX_SLOTS];
+    SynReply replies[SYN_SEND_BURST];
+    synOpenHead = 0;
+    synOpenUsed = 0;
 
-    int scanned = 0;
+    long scanned = target.nextPort; // nonzero when resumed
     int lastReported = -1;
-
-    for (size_t i = 0; i < COMMON_PORTS_COUNT && !scanCancelled; i++)
+    int lastEnrichReported = -1;
+    uint16_t lastPort = portList ? portList[0] : startPort;
+
+    // Discovery runs off the raw socket, so it is bounded by the pending
+    // table rather than the lwIP socket pool. Only ports that answer SYN-ACK
+    // get a full connect, which feeds the usual enrichment stage.
+    while ((scanned < portCount || synOpenUsed > 0 || engine.inFlight() > 0 || enrichCount > 0) &&
+           !scanCancelled)
     {
-        uint16_t port = COMMON_PORTS[i];
-        PortResult result;
+        // Every pending probe may still turn into a backlog entry
+        for (int sent = 0; sent < SYN_SEND_BURST && target.nextPort < portCount &&
+                           synProber.pendingCount() + synOpenUsed < SYN_MAX_IN_FLIGHT && rate.tryAcquire();
+             sent++)
+        {
+            uint16_t port = portList ? portList[target.nextPort] : (uint16_t)(startPort + target.nextPort);
+            if (!synProber.send(target.addr, port, 0))
+            {
+                rate.onLoss();
+                if (synProber.pendingCount() == 0)
+                {
+                    // Nothing outstanding to wait for - the stack refuses raw sends
+                    Serial.printf("[PortScan] SYN send failed for %s:%d\n", target.ip, port);
+                    store.setState(port, PortState::FILTERED);
+                    filteredPortCount++;
+                    target.nextPort++;
+                    scanned++;
+                }
+                break;
+            }
+            target.nextPort++;
+        }
 
-        if (checkPort(targetIP, port, result))
+        bool busy = engine.inFlight() > 0 || enrichCount > 0 || synOpenUsed > 0;
+        uint32_t receiveWait = busy ? 0 : ENRICH_POLL_MS;
+        if (target.nextPort < portCount)
+        {
+            uint32_t tokenWait = rate.msUntilToken();
+            if (tokenWait < receiveWait)
+            {
+                receiveWait = tokenWait;
+            }
+        }
+        int received = synProber.receive(replies, SYN_SEND_BURST, receiveWait);
+        for (int i = 0; i < received; i++)
         {
-            if (openPortCount < MAX_OPEN_PORTS)
+            const SynReply &reply = replies[i];
+            if (reply.ip != target.addr || store.getState(reply.port) != PortState::UNKNOWN)
             {
-                results[openPortCount++] = result;
+                continue; // another host, or a duplicate/late answer
             }
 
-            if (callback)
+            uint8_t attempt = 0;
+            unsigned long sentMs;
+            bool pending = synProber.pendingSend(reply.port, attempt, sentMs);
+            if (attempt > 0)
             {
-                callback(result);
+                rate.onProbeLost(); // A retransmission answered: the first probe was dropped
             }
+            else
+            {
+                if (pending)
+                {
+                    target.rtt.addSample(millis() - sentMs); // Karn: first sends only
+                }
+                rate.onAnswered();
+            }
+
+            if (reply.kind == SynReplyKind::SYN_ACK)
+            {
+                store.setState(reply.port, PortState::OPEN);
+                target.openCount++;
+                openPortCount++;
+                synOpenQueue[(synOpenHead + synOpenUsed) % SYN_MAX_IN_FLIGHT] = reply.port;
+                synOpenUsed++;
+            }
+            else
+            {
+                store.setState(reply.port, PortState::CLOSED);
+                closedPortCount++;
+            }
+            lastPort = reply.port;
+            scanned++;
         }
 
-        scanned++;
-        scanProgress = (scanned * 100) / COMMON_PORTS_COUNT;
+        // Expire unanswered probes, oldest first; retransmit before giving up
+        uint16_t port;
+        uint8_t attempt;
+        unsigned long sentMs;
+        unsigned long now = millis();
+        while (synProber.oldest(port, attempt, sentMs))
+        {
+            if (store.getState(port) != PortState::UNKNOWN)
+            {
+                synProber.dropOldest(); // already answered
+                continue;
+            }
+            if (now - sentMs < target.rtt.connectTimeoutMs())
+            {
+                break;
+            }
+            synProber.dropOldest();
+            if (attempt < SYN_RETRIES && synProber.send(target.addr, port, attempt + 1))
+            {
+                continue;
+            }
+            store.setState(port, PortState::FILTERED);
+            filteredPortCount++;
+            connectTimeouts++;
+            lastPort = port;
+            scanned++;
+        }
+
+        // Open ports get one real connection for the banner
+        while (synOpenUsed > 0 && engine.hasFreeSlot() && engine.inFlight() + enrichCount < ENRICH_QUEUE_DEPTH)
+        {
+            uint16_t openPort = synOpenQueue[synOpenHead];
+            if (!engine.submit(target.addr, openPort, target.rtt.connectTimeoutMs()))
+            {
+                if (engine.inFlight() == 0)
+                {
+                    recordBareOpenPort(0, openPort, callback);
+                    synOpenHead = (synOpenHead + 1) % SYN_MAX_IN_FLIGHT;
+                    synOpenUsed--;
+                }
+                break;
+            }
+            synOpenHead = (synOpenHead + 1) % SYN_MAX_IN_FLIGHT;
+            synOpenUsed--;
+            connectsMade++;
+        }
+
+        int completed = engine.poll(outcomes, ConnectEngine::MAX_SLOTS, 0);
+        for (int i = 0; i < completed; i++)
+        {
+            if (outcomes[i].state == ProbeState::OPEN)
+            {
+                startEnrichment(outcomes[i]);
+            }
+            else
+            {
+                recordBareOpenPort(0, outcomes[i].port, callback);
+            }
+        }
+
+        enrichStep(0, callback);
+        checkpoint(portList, startPort, false);
+
+        scanProgress = (int)((scanned * 100) / portCount);
 
         if (progressCb && scanProgress != lastReported)
         {
             lastReported = scanProgress;
-            progressCb(port, scanProgress, openPortCount);
+            progressCb(lastPort, scanProgress, openPortCount);
         }
 
-        yield();
-        delay(5);
+        if (enrichProgressCb && enrichedCount != lastEnrichReported)
+        {
+            lastEnrichReported = enrichedCount;
+            enrichProgressCb(enrichedCount, openPortCount);
+        }
+
+        yield(); // Prevent watchdog timeout
+    }
+
+    synProber.end();
+    if (scanCancelled)
+    {
+        checkpoint(portList, startPort, true);
+    }
+    return finishScan(lastPort, progressCb);
+}
+
+// ============================================================================
+// Checkpoint / resume
+// ============================================================================
+
+bool PortScanner::beginResume(int index, int closedCount, int filteredCount)
+{
+    if (index <= 0 || !store.begin())
+    {
+        resumeIndex = 0;
+        return false;
+    }
+    resumeIndex = index;
+    resumeClosed = closedCount;
+    resumeFiltered = filteredCount;
+    return true;
+}
+
+bool PortScanner::restoreOpenPort(const PortResult &result)
+{
+    if (resumeIndex == 0)
+    {
+        return false;
+    }
+    store.setState(result.port, PortState::OPEN);
+    return store.addOpenPort(0, result.port, result.service,
+                             result.banner, result.version, result.os) >= 0;
+}
+
+int PortScanner::applyResume(PortFoundCallback callback)
+{
+    if (resumeIndex == 0)
+    {
+        return 0;
+    }
+
+    int skipped = resumeIndex;
+    resumeIndex = 0;
+
+    ScanTarget &target = targets[0];
+    target.nextPort = skipped;
+    target.openCount = store.getOpenCount();
+    openPortCount = store.getOpenCount();
+    enrichedCount = openPortCount;
+    closedPortCount = resumeClosed;
+    filteredPortCount = resumeFiltered;
+    checkpointIndex = skipped;
+
+    Serial.printf("[PortScan] Resuming %s at port index %d (%d open restored)\n",
+                  target.ip, skipped, openPortCount);
+
+    // The client may have lost what it saw before the checkpoint
+    if (callback)
+    {
+        PortResultView view;
+        PortResult result;
+        for (int i = 0; store.view(i, view); i++)
+        {
+            resetResult(result, view.port);
+            result.open = true;
+            snprintf(result.ip, sizeof(result.ip), "%s", target.ip);
+            strncpy(result.service, view.service, sizeof(result.service) - 1);
+            strncpy(result.banner, view.banner, sizeof(result.banner) - 1);
+            strncpy(result.version, view.version, sizeof(result.version) - 1);
+            strncpy(result.os, view.os, sizeof(result.os) - 1);
+            callback(result);
+        }
+    }
+    return skipped;
+}
+
+void PortScanner::checkpoint(const uint16_t *portList, uint16_t startPort, bool force)
+{
+    if (!checkpointCb)
+    {
+        return;
+    }
+    unsigned long now = millis();
+    if (!force && now - lastCheckpointMs < SCAN_CHECKPOINT_INTERVAL_MS)
+    {
+        return;
+    }
+    lastCheckpointMs = now;
+
+    // Ports finish out of order; the resume point is the end of the finished
+    // prefix. An open port still waiting for its banner has no record yet,
+    // so the prefix stops there until the pipeline drains.
+    const ScanTarget &target = targets[0];
+    bool openPending = openPortCount > enrichedCount;
+    while (checkpointIndex < target.nextPort)
+    {
+        uint16_t port = portList ? portList[checkpointIndex] : (uint16_t)(startPort + checkpointIndex);
+        PortState state = store.getState(port);
+        if (state == PortState::UNKNOWN || (state == PortState::OPEN && openPending))
+        {
+            break;
+        }
+        checkpointIndex++;
+    }
+
+    if (checkpointIndex != reportedCheckpointIndex)
+    {
+        reportedCheckpointIndex = checkpointIndex;
+        checkpointCb(checkpointIndex);
+    }
+}
+
+int PortScanner::finishScan(uint16_t lastPort, PortProgressCallback progressCb)
+{
+    engine.abortAll();
+    abortEnrichment();
+    for (int i = 0; i < targetCount; i++)
+    {
+        targets[i].inFlight = 0;
+    }
+
+    // OS hints normally come from cached responses; probe only if none did
+    if (!scanCancelled && targetCount == 1)
+    {
+        ensureOsDetected(targets[0]);
     }
 
     scanProgress = 100;
@@ -575,21 +1251,119 @@ int PortScanner::scanCommonPorts(const char *targetIP, PortFoundCallback callbac
 
     if (progressCb)
     {
-        progressCb(COMMON_PORTS[COMMON_PORTS_COUNT - 1], 100, openPortCount);
+        progressCb(lastPort, 100, openPortCount);
     }
 
-    Serial.printf("[PortScan] Complete. Found %d open ports.\n", openPortCount);
+    Serial.printf("[PortScan] Complete. Found %d open ports on %d host(s).\n", openPortCount, targetCount);
+    for (int i = 0; i < targetCount; i++)
+    {
+        const RttEstimator &rtt = targets[i].rtt;
+        Serial.printf("[PortScan] %s: %d open, srtt=%lums var=%lums rto=%lums\n",
+                      targets[i].ip, targets[i].openCount,
+                      (unsigned long)rtt.getSmoothedRtt(), (unsigned long)rtt.getRttVariance(),
+                      (unsigned long)rtt.connectTimeoutMs());
+    }
+    Serial.printf("[PortScan] %d connect / %d banner timeouts\n", connectTimeouts, bannerTimeouts);
+    Serial.printf("[PortScan] %d connects made, %d saved by probe sessions\n", connectsMade, connectsSaved);
 
     return openPortCount;
 }
 
-PortResult PortScanner::getResult(int index) const
+int PortScanner::scanPorts(const char *targetIP, uint16_t startPort, uint16_t endPort,
+                           PortFoundCallback callback,
+                           PortProgressCallback progressCb,
+                           bool detectOS,
+                           bool serviceVersion)
+{
+    Serial.printf("[PortScan] Scanning %s ports %d-%d\n", targetIP, startPort, endPort);
+
+    configureScanOptions(detectOS, serviceVersion);
+
+    IPAddress ip;
+    resetTargets();
+    if (!ip.fromString(targetIP) || !addTarget(ip))
+    {
+        Serial.printf("[PortScan] Invalid target '%s'\n", targetIP);
+        return 0;
+    }
+
+    int portCount = endPort - startPort + 1;
+    return runScan(nullptr, startPort, portCount, callback, progressCb);
+}
+
+int PortScanner::scanCommonPorts(const char *targetIP, PortFoundCallback callback,
+                                 PortProgressCallback progressCb,
+                                 bool detectOS,
+                                 bool serviceVersion)
+{
+    Serial.printf("[PortScan] Scanning %s (common ports)\n", targetIP);
+
+    configureScanOptions(detectOS, serviceVersion);
+
+    IPAddress ip;
+    resetTargets();
+    if (!ip.fromString(targetIP) || !addTarget(ip))
+    {
+        Serial.printf("[PortScan] Invalid target '%s'\n", targetIP);
+        return 0;
+    }
+
+    return runScan(COMMON_PORTS, 0, COMMON_PORTS_COUNT, callback, progressCb);
+}
+
+int PortScanner::scanTopPorts(const char *targetIP, int count,
+                              PortFoundCallback callback,
+                              PortProgressCallback progressCb,
+                              bool detectOS,
+                              bool serviceVersion)
+{
+    count = clampTopPortCount(count);
+    Serial.printf("[PortScan] Scanning %s (top %d ports)\n", targetIP, count);
+
+    configureScanOptions(detectOS, serviceVersion);
+
+    IPAddress ip;
+    resetTargets();
+    if (!ip.fromString(targetIP) || !addTarget(ip))
+    {
+        Serial.printf("[PortScan] Invalid target '%s'\n", targetIP);
+        return 0;
+    }
+
+    // Submission follows table order, so completions arrive roughly by rank
+    return runScan(TOP_PORTS_TCP, 0, count, callback, progressCb);
+}
+
+int PortScanner::sweepHosts(const IPAddress *hosts, int hostCount,
+                            const uint16_t *portList, uint16_t startPort, int portCount,
+                            PortFoundCallback callback,
+                            PortProgressCallback progressCb,
+                            bool serviceVersion)
+{
+    // OS detection is per-target state; sweeps only identify services
+    configureScanOptions(false, serviceVersion);
+
+    resetTargets();
+    for (int i = 0; i < hostCount; i++)
+    {
+        if (!addTarget(hosts[i]))
+        {
+            Serial.printf("[PortScan] Sweep limited to %d hosts\n", MAX_TARGETS);
+            break;
+        }
+    }
+
+    Serial.printf("[PortScan] Sweeping %d hosts x %d ports\n", targetCount, portCount);
+
+    return runScan(portList, startPort, portCount, callback, progressCb);
+}
+
+bool PortScanner::getResult(int index, PortResultView &out) const
 {
-    if (index >= 0 && index < openPortCount)
+    if (!store.view(index, out))
     {
-        return results[index];
+        return false;
     }
-    PortResult empty = {0};
-    empty.valid = false;
-    return empty;
+    out.ip = targets[store.getTarget(index)].ip;
+    return true;
 }
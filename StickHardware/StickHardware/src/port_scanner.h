@@ -2,8 +2,14 @@
 #define PORT_SCANNER_H
 
 #include <WiFi.h>
-#include <WiFiClient.h>
 #include "config.h"
+#include "banner_matcher.h"
+#include "connect_engine.h"
+#include "probe_session.h"
+#include "syn_prober.h"
+#include "rate_controller.h"
+#include "rtt_estimator.h"
+#include "port_state_store.h"
 
 // ============================================================================
 // Port Scanner - TCP port scanning with banner grabbing
@@ -11,31 +17,64 @@
 
 struct PortResult
 {
+    char ip[16];
     uint16_t port;
     bool open;
-<<<<<<< HEAD
-    char service[16];
-    char banner[BANNER_MAX_SIZE];
-=======
     char service[32];
     char banner[BANNER_MAX_SIZE];
     char version[64];
     char os[24];
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
     bool valid;
 };
 
+// Per-host state for a scan job (one entry for single-target scans)
+struct ScanTarget
+{
+    uint32_t addr;      // Network byte order
+    char ip[16];
+    RttEstimator rtt;
+    uint16_t nextPort;  // Index of the next port to submit
+    uint8_t inFlight;   // Connects currently outstanding for this host
+    uint16_t openCount;
+};
+
+// How the discovery stage finds open ports
+enum class ScanMode : uint8_t
+{
+    CONNECT,  // Full TCP connect per port
+    SYN       // Half-open probes from a raw socket (single-target scans)
+};
+
 // Callback for open port found (streaming results)
 typedef void (*PortFoundCallback)(const PortResult &result);
 
 // Progress callback: current port being tested, percent (0-100), open count so far
 typedef void (*PortProgressCallback)(uint16_t currentPort, int percent, int openCount);
 
+// Enrichment progress: open ports with banner/service resolved, open ports discovered
+typedef void (*EnrichProgressCallback)(int enriched, int discovered);
+
+// Checkpoint for single-target scans: every port before resumeIndex (in scan
+// order) is finished and its open-port detail is stored
+typedef void (*ScanCheckpointCallback)(int resumeIndex);
+
+// Top-N port table access (clamped to the generated table size)
+const uint16_t *topPortsTable();
+int clampTopPortCount(int count);
+
 // Service identification based on port
 const char *identifyService(uint16_t port);
 
-// Service identification based on banner
-const char *identifyServiceByBanner(const char *banner, uint16_t port);
+// Service identification from a probe response using the generated probe
+// table. Fills version when a pattern captured one; falls back to the port.
+const char *matchServiceResponse(const char *response, size_t length, uint16_t port,
+                                 char *version, size_t versionSize);
+
+// Same, with the response's scanBannerSignatures() already in hand. Only
+// patterns whose required literal is in hits run; a set with every bit
+// on runs them all.
+const char *matchServiceResponse(const char *response, size_t length, uint16_t port,
+                                 const SignatureSet &hits, char *version, size_t versionSize);
 
 class PortScanner
 {
@@ -46,13 +85,6 @@ public:
     // Returns number of open ports found
     int scanPorts(const char *targetIP, uint16_t startPort, uint16_t endPort,
                   PortFoundCallback callback = nullptr,
-<<<<<<< HEAD
-                  PortProgressCallback progressCb = nullptr);
-
-    // Scan common ports only (faster)
-    int scanCommonPorts(const char *targetIP, PortFoundCallback callback = nullptr,
-                        PortProgressCallback progressCb = nullptr);
-=======
                   PortProgressCallback progressCb = nullptr,
                   bool detectOS = false,
                   bool serviceVersion = false);
@@ -62,55 +94,183 @@ public:
                         PortProgressCallback progressCb = nullptr,
                         bool detectOS = false,
                         bool serviceVersion = false);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+
+    // Scan the N most frequently open ports (generated table), in rank order
+    // so likely hits are reported first. N is clamped to the table size.
+    int scanTopPorts(const char *targetIP, int count,
+                     PortFoundCallback callback = nullptr,
+                     PortProgressCallback progressCb = nullptr,
+                     bool detectOS = false,
+                     bool serviceVersion = false);
+
+    // Scan the same port set on many hosts at once; probes are interleaved
+    // so a slow or filtered host cannot hold every connect slot.
+    // Walks portList[0..portCount) when given, else startPort..startPort+portCount-1.
+    // Takes the first MAX_SWEEP_HOSTS hosts (getTargetCount() says how many);
+    // callers sweep longer lists a batch at a time.
+    int sweepHosts(const IPAddress *hosts, int hostCount,
+                   const uint16_t *portList, uint16_t startPort, int portCount,
+                   PortFoundCallback callback = nullptr,
+                   PortProgressCallback progressCb = nullptr,
+                   bool serviceVersion = false);
 
     // Single port check
     bool checkPort(const char *targetIP, uint16_t port, PortResult &result);
 
     // Get results
+    // getOpenPortCount() counts every open port found; getResultCount() is how
+    // many of them kept detail (bounded by MAX_OPEN_PORT_RECORDS)
     int getOpenPortCount() const { return openPortCount; }
-    PortResult getResult(int index) const;
+    int getResultCount() const { return store.getOpenCount(); }
+    bool getResult(int index, PortResultView &out) const;
+    int getClosedPortCount() const { return closedPortCount; }
+    int getFilteredPortCount() const { return filteredPortCount; }
+
+    // Per-port state of the last single-target scan
+    PortState getPortState(uint16_t port) const { return store.getState(port); }
 
     // Progress tracking
     int getScanProgress() const { return scanProgress; }
     bool isScanning() const { return scanning; }
-<<<<<<< HEAD
-=======
     const char *getDetectedOS() const { return detectedOS; }
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+
+    // Timing stats (RTT for the first target, timeouts across all targets)
+    const RttEstimator &getRtt() const { return targets[0].rtt; }
+    int getTargetCount() const { return targetCount; }
+    int getConnectTimeouts() const { return connectTimeouts; }
+    int getBannerTimeouts() const { return bannerTimeouts; }
+
+    // Discovery mode for the next scan; init() resets it to CONNECT.
+    // SYN falls back to CONNECT (and reports it) for sweeps or when raw
+    // sockets are unavailable.
+    void setScanMode(ScanMode mode) { scanMode = mode; }
+    ScanMode getScanMode() const { return scanMode; }
+
+    // Probe rate ceiling in probes per second for the next scan (0 = default);
+    // init() resets it. The live rate backs off on send errors and sustained loss.
+    void setRateCeiling(uint32_t pps) { rateCeiling = pps; }
+    uint32_t getCurrentRate() const { return rate.getRate(); }
+
+    // Connects kept in flight for the next scan (0 = PARALLEL_PORT_SCANS);
+    // init() resets it. 1 probes one port at a time.
+    void setParallelism(int connects) { parallelism = connects; }
+
+    // TCP connections opened, and connections avoided by reusing probe sessions
+    int getConnectsMade() const { return connectsMade; }
+    int getConnectsSaved() const { return connectsSaved; }
+
+    // Optional progress stream for the enrichment stage (banners/services)
+    void setEnrichProgressCallback(EnrichProgressCallback cb) { enrichProgressCb = cb; }
+
+    // Periodic checkpoints (every SCAN_CHECKPOINT_INTERVAL_MS while the
+    // resume point moves, and once more if the scan is cancelled)
+    void setCheckpointCallback(ScanCheckpointCallback cb) { checkpointCb = cb; }
+
+    // Continue a single-target scan from a checkpoint. Call after init(),
+    // restore the open ports, then start the same scan again: it skips ports
+    // before resumeIndex and replays the restored ports through its callback.
+    bool beginResume(int resumeIndex, int closedCount, int filteredCount);
+    bool restoreOpenPort(const PortResult &result);
 
     // Cancel scan
     void cancelScan() { scanCancelled = true; }
+    bool wasCancelled() const { return scanCancelled; }
 
 private:
-    static const int MAX_OPEN_PORTS = 100;
-    PortResult results[MAX_OPEN_PORTS];
+    static const int MAX_TARGETS = MAX_SWEEP_HOSTS;
+    ScanTarget targets[MAX_TARGETS];
+    int targetCount = 0;
+    int nextTargetCursor = 0;
+    PortStateStore store;
     int openPortCount = 0;
+    int closedPortCount = 0;
+    int filteredPortCount = 0;
     int scanProgress = 0;
     bool scanning = false;
     bool scanCancelled = false;
-<<<<<<< HEAD
-=======
     bool detectOSFlag = false;
     bool serviceVersionFlag = false;
     bool osDetected = false;
     char detectedOS[24];
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+    ConnectEngine engine;
+
+    // Enrichment stage: open sockets waiting for a banner (bounded)
+    struct EnrichJob
+    {
+        ProbeSession session;
+        uint8_t target;
+    };
+    EnrichJob enrichJobs[ENRICH_QUEUE_DEPTH];
+    int enrichCount = 0;
+    int enrichedCount = 0;
+    EnrichProgressCallback enrichProgressCb = nullptr;
+    int connectTimeouts = 0;
+    int bannerTimeouts = 0;
+    int connectsMade = 0;
+    int connectsSaved = 0;
+
+    // Half-open discovery: probes in flight, and open ports awaiting a connect
+    ScanMode scanMode = ScanMode::CONNECT;
+    SynProber synProber;
+    uint16_t synOpenQueue[SYN_MAX_IN_FLIGHT];
+    int synOpenHead = 0;
+    int synOpenUsed = 0;
 
-    // TCP connect with timeout
-    bool tcpConnect(const char *host, uint16_t port, int timeoutMs);
+    // Probe pacing shared by both discovery modes
+    RateController rate;
+    uint32_t rateCeiling = 0;
+    int parallelism = 0;
 
-    // Grab banner from open connection
-    bool grabBanner(WiFiClient &client, char *buffer, size_t bufferSize, int timeoutMs);
-<<<<<<< HEAD
-=======
+    // Checkpoint/resume for single-target scans
+    ScanCheckpointCallback checkpointCb = nullptr;
+    int checkpointIndex = 0;
+    int reportedCheckpointIndex = -1;
+    unsigned long lastCheckpointMs = 0;
+    int resumeIndex = 0;
+    int resumeClosed = 0;
+    int resumeFiltered = 0;
+
+    // Target table management
+    void resetTargets();
+    bool addTarget(const IPAddress &ip);
+    int pickNextTarget(int portCount, int perHostCap) const;
+
+    // Shared sweep loop over targets[]: walks portList when given,
+    // else startPort..startPort+portCount-1 on every target
+    int runScan(const uint16_t *portList, uint16_t startPort, int portCount,
+                PortFoundCallback callback,
+                PortProgressCallback progressCb);
+
+    // SYN discovery over targets[0]; returns -1 if the raw socket is unavailable
+    int runSynScan(const uint16_t *portList, uint16_t startPort, int portCount,
+                   PortFoundCallback callback,
+                   PortProgressCallback progressCb);
+    void recordBareOpenPort(uint8_t targetIndex, uint16_t port, PortFoundCallback callback);
+
+    // Close sockets, run deferred OS detection and log the job summary
+    int finishScan(uint16_t lastPort, PortProgressCallback progressCb);
+
+    // Apply a pending resume point to targets[0]; returns the ports skipped
+    int applyResume(PortFoundCallback callback);
+    void checkpoint(const uint16_t *portList, uint16_t startPort, bool force);
+
+    // Open one connection and read its probe response into session.
+    // Returns false if the port did not accept the connection.
+    bool connectAndRead(ScanTarget &target, uint16_t port, ProbeSession &session);
+    void recordOpenPort(uint8_t targetIndex, const PortResult &result);
+
+    // Enrichment stage
+    void startEnrichment(const ConnectOutcome &outcome);
+    int enrichStep(uint32_t waitMs, PortFoundCallback callback);
+    void completeEnrichment(int index, PortFoundCallback callback);
+    void abortEnrichment();
 
     void configureScanOptions(bool detectOS, bool serviceVersion);
-    void ensureOsDetected(const char *targetIP);
-    bool detectOS(const char *targetIP, char *buffer, size_t bufferSize);
-    bool fetchServiceVersion(const char *targetIP, uint16_t port, const char *service, const char *banner, char *buffer, size_t bufferSize);
-    void determineService(const char *targetIP, uint16_t port, PortResult &result);
->>>>>>> f55fe60 (chore: add .gitignore and cleanup)
+    void ensureOsDetected(ScanTarget &target);
+    bool detectOS(ScanTarget &target, char *buffer, size_t bufferSize);
+
+    // Service, version and OS hint from the cached response of one connection
+    void determineService(const ScanTarget &target, const ProbeSession &session, PortResult &result);
 };
 
 extern PortScanner portScanner;
@@ -0,0 +1,175 @@
+#include "port_state_store.h"
+#include <stdlib.h>
+
+// ============================================================================
+// Port State Store - Implementation
+// ============================================================================
+
+bool PortStateStore::begin()
+{
+    if (!bitmaps)
+    {
+        // One block for the three bitmaps, records and pool
+        size_t bitmapBytes = 3 * BITMAP_WORDS * sizeof(uint32_t);
+        size_t recordBytes = MAX_OPEN_PORT_RECORDS * sizeof(OpenPortRecord);
+        uint8_t *block = (uint8_t *)malloc(bitmapBytes + recordBytes + PORT_TEXT_POOL_SIZE);
+        if (!block)
+        {
+            Serial.println("[PortStore] Allocation failed");
+            return false;
+        }
+        bitmaps = (uint32_t *)block;
+        records = (OpenPortRecord *)(block + bitmapBytes);
+        pool = (char *)(block + bitmapBytes + recordBytes);
+    }
+
+    clear();
+    return true;
+}
+
+void PortStateStore::clear()
+{
+    if (bitmaps)
+    {
+        memset(bitmaps, 0, 3 * BITMAP_WORDS * sizeof(uint32_t));
+    }
+    recordCount = 0;
+    poolUsed = 0;
+}
+
+uint32_t *PortStateStore::bitmapFor(PortState state) const
+{
+    switch (state)
+    {
+    case PortState::OPEN:
+        return bitmaps;
+    case PortState::CLOSED:
+        return bitmaps + BITMAP_WORDS;
+    case PortState::FILTERED:
+        return bitmaps + 2 * BITMAP_WORDS;
+    default:
+        return nullptr;
+    }
+}
+
+void PortStateStore::setState(uint16_t port, PortState state)
+{
+    if (!bitmaps)
+    {
+        return;
+    }
+
+    uint32_t word = port >> 5;
+    uint32_t bit = 1UL << (port & 31);
+
+    // A port holds exactly one state
+    bitmaps[word] &= ~bit;
+    bitmaps[BITMAP_WORDS + word] &= ~bit;
+    bitmaps[2 * BITMAP_WORDS + word] &= ~bit;
+
+    uint32_t *map = bitmapFor(state);
+    if (map)
+    {
+        map[word] |= bit;
+    }
+}
+
+PortState PortStateStore::getState(uint16_t port) const
+{
+    if (!bitmaps)
+    {
+        return PortState::UNKNOWN;
+    }
+
+    uint32_t word = port >> 5;
+    uint32_t bit = 1UL << (port & 31);
+
+    if (bitmaps[word] & bit)
+        return PortState::OPEN;
+    if (bitmaps[BITMAP_WORDS + word] & bit)
+        return PortState::CLOSED;
+    if (bitmaps[2 * BITMAP_WORDS + word] & bit)
+        return PortState::FILTERED;
+    return PortState::UNKNOWN;
+}
+
+uint32_t PortStateStore::countState(PortState state) const
+{
+    const uint32_t *map = bitmaps ? bitmapFor(state) : nullptr;
+    if (!map)
+    {
+        return 0;
+    }
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < BITMAP_WORDS; i++)
+    {
+        total += __builtin_popcount(map[i]);
+    }
+    return total;
+}
+
+uint16_t PortStateStore::storeText(const char *text)
+{
+    if (!text || text[0] == '\0' || !pool)
+    {
+        return NO_TEXT;
+    }
+
+    size_t len = strlen(text);
+    if (poolUsed + len + 1 > PORT_TEXT_POOL_SIZE)
+    {
+        // Keep what fits; a truncated banner beats none
+        if (poolUsed + 1 >= PORT_TEXT_POOL_SIZE)
+        {
+            return NO_TEXT;
+        }
+        len = PORT_TEXT_POOL_SIZE - poolUsed - 1;
+    }
+
+    uint16_t offset = (uint16_t)poolUsed;
+    memcpy(pool + poolUsed, text, len);
+    pool[poolUsed + len] = '\0';
+    poolUsed += len + 1;
+    return offset;
+}
+
+const char *PortStateStore::textAt(uint16_t offset) const
+{
+    return (offset == NO_TEXT) ? "" : pool + offset;
+}
+
+int PortStateStore::addOpenPort(uint8_t target, uint16_t port, const char *service,
+                                const char *banner, const char *version, const char *os)
+{
+    if (!records || recordCount >= MAX_OPEN_PORT_RECORDS)
+    {
+        return -1;
+    }
+
+    OpenPortRecord &rec = records[recordCount];
+    rec.port = port;
+    rec.target = target;
+    rec.serviceOff = storeText(service);
+    rec.bannerOff = storeText(banner);
+    rec.versionOff = storeText(version);
+    rec.osOff = storeText(os);
+    return recordCount++;
+}
+
+bool PortStateStore::view(int index, PortResultView &out) const
+{
+    if (index < 0 || index >= recordCount)
+    {
+        return false;
+    }
+
+    const OpenPortRecord &rec = records[index];
+    out.ip = "";
+    out.port = rec.port;
+    out.service = textAt(rec.serviceOff);
+    out.banner = textAt(rec.bannerOff);
+    out.version = textAt(rec.versionOff);
+    out.os = textAt(rec.osOff);
+    return true;
+}
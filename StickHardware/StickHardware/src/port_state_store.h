@@ -0,0 +1,88 @@
+#ifndef PORT_STATE_STORE_H
+#define PORT_STATE_STORE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Port State Store - Bitmaps for port states, string pool for open-port detail
+// ============================================================================
+// One 8 KB bitmap per state covers all 65536 ports of a single target.
+// Service/banner/version/OS text is kept only for open ports, packed as
+// NUL-terminated strings in a shared pool and referenced by offset.
+// Storage is heap-allocated on first use (PSRAM when available).
+// ============================================================================
+
+enum class PortState : uint8_t
+{
+    UNKNOWN,
+    OPEN,
+    CLOSED,
+    FILTERED
+};
+
+// Read-only view of an open port; pointers reference the store's pool
+struct PortResultView
+{
+    const char *ip;
+    uint16_t port;
+    const char *service;
+    const char *banner;
+    const char *version;
+    const char *os;
+};
+
+class PortStateStore
+{
+public:
+    static const uint32_t PORT_SPACE = 65536;
+    static const uint32_t BITMAP_WORDS = PORT_SPACE / 32;   // 2048 words = 8 KB
+
+    // Allocate (once) and clear. Returns false if allocation failed.
+    bool begin();
+    void clear();
+
+    // Per-port state (single-target scans)
+    void setState(uint16_t port, PortState state);
+    PortState getState(uint16_t port) const;
+    uint32_t countState(PortState state) const;
+
+    // Open-port detail. target is the scanner's target index.
+    // Returns the record index, or -1 when the record table is full.
+    int addOpenPort(uint8_t target, uint16_t port, const char *service,
+                    const char *banner, const char *version, const char *os);
+
+    int getOpenCount() const { return recordCount; }
+    uint8_t getTarget(int index) const { return records[index].target; }
+
+    // Fill a view for record index (ip is left to the caller)
+    bool view(int index, PortResultView &out) const;
+
+    // Bytes used by banners/versions, for diagnostics
+    size_t getPoolUsed() const { return poolUsed; }
+
+private:
+    static const uint16_t NO_TEXT = 0xFFFF;
+
+    struct OpenPortRecord
+    {
+        uint16_t port;
+        uint8_t target;
+        uint16_t serviceOff;
+        uint16_t bannerOff;
+        uint16_t versionOff;
+        uint16_t osOff;
+    };
+
+    uint32_t *bitmaps = nullptr;        // OPEN, CLOSED, FILTERED back to back
+    OpenPortRecord *records = nullptr;
+    char *pool = nullptr;
+    int recordCount = 0;
+    size_t poolUsed = 0;
+
+    uint32_t *bitmapFor(PortState state) const;
+    uint16_t storeText(const char *text);
+    const char *textAt(uint16_t offset) const;
+};
+
+#endif // PORT_STATE_STORE_H
@@ -0,0 +1,277 @@
+#include "probe_session.h"
+#include "tls_fingerprint.h"
+#include <lwip/sockets.h>
+#include <ctype.h>
+
+// ============================================================================
+// Probe Session - Implementation
+// ============================================================================
+
+// Four bytes at a time: true when none is a control byte or >= 0x7F.
+// Borrows can flag the wrong byte, but never miss or invent one.
+static inline bool allPrintable(uint32_t word)
+{
+    uint32_t below = (word - 0x20202020u) & ~word & 0x80808080u; // some byte < 0x20
+    uint32_t above = ((word + 0x01010101u) | word) & 0x80808080u; // some byte > 0x7E
+    return (below | above) == 0;
+}
+
+// Look for the end of a response in buffer[from, to). Greeting protocols
+// end at their first line break; a binary greeting has no line structure,
+// so its first non-text byte ends it too.
+static bool findDelimiter(ResponseFraming framing, const char *buffer, size_t from, size_t to)
+{
+    if (framing == ResponseFraming::HTTP)
+    {
+        for (size_t i = (from >= 3) ? from - 3 : 0; i + 4 <= to; i++)
+        {
+            if (buffer[i] == '\r' && memcmp(buffer + i, "\r\n\r\n", 4) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t i = from;
+    for (; i + 4 <= to; i += 4)
+    {
+        uint32_t word;
+        memcpy(&word, buffer + i, sizeof(word));
+        if (!allPrintable(word))
+        {
+            break;
+        }
+    }
+    for (; i < to; i++)
+    {
+        uint8_t c = (uint8_t)buffer[i];
+        if (c == '\n' || ((c < 0x20 || c >= 0x7F) && c != '\r' && c != '\t'))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ProbeSession::begin(int socketFd, uint16_t portNumber, unsigned long deadlineMs, ResponseFraming responseFraming)
+{
+    fd = socketFd;
+    port = portNumber;
+    deadline = deadlineMs;
+    framing = responseFraming;
+    peerClosed = false;
+    delimiterSeen = false;
+    length = 0;
+    buffer[0] = '\0';
+}
+
+void ProbeSession::sendProbe(const uint8_t *payload, size_t payloadLen, const char *hostIp)
+{
+    if (fd < 0 || payloadLen == 0)
+    {
+        return;
+    }
+
+    static const char HOST_TOKEN[] = "{host}";
+    const size_t tokenLen = sizeof(HOST_TOKEN) - 1;
+    size_t hostLen = strlen(hostIp);
+
+    char request[PROBE_REQUEST_MAX_SIZE];
+    size_t len = 0;
+    for (size_t i = 0; i < payloadLen;)
+    {
+        if (i + tokenLen <= payloadLen && memcmp(payload + i, HOST_TOKEN, tokenLen) == 0 &&
+            len + hostLen <= sizeof(request))
+        {
+            memcpy(request + len, hostIp, hostLen);
+            len += hostLen;
+            i += tokenLen;
+            continue;
+        }
+        if (len >= sizeof(request))
+        {
+            break;
+        }
+        request[len++] = (char)payload[i++];
+    }
+
+    send(fd, request, len, 0);
+}
+
+bool ProbeSession::responseComplete() const
+{
+    if (peerClosed || length >= sizeof(buffer) - 1)
+    {
+        return true;
+    }
+    if (length == 0)
+    {
+        return false;
+    }
+    // TLS: wait for ServerHelloDone; HTTP and greetings: for their
+    // delimiter; replies to a request: first read
+    switch (framing)
+    {
+    case ResponseFraming::TLS:
+        return tlsFlightComplete((const uint8_t *)buffer, length);
+    case ResponseFraming::REPLY:
+        return true;
+    default:
+        return delimiterSeen;
+    }
+}
+
+bool ProbeSession::readAvailable()
+{
+    if (fd < 0)
+    {
+        return true;
+    }
+
+    // Drain whole socket reads; only the new bytes are searched
+    while (length < sizeof(buffer) - 1)
+    {
+        int n = recv(fd, buffer + length, sizeof(buffer) - 1 - length, MSG_DONTWAIT);
+        if (n > 0)
+        {
+            if (!delimiterSeen && (framing == ResponseFraming::HTTP || framing == ResponseFraming::GREETING))
+            {
+                delimiterSeen = findDelimiter(framing, buffer, length, length + n);
+            }
+            length += n;
+            buffer[length] = '\0';
+            continue;
+        }
+        if (n == 0)
+        {
+            peerClosed = true;
+        }
+        break; // EAGAIN or error
+    }
+
+    return responseComplete();
+}
+
+void ProbeSession::close()
+{
+    if (fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool ProbeSession::firstLine(char *out, size_t outSize) const
+{
+    if (outSize == 0)
+    {
+        return false;
+    }
+
+    size_t n = 0;
+    while (n < length && buffer[n] != '\r' && buffer[n] != '\n' && n < outSize - 1)
+    {
+        out[n] = buffer[n];
+        n++;
+    }
+    out[n] = '\0';
+    return n > 0;
+}
+
+bool ProbeSession::header(const char *name, char *out, size_t outSize) const
+{
+    if (!isHttp() || outSize == 0)
+    {
+        return false;
+    }
+
+    size_t nameLen = strlen(name);
+    const char *line = buffer;
+    const char *end = buffer + length;
+
+    while (line < end)
+    {
+        const char *eol = (const char *)memchr(line, '\n', end - line);
+        if (!eol)
+        {
+            eol = end;
+        }
+
+        if ((size_t)(eol - line) > nameLen && line[nameLen] == ':' &&
+            strncasecmp(line, name, nameLen) == 0)
+        {
+            const char *value = line + nameLen + 1;
+            while (value < eol && *value == ' ')
+            {
+                value++;
+            }
+            size_t n = 0;
+            while (value + n < eol && value[n] != '\r' && n < outSize - 1)
+            {
+                out[n] = value[n];
+                n++;
+            }
+            out[n] = '\0';
+            return n > 0;
+        }
+
+        if (eol - line <= 1)
+        {
+            break; // blank line: end of headers
+        }
+        line = eol + 1;
+    }
+
+    out[0] = '\0';
+    return false;
+}
+
+size_t printableText(const char *data, size_t length, char *out, size_t outSize)
+{
+    if (outSize == 0)
+    {
+        return 0;
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < length && n < outSize - 1;)
+    {
+        // Fast path: copy runs of printable text a word at a time
+        if (i + 4 <= length && n + 4 <= outSize - 1)
+        {
+            uint32_t word;
+            memcpy(&word, data + i, sizeof(word));
+            if (allPrintable(word))
+            {
+                memcpy(out + n, &word, sizeof(word));
+                i += 4;
+                n += 4;
+                continue;
+            }
+        }
+
+        char c = data[i++];
+        if (c >= 32 && c < 127)
+        {
+            out[n++] = c;
+        }
+        else if (c == '\n' || c == '\r')
+        {
+            out[n++] = ' ';
+        }
+    }
+
+    // Trim trailing spaces
+    while (n > 0 && out[n - 1] == ' ')
+    {
+        n--;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+size_t ProbeSession::bannerText(char *out, size_t outSize) const
+{
+    return printableText(buffer, length, out, outSize);
+}
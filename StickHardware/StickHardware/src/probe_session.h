@@ -0,0 +1,77 @@
+#ifndef PROBE_SESSION_H
+#define PROBE_SESSION_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Probe Session - One connection per open port, with a cache of its response
+// ============================================================================
+// The session sends the port's probe (if any) once, keeps the raw response
+// bytes, and answers banner/header/version questions from that cache so no
+// later stage needs to reconnect.
+// ============================================================================
+
+// When a response counts as complete (besides peer close or a full cache)
+enum class ResponseFraming : uint8_t
+{
+    GREETING,    // No probe sent: first line break, or the first byte of a binary greeting
+    REPLY,       // Request/response probes: whatever the first read returns
+    HTTP,        // End of the response headers
+    TLS          // End of the server's first handshake flight, or an alert
+};
+
+// Printable text of a response: bytes outside 32..126 dropped, CR and LF
+// folded to spaces, trailing spaces trimmed. Returns the length written.
+size_t printableText(const char *data, size_t length, char *out, size_t outSize);
+
+class ProbeSession
+{
+public:
+    // Take ownership of a connected socket
+    void begin(int fd, uint16_t port, unsigned long deadline, ResponseFraming framing);
+
+    // Send the probe payload from the service probe table, with {host}
+    // replaced by hostIp. An empty payload sends nothing.
+    void sendProbe(const uint8_t *payload, size_t payloadLen, const char *hostIp);
+
+    // Pull whatever is readable without blocking.
+    // Returns true once the response is complete (or the peer closed).
+    bool readAvailable();
+
+    // Close the socket; the cache stays readable
+    void close();
+
+    int getFd() const { return fd; }
+    uint16_t getPort() const { return port; }
+    unsigned long getDeadline() const { return deadline; }
+    bool isHttp() const { return framing == ResponseFraming::HTTP; }
+    bool isTls() const { return framing == ResponseFraming::TLS; }
+
+    // Raw cached response
+    const char *raw() const { return buffer; }
+    size_t rawLength() const { return length; }
+
+    // First response line (status line or service greeting), without CR/LF
+    bool firstLine(char *out, size_t outSize) const;
+
+    // HTTP header value by case-insensitive name, e.g. "Server"
+    bool header(const char *name, char *out, size_t outSize) const;
+
+    // printableText() of the cached response
+    size_t bannerText(char *out, size_t outSize) const;
+
+private:
+    int fd = -1;
+    uint16_t port = 0;
+    unsigned long deadline = 0;
+    ResponseFraming framing = ResponseFraming::GREETING;
+    bool peerClosed = false;
+    bool delimiterSeen = false;  // End of response seen (HTTP and greeting framing)
+    size_t length = 0;
+    char buffer[PROBE_SESSION_BUFFER_SIZE];
+
+    bool responseComplete() const;
+};
+
+#endif // PROBE_SESSION_H
@@ -0,0 +1,122 @@
+#include "rate_controller.h"
+
+// ============================================================================
+// Rate Controller - Implementation
+// ============================================================================
+
+void RateController::begin(uint32_t ceilingPps)
+{
+    ceiling = ceilingPps > 0 ? ceilingPps : RATE_DEFAULT_PPS;
+    if (ceiling < RATE_MIN_PPS)
+    {
+        ceiling = RATE_MIN_PPS;
+    }
+    rate = ceiling / 2.0f;
+    if (rate < RATE_MIN_PPS)
+    {
+        rate = RATE_MIN_PPS;
+    }
+    tokens = 1;
+    lastRefillMs = millis();
+    lastBackoffMs = 0;
+    backoffs = 0;
+    windowOutcomes = 0;
+    windowLost = 0;
+}
+
+void RateController::refill()
+{
+    unsigned long now = millis();
+    unsigned long elapsed = now - lastRefillMs;
+    if (elapsed == 0)
+    {
+        return;
+    }
+    lastRefillMs = now;
+
+    // Bucket holds RATE_BURST_MS worth of tokens (at least one)
+    float capacity = rate * RATE_BURST_MS / 1000.0f;
+    if (capacity < 1)
+    {
+        capacity = 1;
+    }
+    tokens += rate * elapsed / 1000.0f;
+    if (tokens > capacity)
+    {
+        tokens = capacity;
+    }
+}
+
+bool RateController::tryAcquire()
+{
+    refill();
+    if (tokens < 1)
+    {
+        return false;
+    }
+    tokens -= 1;
+    return true;
+}
+
+uint32_t RateController::msUntilToken()
+{
+    refill();
+    if (tokens >= 1)
+    {
+        return 0;
+    }
+    return (uint32_t)((1 - tokens) * 1000.0f / rate) + 1;
+}
+
+void RateController::onAnswered()
+{
+    // Additive increase: about RATE_INCREASE_PPS per second of answered traffic
+    rate += (float)RATE_INCREASE_PPS / rate;
+    if (rate > ceiling)
+    {
+        rate = ceiling;
+    }
+    countOutcome(false);
+}
+
+void RateController::onProbeLost()
+{
+    countOutcome(true);
+}
+
+void RateController::countOutcome(bool lost)
+{
+    if (lost)
+    {
+        windowLost++;
+    }
+    if (++windowOutcomes < RATE_LOSS_WINDOW)
+    {
+        return;
+    }
+
+    bool congested = windowLost * 100 > RATE_LOSS_PERCENT * windowOutcomes;
+    windowOutcomes = 0;
+    windowLost = 0;
+    if (congested)
+    {
+        onLoss();
+    }
+}
+
+void RateController::onLoss()
+{
+    unsigned long now = millis();
+    if (backoffs > 0 && now - lastBackoffMs < RATE_BACKOFF_HOLD_MS)
+    {
+        return;
+    }
+
+    lastBackoffMs = now;
+    backoffs++;
+    rate /= 2;
+    if (rate < RATE_MIN_PPS)
+    {
+        rate = RATE_MIN_PPS;
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef RATE_CONTROLLER_H
+#define RATE_CONTROLLER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Rate Controller - Token bucket with AIMD adjustment for probe pacing
+// ============================================================================
+// Probes are sent only when a token is available. The refill rate starts at
+// half the ceiling, grows additively while probes are answered and halves
+// on a send error (at most once per hold window, so one burst of errors
+// counts as one congestion event). Probes known to be lost only count
+// toward a fraction: the rate halves when more than RATE_LOSS_PERCENT of
+// RATE_LOSS_WINDOW outcomes were lost, so the odd dropped frame on WiFi
+// does not. A timeout alone is not a loss: a filtered port never answers
+// either.
+// ============================================================================
+
+class RateController
+{
+public:
+    // Reset to a new ceiling in probes per second (0 = RATE_DEFAULT_PPS)
+    void begin(uint32_t ceilingPps = 0);
+
+    // Take one token if available
+    bool tryAcquire();
+
+    // Milliseconds until the next token is available (0 if one is ready)
+    uint32_t msUntilToken();
+
+    // Feedback from probe outcomes
+    void onAnswered();
+    void onLoss();       // Send error: backs off right away
+    void onProbeLost();  // Lost in transit (e.g. only a retransmission answered)
+
+    uint32_t getRate() const { return (uint32_t)rate; }
+    uint32_t getCeiling() const { return ceiling; }
+    uint32_t getBackoffCount() const { return backoffs; }
+
+private:
+    float rate = RATE_DEFAULT_PPS / 2;
+    float tokens = 0;
+    uint32_t ceiling = RATE_DEFAULT_PPS;
+    unsigned long lastRefillMs = 0;
+    unsigned long lastBackoffMs = 0;
+    uint32_t backoffs = 0;
+    uint16_t windowOutcomes = 0;
+    uint16_t windowLost = 0;
+
+    void refill();
+    void countOutcome(bool lost);
+};
+
+#endif // RATE_CONTROLLER_H
@@ -0,0 +1,91 @@
+#include "rtt_estimator.h"
+
+// ============================================================================
+// RTT Estimator - Implementation
+// ============================================================================
+
+void RttEstimator::reset()
+{
+    srttMs = 0;
+    rttvarMs = 0;
+    minRttMs = 0;
+    maxRttMs = 0;
+    samples = 0;
+}
+
+void RttEstimator::addSample(uint32_t rttMs)
+{
+    if (samples == 0)
+    {
+        // First measurement: SRTT = R, RTTVAR = R/2
+        srttMs = rttMs;
+        rttvarMs = rttMs / 2;
+        minRttMs = rttMs;
+        maxRttMs = rttMs;
+    }
+    else
+    {
+        // RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, SRTT = 7/8 SRTT + 1/8 R
+        uint32_t delta = (srttMs > rttMs) ? srttMs - rttMs : rttMs - srttMs;
+        rttvarMs = (3 * rttvarMs + delta) / 4;
+        srttMs = (7 * srttMs + rttMs) / 8;
+        if (rttMs < minRttMs)
+            minRttMs = rttMs;
+        if (rttMs > maxRttMs)
+            maxRttMs = rttMs;
+    }
+
+    if (samples < 0xFFFF)
+    {
+        samples++;
+    }
+}
+
+void RttEstimator::seed(uint32_t rttMs)
+{
+    addSample(rttMs);
+    if (samples < RTT_SEED_SAMPLES)
+    {
+        samples = RTT_SEED_SAMPLES;
+    }
+}
+
+uint32_t RttEstimator::connectTimeoutMs() const
+{
+    if (!isSeeded())
+    {
+        return PORT_CONNECT_TIMEOUT_MS;
+    }
+
+    // RTO = SRTT + max(G, 4 * RTTVAR); G is our loop granularity
+    uint32_t variance = 4 * rttvarMs;
+    if (variance < RTT_CLOCK_GRANULARITY_MS)
+    {
+        variance = RTT_CLOCK_GRANULARITY_MS;
+    }
+    uint32_t rto = srttMs + variance;
+
+    if (rto < RTT_MIN_CONNECT_TIMEOUT_MS)
+        return RTT_MIN_CONNECT_TIMEOUT_MS;
+    if (rto > PORT_CONNECT_TIMEOUT_MS)
+        return PORT_CONNECT_TIMEOUT_MS;
+    return rto;
+}
+
+uint32_t RttEstimator::bannerTimeoutMs() const
+{
+    if (!isSeeded())
+    {
+        return BANNER_READ_TIMEOUT_MS;
+    }
+
+    // Services answer after the handshake plus their own think time,
+    // so allow a few RTOs before giving up on a banner
+    uint32_t timeout = RTT_BANNER_RTO_MULTIPLIER * connectTimeoutMs();
+
+    if (timeout < RTT_MIN_BANNER_TIMEOUT_MS)
+        return RTT_MIN_BANNER_TIMEOUT_MS;
+    if (timeout > BANNER_READ_TIMEOUT_MS)
+        return BANNER_READ_TIMEOUT_MS;
+    return timeout;
+}
@@ -0,0 +1,46 @@
+#ifndef RTT_ESTIMATOR_H
+#define RTT_ESTIMATOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// RTT Estimator - Per-target smoothed RTT and variance (RFC 6298 style)
+// ============================================================================
+// Until RTT_SEED_SAMPLES handshakes have been measured (or the target was
+// pinged by network_scan) the fixed PORT_CONNECT_TIMEOUT_MS /
+// BANNER_READ_TIMEOUT_MS ceilings are used.
+// ============================================================================
+
+class RttEstimator
+{
+public:
+    void reset();
+
+    // Feed the duration of a completed handshake (SYN-ACK or RST)
+    void addSample(uint32_t rttMs);
+
+    // Seed from an externally measured RTT (an echo from network_scan).
+    // It counts as a full seed, so the first probes already use it.
+    void seed(uint32_t rttMs);
+
+    // Current timeouts, clamped to [min, configured ceiling]
+    uint32_t connectTimeoutMs() const;
+    uint32_t bannerTimeoutMs() const;
+
+    bool isSeeded() const { return samples >= RTT_SEED_SAMPLES; }
+    uint32_t getSmoothedRtt() const { return srttMs; }
+    uint32_t getRttVariance() const { return rttvarMs; }
+    uint32_t getMinRtt() const { return minRttMs; }
+    uint32_t getMaxRtt() const { return maxRttMs; }
+    uint16_t getSampleCount() const { return samples; }
+
+private:
+    uint32_t srttMs = 0;
+    uint32_t rttvarMs = 0;
+    uint32_t minRttMs = 0;
+    uint32_t maxRttMs = 0;
+    uint16_t samples = 0;
+};
+
+#endif // RTT_ESTIMATOR_H
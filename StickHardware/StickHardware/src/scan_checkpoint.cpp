@@ -0,0 +1,267 @@
+#include "scan_checkpoint.h"
+#include <LittleFS.h>
+
+// ============================================================================
+// Scan Checkpoint - Implementation
+// ============================================================================
+
+ScanCheckpoint scanCheckpoint;
+
+static const char *CHECKPOINT_TEMP_PATH = SCAN_CHECKPOINT_PATH ".tmp";
+
+uint32_t simpleCrc32(const uint8_t *data, size_t len, uint32_t crc)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++)
+        {
+            uint32_t mask = -(crc & 1);
+            crc = (crc >> 1) ^ (0xEDB88320 & mask);
+        }
+    }
+    return ~crc;
+}
+
+// Append bytes to the payload, keeping its CRC and length
+static bool writePayload(File &file, const void *data, size_t len, uint32_t &crc, uint32_t &length)
+{
+    crc = simpleCrc32((const uint8_t *)data, len, crc);
+    length += len;
+    return file.write((const uint8_t *)data, len) == len;
+}
+
+// One length-prefixed string (at most 255 bytes)
+static bool writeText(File &file, const char *text, uint32_t &crc, uint32_t &length)
+{
+    size_t len = text ? strlen(text) : 0;
+    if (len > 255)
+    {
+        len = 255;
+    }
+    uint8_t prefix = (uint8_t)len;
+    return writePayload(file, &prefix, 1, crc, length) &&
+           writePayload(file, text, len, crc, length);
+}
+
+static bool readText(File &file, char *out, size_t outSize)
+{
+    uint8_t len;
+    if (file.read(&len, 1) != 1)
+    {
+        return false;
+    }
+
+    // Keep what fits, skip the rest
+    uint8_t buf[255];
+    if (file.read(buf, len) != len)
+    {
+        return false;
+    }
+    size_t keep = (len < outSize - 1) ? len : outSize - 1;
+    memcpy(out, buf, keep);
+    out[keep] = '\0';
+    return true;
+}
+
+bool ScanCheckpoint::begin()
+{
+    mounted = LittleFS.begin(true);
+    if (!mounted)
+    {
+        Serial.println("[Checkpoint] LittleFS mount failed - scans will not be resumable");
+    }
+    return mounted;
+}
+
+void ScanCheckpoint::start(const CommandData &cmd)
+{
+    clear();
+    job = cmd;
+    active = true;
+}
+
+bool ScanCheckpoint::save(const PortScanner &scanner, int resumeIndex)
+{
+    if (!mounted || !active)
+    {
+        return false;
+    }
+
+    File file = LittleFS.open(CHECKPOINT_TEMP_PATH, "w");
+    if (!file)
+    {
+        Serial.println("[Checkpoint] Could not open checkpoint file");
+        return false;
+    }
+
+    Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.command = (uint8_t)job.cmd;
+    header.flags = (job.osDetect ? FLAG_OS_DETECT : 0) |
+                   (job.serviceVersion ? FLAG_SERVICE_VERSION : 0) |
+                   (job.synScan ? FLAG_SYN : 0);
+    snprintf(header.targetIP, sizeof(header.targetIP), "%s", job.targetIP);
+    header.portStart = job.portStart;
+    header.portEnd = job.portEnd;
+    header.topPorts = job.topPorts;
+    header.rate = job.rate;
+    header.resumeIndex = resumeIndex;
+    header.closedCount = scanner.getClosedPortCount();
+    header.filteredCount = scanner.getFilteredPortCount();
+
+    // Header is rewritten once the payload length and CRC are known
+    bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+
+    uint32_t crc = 0;
+    PortResultView view;
+    for (int i = 0; ok && scanner.getResult(i, view); i++)
+    {
+        ok = writePayload(file, &view.port, sizeof(view.port), crc, header.payloadLength) &&
+             writeText(file, view.service, crc, header.payloadLength) &&
+             writeText(file, view.version, crc, header.payloadLength) &&
+             writeText(file, view.banner, crc, header.payloadLength);
+        header.recordCount++;
+    }
+
+    header.crc = simpleCrc32((const uint8_t *)&header, sizeof(header), crc);
+    ok = ok && file.seek(0) &&
+         file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+    file.close();
+
+    if (!ok)
+    {
+        Serial.println("[Checkpoint] Write failed");
+        LittleFS.remove(CHECKPOINT_TEMP_PATH);
+        return false;
+    }
+
+    // rename() replaces the old checkpoint in one step; only if the
+    // filesystem refuses to overwrite is the old one removed first
+    if (!LittleFS.rename(CHECKPOINT_TEMP_PATH, SCAN_CHECKPOINT_PATH))
+    {
+        LittleFS.remove(SCAN_CHECKPOINT_PATH);
+        if (!LittleFS.rename(CHECKPOINT_TEMP_PATH, SCAN_CHECKPOINT_PATH))
+        {
+            Serial.println("[Checkpoint] Rename failed");
+            return false;
+        }
+    }
+
+    Serial.printf("[Checkpoint] Saved %s at index %d (%d open)\n",
+                  job.targetIP, resumeIndex, (int)header.recordCount);
+    return true;
+}
+
+void ScanCheckpoint::clear()
+{
+    active = false;
+    if (mounted && LittleFS.exists(SCAN_CHECKPOINT_PATH))
+    {
+        LittleFS.remove(SCAN_CHECKPOINT_PATH);
+    }
+}
+
+bool ScanCheckpoint::readVerified(File &file, Header &header)
+{
+    if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != MAGIC || header.version != VERSION ||
+        file.size() != sizeof(header) + header.payloadLength)
+    {
+        return false;
+    }
+
+    uint32_t crc = 0;
+    uint8_t chunk[64];
+    uint32_t remaining = header.payloadLength;
+    while (remaining > 0)
+    {
+        size_t n = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+        if (file.read(chunk, n) != n)
+        {
+            return false;
+        }
+        crc = simpleCrc32(chunk, n, crc);
+        remaining -= n;
+    }
+
+    uint32_t stored = header.crc;
+    header.crc = 0;
+    crc = simpleCrc32((const uint8_t *)&header, sizeof(header), crc);
+    header.crc = stored;
+    if (crc != stored)
+    {
+        return false;
+    }
+
+    // Leave the file positioned at the first record
+    return file.seek(sizeof(header));
+}
+
+bool ScanCheckpoint::load(CommandData &cmd)
+{
+    if (!mounted || !LittleFS.exists(SCAN_CHECKPOINT_PATH))
+    {
+        return false;
+    }
+
+    File file = LittleFS.open(SCAN_CHECKPOINT_PATH, "r");
+    Header header;
+    bool ok = file && readVerified(file, header);
+    file.close();
+    if (!ok)
+    {
+        Serial.println("[Checkpoint] Stored checkpoint is damaged - discarding");
+        LittleFS.remove(SCAN_CHECKPOINT_PATH);
+        return false;
+    }
+
+    cmd = CommandData();
+    cmd.cmd = (BLECommand)header.command;
+    memcpy(cmd.targetIP, header.targetIP, sizeof(cmd.targetIP) - 1);
+    cmd.portStart = header.portStart;
+    cmd.portEnd = header.portEnd;
+    cmd.topPorts = header.topPorts;
+    cmd.rate = header.rate;
+    cmd.osDetect = (header.flags & FLAG_OS_DETECT) != 0;
+    cmd.serviceVersion = (header.flags & FLAG_SERVICE_VERSION) != 0;
+    cmd.synScan = (header.flags & FLAG_SYN) != 0;
+    job = cmd;
+    return true;
+}
+
+bool ScanCheckpoint::restore(PortScanner &scanner)
+{
+    File file = LittleFS.open(SCAN_CHECKPOINT_PATH, "r");
+    Header header;
+    if (!file || !readVerified(file, header) ||
+        !scanner.beginResume(header.resumeIndex, header.closedCount, header.filteredCount))
+    {
+        file.close();
+        return false;
+    }
+
+    PortResult result;
+    for (uint32_t i = 0; i < header.recordCount; i++)
+    {
+        memset(&result, 0, sizeof(result));
+        if (file.read((uint8_t *)&result.port, sizeof(result.port)) != sizeof(result.port) ||
+            !readText(file, result.service, sizeof(result.service)) ||
+            !readText(file, result.version, sizeof(result.version)) ||
+            !readText(file, result.banner, sizeof(result.banner)))
+        {
+            break;
+        }
+        result.open = true;
+        result.valid = true;
+        scanner.restoreOpenPort(result);
+    }
+    file.close();
+
+    // Later saves overwrite this checkpoint with the job load() returned
+    active = true;
+    return true;
+}
@@ -0,0 +1,81 @@
+#ifndef SCAN_CHECKPOINT_H
+#define SCAN_CHECKPOINT_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "config.h"
+#include "bluetooth_handler.h"
+#include "port_scanner.h"
+
+// ============================================================================
+// Scan Checkpoint - Resumable single-target port scans persisted to LittleFS
+// ============================================================================
+// One binary record: a fixed header (the job, the resume index and the
+// closed/filtered counts) followed by the open ports found so far as
+// length-prefixed service/version/banner strings. A CRC-32 over both guards
+// against a write torn by power loss; the file is written to a temporary
+// name and renamed into place.
+// ============================================================================
+
+// CRC-32 (IEEE 802.3). Pass the previous result as crc to continue a run.
+uint32_t simpleCrc32(const uint8_t *data, size_t len, uint32_t crc = 0);
+
+class ScanCheckpoint
+{
+public:
+    // Mount the filesystem (formats it on first use)
+    bool begin();
+
+    // A new checkpointed job starts; any older checkpoint is dropped
+    void start(const CommandData &cmd);
+
+    // Persist the job with ports before resumeIndex finished
+    bool save(const PortScanner &scanner, int resumeIndex);
+
+    // Job finished - nothing left to resume
+    void clear();
+
+    // Job of the stored checkpoint, if it is intact
+    bool load(CommandData &cmd);
+
+    // Hand the resume point and open ports to a freshly init()ed scanner;
+    // the loaded job then continues checkpointing
+    bool restore(PortScanner &scanner);
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t command;         // BLECommand of the job
+        uint8_t flags;           // FLAG_* below
+        uint8_t reserved;
+        char targetIP[16];
+        uint16_t portStart;
+        uint16_t portEnd;
+        uint16_t topPorts;
+        uint16_t rate;
+        uint32_t resumeIndex;
+        uint32_t closedCount;
+        uint32_t filteredCount;
+        uint32_t recordCount;
+        uint32_t payloadLength;
+        uint32_t crc;            // Over the payload, then the header with crc = 0
+    };
+
+    static const uint32_t MAGIC = 0x4B43534E; // "NSCK"
+    static const uint8_t VERSION = 1;
+    static const uint8_t FLAG_OS_DETECT = 0x01;
+    static const uint8_t FLAG_SERVICE_VERSION = 0x02;
+    static const uint8_t FLAG_SYN = 0x04;
+
+    CommandData job;
+    bool mounted = false;
+    bool active = false;
+
+    bool readVerified(fs::File &file, Header &header);
+};
+
+extern ScanCheckpoint scanCheckpoint;
+
+#endif // SCAN_CHECKPOINT_H
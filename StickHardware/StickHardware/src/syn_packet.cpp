@@ -0,0 +1,149 @@
+#include "syn_packet.h"
+#include <string.h>
+
+// ============================================================================
+// SYN Packet - Implementation
+// ============================================================================
+
+static const uint8_t TCP_FIN = 0x01;
+static const uint8_t TCP_SYN = 0x02;
+static const uint8_t TCP_RST = 0x04;
+static const uint8_t TCP_ACK = 0x10;
+static const uint8_t IP_PROTO_TCP_NUM = 6;
+
+static inline uint16_t readBe16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t readBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void writeBe16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static inline void writeBe32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static uint32_t sumWords(const uint8_t *data, size_t length, uint32_t sum)
+{
+    for (size_t i = 0; i + 1 < length; i += 2)
+    {
+        sum += readBe16(data + i);
+    }
+    if (length & 1)
+    {
+        sum += (uint32_t)data[length - 1] << 8;
+    }
+    return sum;
+}
+
+uint32_t synCookie(uint32_t secret, uint32_t ip, uint16_t port)
+{
+    // Small integer mix (murmur3 finaliser); only needs to be unguessable
+    // enough that stray segments do not pass as replies
+    uint32_t h = secret ^ ip ^ ((uint32_t)port * 0x9E3779B1u);
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+size_t buildSynSegment(uint8_t *out, size_t outSize,
+                       uint32_t srcIp, uint32_t dstIp,
+                       uint16_t srcPort, uint16_t dstPort, uint32_t seq)
+{
+    if (outSize < SYN_SEGMENT_SIZE)
+    {
+        return 0;
+    }
+
+    memset(out, 0, SYN_SEGMENT_SIZE);
+    writeBe16(out + 0, srcPort);
+    writeBe16(out + 2, dstPort);
+    writeBe32(out + 4, seq);
+    out[12] = (SYN_SEGMENT_SIZE / 4) << 4;  // data offset
+    out[13] = TCP_SYN;
+    writeBe16(out + 14, 1024);              // window
+    out[20] = 2;                            // MSS option
+    out[21] = 4;
+    writeBe16(out + 22, 1460);
+
+    // Checksum over the pseudo-header (addresses are already network order)
+    uint8_t pseudo[12];
+    memcpy(pseudo + 0, &srcIp, 4);
+    memcpy(pseudo + 4, &dstIp, 4);
+    pseudo[8] = 0;
+    pseudo[9] = IP_PROTO_TCP_NUM;
+    writeBe16(pseudo + 10, SYN_SEGMENT_SIZE);
+
+    uint32_t sum = sumWords(pseudo, sizeof(pseudo), 0);
+    sum = sumWords(out, SYN_SEGMENT_SIZE, sum);
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    writeBe16(out + 16, (uint16_t)~sum);
+
+    return SYN_SEGMENT_SIZE;
+}
+
+SynReplyKind classifySynReply(const uint8_t *packet, size_t length,
+                              uint16_t localPort, uint32_t secret,
+                              SynReply &out)
+{
+    out.kind = SynReplyKind::NONE;
+
+    if (!packet || length < 20 || (packet[0] >> 4) != 4)
+    {
+        return SynReplyKind::NONE;
+    }
+
+    size_t ipHeaderLen = (size_t)(packet[0] & 0x0F) * 4;
+    if (ipHeaderLen < 20 || packet[9] != IP_PROTO_TCP_NUM || length < ipHeaderLen + 20)
+    {
+        return SynReplyKind::NONE;
+    }
+    if (readBe16(packet + 6) & 0x1FFF)
+    {
+        return SynReplyKind::NONE; // non-first fragment
+    }
+
+    const uint8_t *tcp = packet + ipHeaderLen;
+    if (readBe16(tcp + 2) != localPort)
+    {
+        return SynReplyKind::NONE;
+    }
+
+    memcpy(&out.ip, packet + 12, 4);
+    out.port = readBe16(tcp);
+
+    uint8_t flags = tcp[13];
+    uint32_t ack = readBe32(tcp + 8);
+    if (!(flags & TCP_ACK) || ack != synCookie(secret, out.ip, out.port) + 1)
+    {
+        return SynReplyKind::NONE;
+    }
+
+    if (flags & TCP_RST)
+    {
+        out.kind = SynReplyKind::RST;
+    }
+    else if ((flags & (TCP_SYN | TCP_FIN)) == TCP_SYN)
+    {
+        out.kind = SynReplyKind::SYN_ACK;
+    }
+    return out.kind;
+}
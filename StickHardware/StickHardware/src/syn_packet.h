@@ -0,0 +1,46 @@
+#ifndef SYN_PACKET_H
+#define SYN_PACKET_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// SYN Packet - Segment building and reply classification for half-open scans
+// ============================================================================
+// Pure functions over byte buffers (no lwIP or Arduino dependencies) so the
+// classifier can be fed recorded packets off-device. Addresses are in network
+// byte order as stored by IPAddress; ports are host order.
+// ============================================================================
+
+static const size_t SYN_SEGMENT_SIZE = 24;  // TCP header + MSS option
+
+enum class SynReplyKind : uint8_t
+{
+    NONE,     // Not an answer to one of our probes
+    SYN_ACK,  // Port open
+    RST       // Port closed
+};
+
+struct SynReply
+{
+    uint32_t ip;
+    uint16_t port;
+    SynReplyKind kind;
+};
+
+// Initial sequence number for a probe; replies must acknowledge it + 1
+uint32_t synCookie(uint32_t secret, uint32_t ip, uint16_t port);
+
+// Write a SYN segment (TCP header only; the IP layer adds its own header).
+// Returns the segment length, or 0 if out is too small.
+size_t buildSynSegment(uint8_t *out, size_t outSize,
+                       uint32_t srcIp, uint32_t dstIp,
+                       uint16_t srcPort, uint16_t dstPort, uint32_t seq);
+
+// Classify a received IPv4 packet (starting at the IP header). Only segments
+// sent to localPort whose ACK matches the probe cookie are accepted.
+SynReplyKind classifySynReply(const uint8_t *packet, size_t length,
+                              uint16_t localPort, uint32_t secret,
+                              SynReply &out);
+
+#endif // SYN_PACKET_H
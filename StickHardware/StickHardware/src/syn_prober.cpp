@@ -0,0 +1,144 @@
+#include "syn_prober.h"
+#include <lwip/sockets.h>
+#include <esp_system.h>
+
+// ============================================================================
+// SYN Prober - Implementation
+// ============================================================================
+
+bool SynProber::begin(uint32_t ip)
+{
+    end();
+
+    fd = socket(AF_INET, SOCK_RAW, IPPROTO_TCP);
+    if (fd < 0)
+    {
+        Serial.println("[SynScan] Raw socket unavailable (LWIP_RAW disabled?)");
+        return false;
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    localIp = ip;
+    // lwIP hands out local ports from 49152 up; stay below that range so
+    // the TCP layer never owns our source port
+    localPort = 40000 + (esp_random() % 9152);
+    secret = esp_random();
+    pendingHead = 0;
+    pendingUsed = 0;
+    return true;
+}
+
+void SynProber::end()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    pendingHead = 0;
+    pendingUsed = 0;
+}
+
+bool SynProber::send(uint32_t ip, uint16_t port, uint8_t attempt)
+{
+    if (fd < 0 || !hasRoom())
+    {
+        return false;
+    }
+
+    uint8_t segment[SYN_SEGMENT_SIZE];
+    size_t len = buildSynSegment(segment, sizeof(segment), localIp, ip,
+                                 localPort, port, synCookie(secret, ip, port));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip;
+
+    if (sendto(fd, segment, len, 0, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        return false; // out of pbufs - caller retries later
+    }
+
+    Pending &entry = pending[(pendingHead + pendingUsed) % MAX_PENDING];
+    entry.sentMs = millis();
+    entry.port = port;
+    entry.attempt = attempt;
+    pendingUsed++;
+    return true;
+}
+
+int SynProber::receive(SynReply *out, int maxOut, uint32_t waitMs)
+{
+    if (fd < 0 || maxOut <= 0)
+    {
+        return 0;
+    }
+
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    struct timeval tv;
+    tv.tv_sec = waitMs / 1000;
+    tv.tv_usec = (waitMs % 1000) * 1000;
+    if (select(fd + 1, &readSet, nullptr, nullptr, &tv) <= 0)
+    {
+        return 0;
+    }
+
+    // IP header (up to 60) + TCP header (up to 60); payload is not needed
+    uint8_t packet[120];
+    int produced = 0;
+    while (produced < maxOut)
+    {
+        int n = recv(fd, packet, sizeof(packet), MSG_DONTWAIT);
+        if (n <= 0)
+        {
+            break;
+        }
+        if (classifySynReply(packet, n, localPort, secret, out[produced]) != SynReplyKind::NONE)
+        {
+            produced++;
+        }
+    }
+    return produced;
+}
+
+bool SynProber::oldest(uint16_t &port, uint8_t &attempt, unsigned long &sentMs) const
+{
+    if (pendingUsed == 0)
+    {
+        return false;
+    }
+    const Pending &entry = pending[pendingHead];
+    port = entry.port;
+    attempt = entry.attempt;
+    sentMs = entry.sentMs;
+    return true;
+}
+
+void SynProber::dropOldest()
+{
+    if (pendingUsed > 0)
+    {
+        pendingHead = (pendingHead + 1) % MAX_PENDING;
+        pendingUsed--;
+    }
+}
+
+bool SynProber::pendingSend(uint16_t port, uint8_t &attempt, unsigned long &sentMs) const
+{
+    for (int i = 0; i < pendingUsed; i++)
+    {
+        const Pending &entry = pending[(pendingHead + i) % MAX_PENDING];
+        if (entry.port == port)
+        {
+            attempt = entry.attempt;
+            sentMs = entry.sentMs;
+            return true;
+        }
+    }
+    return false;
+}
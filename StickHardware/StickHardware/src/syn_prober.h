@@ -0,0 +1,64 @@
+#ifndef SYN_PROBER_H
+#define SYN_PROBER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "syn_packet.h"
+
+// ============================================================================
+// SYN Prober - Half-open probes through an lwIP raw socket
+// ============================================================================
+// SYNs are built by hand and sent from a scan-private source port. Replies
+// are read from the same raw socket (lwIP hands raw PCBs a copy of every TCP
+// segment before the TCP layer). The TCP layer then answers our SYN-ACKs
+// with RST since no PCB owns the port, so no handshake is ever completed.
+// Each outstanding probe costs one Pending entry instead of a socket.
+// ============================================================================
+
+class SynProber
+{
+public:
+    static const int MAX_PENDING = SYN_MAX_IN_FLIGHT;
+
+    // Open the raw socket. localIp is our station address (network order).
+    bool begin(uint32_t localIp);
+    void end();
+    bool isOpen() const { return fd >= 0; }
+
+    // Send a SYN and queue it as pending. attempt 0 is the first send.
+    bool send(uint32_t ip, uint16_t port, uint8_t attempt);
+
+    // Wait up to waitMs for replies; returns how many were written to out
+    int receive(SynReply *out, int maxOut, uint32_t waitMs);
+
+    // Pending probes, oldest first
+    int pendingCount() const { return pendingUsed; }
+    bool hasRoom() const { return pendingUsed < MAX_PENDING; }
+    bool oldest(uint16_t &port, uint8_t &attempt, unsigned long &sentMs) const;
+    void dropOldest();
+
+    // Attempt and send time of the probe still pending for port. Returns
+    // false if none.
+    bool pendingSend(uint16_t port, uint8_t &attempt, unsigned long &sentMs) const;
+
+    uint16_t getLocalPort() const { return localPort; }
+
+private:
+    struct Pending
+    {
+        unsigned long sentMs;
+        uint16_t port;
+        uint8_t attempt;
+    };
+
+    int fd = -1;
+    uint32_t localIp = 0;
+    uint16_t localPort = 0;
+    uint32_t secret = 0;
+
+    Pending pending[MAX_PENDING];
+    int pendingHead = 0;
+    int pendingUsed = 0;
+};
+
+#endif // SYN_PROBER_H
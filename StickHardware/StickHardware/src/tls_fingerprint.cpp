@@ -0,0 +1,596 @@
+#include "tls_fingerprint.h"
+#include <string.h>
+#include <stdio.h>
+
+// ============================================================================
+// TLS Fingerprint - Implementation
+// ============================================================================
+
+static const uint8_t TLS_CONTENT_CHANGE_CIPHER_SPEC = 20;
+static const uint8_t TLS_CONTENT_ALERT = 21;
+static const uint8_t TLS_CONTENT_HANDSHAKE = 22;
+static const uint8_t TLS_CONTENT_APPLICATION_DATA = 23;
+
+static const uint8_t TLS_SERVER_HELLO = 2;
+static const uint8_t TLS_CERTIFICATE = 11;
+static const uint8_t TLS_SERVER_HELLO_DONE = 14;
+
+static const uint16_t TLS_EXT_SUPPORTED_VERSIONS = 0x002b;
+static const int MAX_JA3S_EXTENSIONS = 16;
+
+// ----------------------------------------------------------------------------
+// Handshake byte stream across record boundaries
+// ----------------------------------------------------------------------------
+
+class HandshakeReader
+{
+public:
+    HandshakeReader(const uint8_t *data, size_t len) : data(data), len(len) {}
+
+    bool readByte(uint8_t &b)
+    {
+        if (!ensure())
+        {
+            return false;
+        }
+        b = data[pos++];
+        consumed++;
+        return true;
+    }
+
+    bool peekByte(uint8_t &b)
+    {
+        if (!ensure())
+        {
+            return false;
+        }
+        b = data[pos];
+        return true;
+    }
+
+    // Big-endian integer of 1..4 bytes
+    bool readUint(size_t bytes, uint32_t &value)
+    {
+        value = 0;
+        for (size_t i = 0; i < bytes; i++)
+        {
+            uint8_t b;
+            if (!readByte(b))
+            {
+                return false;
+            }
+            value = (value << 8) | b;
+        }
+        return true;
+    }
+
+    // Copy n bytes (out may be null to skip)
+    bool read(uint8_t *out, size_t n)
+    {
+        while (n > 0)
+        {
+            if (!ensure())
+            {
+                return false;
+            }
+            size_t chunk = end - pos;
+            if (chunk > n)
+            {
+                chunk = n;
+            }
+            if (out)
+            {
+                memcpy(out, data + pos, chunk);
+                out += chunk;
+            }
+            pos += chunk;
+            consumed += chunk;
+            n -= chunk;
+        }
+        return true;
+    }
+
+    // Skip forward to an absolute stream offset
+    bool skipTo(size_t target)
+    {
+        return target >= consumed && read(nullptr, target - consumed);
+    }
+
+    size_t offset() const { return consumed; }
+    uint8_t alert() const { return alertCode; }
+    bool foreign() const { return notTls; }
+    bool sealed() const { return encrypted; }
+
+private:
+    const uint8_t *data;
+    size_t len;
+    size_t next = 0;      // Next record header
+    size_t pos = 0;       // Read position in the current record
+    size_t end = 0;       // End of the current record's payload (clipped)
+    size_t consumed = 0;  // Handshake bytes consumed
+    uint8_t alertCode = 0;
+    bool notTls = false;
+    bool encrypted = false; // Reached encrypted records (TLS 1.3)
+
+    bool ensure()
+    {
+        while (pos >= end)
+        {
+            if (next + 5 > len || alertCode != 0 || notTls || encrypted)
+            {
+                return false;
+            }
+            uint8_t type = data[next];
+            size_t payload = next + 5;
+            size_t recordLen = ((size_t)data[next + 3] << 8) | data[next + 4];
+            if (data[next + 1] != 0x03)
+            {
+                notTls = true;
+                return false;
+            }
+            next = payload + recordLen;
+
+            if (type == TLS_CONTENT_HANDSHAKE)
+            {
+                pos = payload;
+                end = (next < len) ? next : len;
+            }
+            else if (type == TLS_CONTENT_ALERT)
+            {
+                // Level, description; a zero description (close_notify) still counts
+                alertCode = (payload + 1 < len) ? data[payload + 1] : 0xFF;
+                if (alertCode == 0)
+                {
+                    alertCode = 0xFF;
+                }
+                return false;
+            }
+            else if (type == TLS_CONTENT_APPLICATION_DATA)
+            {
+                // TLS 1.3 encrypts everything after the ServerHello
+                encrypted = true;
+                return false;
+            }
+            else if (type != TLS_CONTENT_CHANGE_CIPHER_SPEC)
+            {
+                notTls = true;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// MD5 (RFC 1321), for the JA3S digest
+// ----------------------------------------------------------------------------
+
+static const uint32_t MD5_K[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+static const uint8_t MD5_SHIFT[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+
+static void md5Block(uint32_t state[4], const uint8_t block[64])
+{
+    uint32_t m[16];
+    for (int i = 0; i < 16; i++)
+    {
+        m[i] = (uint32_t)block[i * 4] | ((uint32_t)block[i * 4 + 1] << 8) |
+               ((uint32_t)block[i * 4 + 2] << 16) | ((uint32_t)block[i * 4 + 3] << 24);
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    for (int i = 0; i < 64; i++)
+    {
+        uint32_t f;
+        int g;
+        if (i < 16)
+        {
+            f = (b & c) | (~b & d);
+            g = i;
+        }
+        else if (i < 32)
+        {
+            f = (d & b) | (~d & c);
+            g = (5 * i + 1) % 16;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3 * i + 5) % 16;
+        }
+        else
+        {
+            f = c ^ (b | ~d);
+            g = (7 * i) % 16;
+        }
+        uint32_t rotate = a + f + MD5_K[i] + m[g];
+        int s = MD5_SHIFT[(i / 16) * 4 + i % 4];
+        a = d;
+        d = c;
+        c = b;
+        b += (rotate << s) | (rotate >> (32 - s));
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+// Hex digest of a short string (the JA3S input is well under 128 bytes)
+static void md5Hex(const char *text, char out[33])
+{
+    uint32_t state[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    size_t len = strlen(text);
+    uint8_t block[64];
+    size_t done = 0;
+
+    while (len - done >= 64)
+    {
+        md5Block(state, (const uint8_t *)text + done);
+        done += 64;
+    }
+
+    // Padding: 0x80, zeros, then the bit length in the last 8 bytes
+    size_t rest = len - done;
+    memset(block, 0, sizeof(block));
+    memcpy(block, text + done, rest);
+    block[rest] = 0x80;
+    if (rest >= 56)
+    {
+        md5Block(state, block);
+        memset(block, 0, sizeof(block));
+    }
+    uint64_t bits = (uint64_t)len * 8;
+    for (int i = 0; i < 8; i++)
+    {
+        block[56 + i] = (uint8_t)(bits >> (8 * i));
+    }
+    md5Block(state, block);
+
+    for (int i = 0; i < 16; i++)
+    {
+        snprintf(out + i * 2, 3, "%02x", (uint8_t)(state[i / 4] >> (8 * (i % 4))));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ServerHello
+// ----------------------------------------------------------------------------
+
+static void parseServerHello(HandshakeReader &r, size_t msgEnd, TlsFingerprint &fp)
+{
+    uint32_t legacyVersion, sessionIdLen, cipher;
+    if (!r.readUint(2, legacyVersion) || !r.read(nullptr, 32) ||
+        !r.readUint(1, sessionIdLen) || !r.read(nullptr, sessionIdLen) ||
+        !r.readUint(2, cipher) || !r.read(nullptr, 1))
+    {
+        return;
+    }
+
+    fp.serverHello = true;
+    fp.version = (uint16_t)legacyVersion;
+    fp.cipher = (uint16_t)cipher;
+
+    // JA3S: version,cipher,extensions (in the order the server sent them)
+    char ja3s[128];
+    int used = snprintf(ja3s, sizeof(ja3s), "%u,%u,", (unsigned)legacyVersion, (unsigned)cipher);
+
+    uint32_t extLen;
+    if (r.offset() + 2 <= msgEnd && r.readUint(2, extLen))
+    {
+        size_t extEnd = r.offset() + extLen;
+        int count = 0;
+        while (r.offset() + 4 <= extEnd)
+        {
+            uint32_t type, len;
+            if (!r.readUint(2, type) || !r.readUint(2, len))
+            {
+                break;
+            }
+            if (count < MAX_JA3S_EXTENSIONS && used < (int)sizeof(ja3s))
+            {
+                used += snprintf(ja3s + used, sizeof(ja3s) - used, "%s%u", count ? "-" : "", (unsigned)type);
+                count++;
+            }
+
+            uint32_t selected;
+            if (type == TLS_EXT_SUPPORTED_VERSIONS && len == 2 && r.readUint(2, selected))
+            {
+                fp.version = (uint16_t)selected;
+                len = 0;
+            }
+            if (!r.read(nullptr, len))
+            {
+                break;
+            }
+        }
+    }
+
+    md5Hex(ja3s, fp.ja3s);
+}
+
+// ----------------------------------------------------------------------------
+// Certificate (leaf only): DER walked in stream order
+// ----------------------------------------------------------------------------
+
+static bool readDerHeader(HandshakeReader &r, uint8_t &tag, uint32_t &length)
+{
+    uint8_t first;
+    if (!r.readByte(tag) || !r.readByte(first))
+    {
+        return false;
+    }
+    if (first < 0x80)
+    {
+        length = first;
+        return true;
+    }
+    size_t bytes = first & 0x7F;
+    return bytes >= 1 && bytes <= 3 && r.readUint(bytes, length);
+}
+
+static bool skipDer(HandshakeReader &r, uint8_t expectedTag)
+{
+    uint8_t tag;
+    uint32_t length;
+    return readDerHeader(r, tag, length) && tag == expectedTag && r.read(nullptr, length);
+}
+
+// Best attribute of a Name: CN, else O, else OU. out is only written once
+// the whole Name was read, so a truncated one never shows a lesser attribute.
+static bool parseName(HandshakeReader &r, char *out, size_t outSize)
+{
+    static const uint8_t OID_PREFIX[2] = {0x55, 0x04}; // 2.5.4.x
+    uint8_t tag;
+    uint32_t length;
+    if (!readDerHeader(r, tag, length) || tag != 0x30)
+    {
+        return false;
+    }
+
+    size_t nameEnd = r.offset() + length;
+    char best[64] = {0};
+    int bestRank = 0;
+    while (r.offset() < nameEnd)
+    {
+        uint32_t setLen, seqLen, oidLen, valueLen;
+        uint8_t oid[3] = {0};
+        if (!readDerHeader(r, tag, setLen) || tag != 0x31 ||
+            !readDerHeader(r, tag, seqLen) || tag != 0x30)
+        {
+            return false;
+        }
+        size_t attrEnd = r.offset() + seqLen;
+        if (!readDerHeader(r, tag, oidLen) || tag != 0x06)
+        {
+            return false;
+        }
+        size_t oidKeep = oidLen < sizeof(oid) ? oidLen : sizeof(oid);
+        if (!r.read(oid, oidKeep) || !r.read(nullptr, oidLen - oidKeep))
+        {
+            return false;
+        }
+
+        int rank = 0;
+        if (oidLen == 3 && memcmp(oid, OID_PREFIX, 2) == 0)
+        {
+            rank = (oid[2] == 0x03) ? 3 : (oid[2] == 0x0a) ? 2 : (oid[2] == 0x0b) ? 1 : 0;
+        }
+
+        if (!readDerHeader(r, tag, valueLen))
+        {
+            return false;
+        }
+        char value[64];
+        size_t keep = valueLen < sizeof(value) - 1 ? valueLen : sizeof(value) - 1;
+        if (!r.read((uint8_t *)value, keep))
+        {
+            return false;
+        }
+        value[keep] = '\0';
+
+        if (rank > bestRank)
+        {
+            bestRank = rank;
+            for (size_t i = 0; i <= keep; i++)
+            {
+                char c = value[i];
+                best[i] = (c == '\0' || (c >= 0x20 && c < 0x7F)) ? c : '?';
+            }
+        }
+
+        if (!r.skipTo(attrEnd))
+        {
+            return false;
+        }
+    }
+
+    strncpy(out, best, outSize - 1);
+    out[outSize - 1] = '\0';
+    return true;
+}
+
+static bool parseExpiry(HandshakeReader &r, char out[11])
+{
+    uint8_t tag;
+    uint32_t length;
+    if (!readDerHeader(r, tag, length) || tag != 0x30 ||
+        !readDerHeader(r, tag, length) || !r.read(nullptr, length) || // notBefore
+        !readDerHeader(r, tag, length))
+    {
+        return false;
+    }
+
+    // UTCTime YYMMDDhhmmssZ or GeneralizedTime YYYYMMDDhhmmssZ
+    char t[16] = {0};
+    if (length > sizeof(t) - 1 || !r.read((uint8_t *)t, length))
+    {
+        return false;
+    }
+    if (tag == 0x17 && length >= 6)
+    {
+        int yy = (t[0] - '0') * 10 + (t[1] - '0');
+        snprintf(out, 11, "%d-%.2s-%.2s", yy < 50 ? 2000 + yy : 1900 + yy, t + 2, t + 4);
+        return true;
+    }
+    if (tag == 0x18 && length >= 8)
+    {
+        snprintf(out, 11, "%.4s-%.2s-%.2s", t, t + 4, t + 6);
+        return true;
+    }
+    return false;
+}
+
+static void parseCertificate(HandshakeReader &r, TlsFingerprint &fp)
+{
+    uint32_t listLen, certLen, length;
+    uint8_t tag, next;
+    if (!r.readUint(3, listLen) || !r.readUint(3, certLen) ||
+        !readDerHeader(r, tag, length) || tag != 0x30 || // Certificate
+        !readDerHeader(r, tag, length) || tag != 0x30 || // TBSCertificate
+        !r.peekByte(next))
+    {
+        return;
+    }
+
+    if ((next == 0xA0 && !skipDer(r, 0xA0)) || // [0] version
+        !skipDer(r, 0x02) ||                    // serialNumber
+        !skipDer(r, 0x30) ||                    // signature algorithm
+        !parseName(r, fp.issuer, sizeof(fp.issuer)) ||
+        !parseExpiry(r, fp.notAfter) ||
+        !parseName(r, fp.subject, sizeof(fp.subject)))
+    {
+        return;
+    }
+    fp.certificate = true;
+}
+
+// ----------------------------------------------------------------------------
+// Public API
+// ----------------------------------------------------------------------------
+
+bool tlsFlightComplete(const uint8_t *data, size_t len)
+{
+    if (len == 0)
+    {
+        return false;
+    }
+
+    HandshakeReader r(data, len);
+    while (true)
+    {
+        uint8_t type;
+        uint32_t msgLen;
+        if (!r.readByte(type) || !r.readUint(3, msgLen))
+        {
+            break;
+        }
+        if (type == TLS_SERVER_HELLO_DONE)
+        {
+            return true;
+        }
+        if (!r.read(nullptr, msgLen))
+        {
+            break;
+        }
+    }
+    return r.alert() != 0 || r.foreign() || r.sealed() || (data[0] != TLS_CONTENT_HANDSHAKE && data[0] != TLS_CONTENT_ALERT);
+}
+
+bool parseTlsFlight(const uint8_t *data, size_t len, TlsFingerprint &fp)
+{
+    memset(&fp, 0, sizeof(fp));
+
+    HandshakeReader r(data, len);
+    while (true)
+    {
+        uint8_t type;
+        uint32_t msgLen;
+        if (!r.readByte(type) || !r.readUint(3, msgLen))
+        {
+            break;
+        }
+        size_t msgEnd = r.offset() + msgLen;
+
+        if (type == TLS_SERVER_HELLO)
+        {
+            parseServerHello(r, msgEnd, fp);
+        }
+        else if (type == TLS_CERTIFICATE)
+        {
+            parseCertificate(r, fp);
+        }
+        else if (type == TLS_SERVER_HELLO_DONE)
+        {
+            break;
+        }
+
+        if (!r.skipTo(msgEnd))
+        {
+            break;
+        }
+    }
+
+    fp.alert = r.alert();
+    return fp.serverHello || fp.alert != 0;
+}
+
+const char *tlsVersionName(uint16_t version)
+{
+    switch (version)
+    {
+    case 0x0300:
+        return "SSLv3";
+    case 0x0301:
+        return "TLSv1.0";
+    case 0x0302:
+        return "TLSv1.1";
+    case 0x0303:
+        return "TLSv1.2";
+    case 0x0304:
+        return "TLSv1.3";
+    default:
+        return "TLS";
+    }
+}
+
+size_t formatTlsFingerprint(const TlsFingerprint &fp, char *out, size_t outSize)
+{
+    if (outSize == 0)
+    {
+        return 0;
+    }
+    out[0] = '\0';
+
+    int used;
+    if (!fp.serverHello)
+    {
+        used = snprintf(out, outSize, "TLS alert %u", (unsigned)fp.alert);
+    }
+    else
+    {
+        used = snprintf(out, outSize, "%s cipher=0x%04X ja3s=%s",
+                        tlsVersionName(fp.version), (unsigned)fp.cipher, fp.ja3s);
+    }
+
+    const char *labels[3] = {" subject=", " issuer=", " expires="};
+    const char *values[3] = {fp.subject, fp.issuer, fp.notAfter};
+    for (int i = 0; i < 3 && used >= 0 && (size_t)used < outSize; i++)
+    {
+        if (values[i][0] != '\0')
+        {
+            used += snprintf(out + used, outSize - used, "%s%s", labels[i], values[i]);
+        }
+    }
+
+    size_t len = strlen(out);
+    return len;
+}
@@ -0,0 +1,45 @@
+#ifndef TLS_FINGERPRINT_H
+#define TLS_FINGERPRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// TLS Fingerprint - Parse the server's first handshake flight
+// ============================================================================
+// The ClientHello is an ordinary entry in the service probe table; this
+// module only reads what the server sent back on the same connection:
+// ServerHello (version, cipher, extensions -> JA3S) and the leaf certificate
+// (subject, issuer, expiry). No keys are exchanged and nothing is verified.
+// Parsing stops quietly wherever the cached response was cut off.
+// Pure functions over byte buffers, no socket or Arduino dependencies.
+// ============================================================================
+
+struct TlsFingerprint
+{
+    uint16_t version;     // Negotiated version (supported_versions wins), e.g. 0x0303
+    uint16_t cipher;      // Selected cipher suite
+    char ja3s[33];        // MD5 hex of "version,cipher,ext-ext-..."
+    char subject[64];     // Leaf certificate subject (CN, else O/OU)
+    char issuer[64];
+    char notAfter[11];    // "YYYY-MM-DD"
+    uint8_t alert;        // Alert description if the server refused, else 0
+    bool serverHello;
+    bool certificate;     // Subject/issuer/expiry were read
+};
+
+// True once the flight is complete: ServerHelloDone, encrypted records
+// (TLS 1.3), an alert, or a response that is not TLS at all
+bool tlsFlightComplete(const uint8_t *data, size_t len);
+
+// Returns true if a ServerHello or an alert was found
+bool parseTlsFlight(const uint8_t *data, size_t len, TlsFingerprint &fp);
+
+// "TLSv1.2", "SSLv3", ... ("TLS" for unknown values)
+const char *tlsVersionName(uint16_t version);
+
+// One-line summary for banners, e.g.
+// "TLSv1.2 cipher=0xC02F ja3s=... subject=example.com issuer=R3 expires=2025-01-31"
+size_t formatTlsFingerprint(const TlsFingerprint &fp, char *out, size_t outSize);
+
+#endif // TLS_FINGERPRINT_H
@@ -0,0 +1,503 @@
+#include "udp_scanner.h"
+#include <lwip/sockets.h>
+
+// ============================================================================
+// UDP Scanner - Implementation
+// ============================================================================
+
+UdpScanner udpScanner;
+
+// ============================================================================
+// Probe Payloads
+// ============================================================================
+
+// DNS: standard query for the root NS records (answered by most resolvers)
+static const uint8_t DNS_PAYLOAD[] = {
+    0x4E, 0x53, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x01};
+
+// NTP: v4 client request (LI=3, VN=4, mode=3), rest zero
+static const uint8_t NTP_PAYLOAD[48] = {0xE3};
+
+// SNMP: v1 GetRequest, community "public", sysDescr.0
+static const uint8_t SNMP_PAYLOAD[] = {
+    0x30, 0x26, 0x02, 0x01, 0x00, 0x04, 0x06, 'p', 'u', 'b', 'l', 'i', 'c',
+    0xA0, 0x19, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+    0x30, 0x0E, 0x30, 0x0C, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
+    0x05, 0x00};
+
+// SSDP: unicast M-SEARCH
+static const char SSDP_PAYLOAD[] =
+    "M-SEARCH * HTTP/1.1\r\n"
+    "HOST: 239.255.255.250:1900\r\n"
+    "MAN: \"ssdp:discover\"\r\n"
+    "MX: 1\r\n"
+    "ST: ssdp:all\r\n\r\n";
+
+// mDNS: unicast PTR query for _services._dns-sd._udp.local
+static const uint8_t MDNS_PAYLOAD[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, '_', 's', 'e', 'r', 'v', 'i', 'c', 'e', 's',
+    0x07, '_', 'd', 'n', 's', '-', 's', 'd',
+    0x04, '_', 'u', 'd', 'p',
+    0x05, 'l', 'o', 'c', 'a', 'l',
+    0x00, 0x00, 0x0C, 0x00, 0x01};
+
+// CoAP: confirmable GET /.well-known/core
+static const uint8_t COAP_PAYLOAD[] = {
+    0x40, 0x01, 0x4E, 0x53,
+    0xBB, '.', 'w', 'e', 'l', 'l', '-', 'k', 'n', 'o', 'w', 'n',
+    0x04, 'c', 'o', 'r', 'e'};
+
+struct UdpProbe
+{
+    uint16_t port;
+    const char *service;
+    const uint8_t *payload;
+    uint8_t length;
+};
+
+static const UdpProbe UDP_PROBES[] = {
+    {53, "DNS", DNS_PAYLOAD, sizeof(DNS_PAYLOAD)},
+    {123, "NTP", NTP_PAYLOAD, sizeof(NTP_PAYLOAD)},
+    {161, "SNMP", SNMP_PAYLOAD, sizeof(SNMP_PAYLOAD)},
+    {1900, "SSDP", (const uint8_t *)SSDP_PAYLOAD, sizeof(SSDP_PAYLOAD) - 1},
+    {5353, "mDNS", MDNS_PAYLOAD, sizeof(MDNS_PAYLOAD)},
+    {5683, "CoAP", COAP_PAYLOAD, sizeof(COAP_PAYLOAD)},
+};
+
+static const int UDP_PROBE_COUNT = sizeof(UDP_PROBES) / sizeof(UDP_PROBES[0]);
+
+static const UdpProbe *findUdpProbe(uint16_t port)
+{
+    for (int i = 0; i < UDP_PROBE_COUNT; i++)
+    {
+        if (UDP_PROBES[i].port == port)
+        {
+            return &UDP_PROBES[i];
+        }
+    }
+    return nullptr;
+}
+
+const uint16_t *udpDefaultPorts(int &count)
+{
+    static uint16_t ports[UDP_PROBE_COUNT];
+    for (int i = 0; i < UDP_PROBE_COUNT; i++)
+    {
+        ports[i] = UDP_PROBES[i].port;
+    }
+    count = UDP_PROBE_COUNT;
+    return ports;
+}
+
+const char *udpServiceName(uint16_t port)
+{
+    const UdpProbe *probe = findUdpProbe(port);
+    return probe ? probe->service : "unknown";
+}
+
+const char *udpStateName(UdpPortState state)
+{
+    switch (state)
+    {
+    case UdpPortState::OPEN:
+        return "open";
+    case UdpPortState::CLOSED:
+        return "closed";
+    case UdpPortState::FILTERED:
+        return "filtered";
+    default:
+        return "open|filtered";
+    }
+}
+
+// Printable runs of 4+ characters, space separated (names, sysDescr, headers)
+static void extractPrintable(const uint8_t *data, size_t length, char *out, size_t outSize)
+{
+    size_t n = 0;
+    size_t i = 0;
+    while (i < length && n + 1 < outSize)
+    {
+        size_t run = 0;
+        while (i + run < length && data[i + run] >= 32 && data[i + run] < 127)
+        {
+            run++;
+        }
+        if (run >= 4)
+        {
+            if (n > 0 && n + 1 < outSize)
+            {
+                out[n++] = ' ';
+            }
+            for (size_t k = 0; k < run && n + 1 < outSize; k++)
+            {
+                out[n++] = (char)data[i + k];
+            }
+        }
+        i += run + 1;
+    }
+    out[n] = '\0';
+}
+
+// ============================================================================
+// UdpScanner Implementation
+// ============================================================================
+
+bool UdpScanner::openSockets()
+{
+    udpFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (udpFd < 0)
+    {
+        return false;
+    }
+
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = 0;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    socklen_t len = sizeof(local);
+    if (bind(udpFd, (struct sockaddr *)&local, sizeof(local)) < 0 ||
+        getsockname(udpFd, (struct sockaddr *)&local, &len) < 0)
+    {
+        closeSockets();
+        return false;
+    }
+    localPort = ntohs(local.sin_port);
+
+    int flags = fcntl(udpFd, F_GETFL, 0);
+    fcntl(udpFd, F_SETFL, flags | O_NONBLOCK);
+
+    // Port-unreachable detection is optional: without it closed ports
+    // simply read as open|filtered
+    icmpFd = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+    if (icmpFd >= 0)
+    {
+        flags = fcntl(icmpFd, F_GETFL, 0);
+        fcntl(icmpFd, F_SETFL, flags | O_NONBLOCK);
+    }
+    else
+    {
+        Serial.println("[UdpScan] No raw ICMP socket - closed ports will read open|filtered");
+    }
+    return true;
+}
+
+void UdpScanner::closeSockets()
+{
+    if (udpFd >= 0)
+    {
+        close(udpFd);
+        udpFd = -1;
+    }
+    if (icmpFd >= 0)
+    {
+        close(icmpFd);
+        icmpFd = -1;
+    }
+}
+
+bool UdpScanner::transmit(uint32_t ip, uint16_t port)
+{
+    const UdpProbe *probe = findUdpProbe(port);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = ip;
+
+    // Ports without a payload still get an empty datagram
+    const void *payload = probe ? (const void *)probe->payload : (const void *)"";
+    size_t length = probe ? probe->length : 0;
+    return sendto(udpFd, payload, length, 0, (struct sockaddr *)&addr, sizeof(addr)) >= 0;
+}
+
+int UdpScanner::findPending(uint32_t ip, uint16_t port) const
+{
+    for (int i = 0; i < pendingUsed; i++)
+    {
+        if (pending[i].ip == ip && pending[i].port == port)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void UdpScanner::removePending(int index)
+{
+    pending[index] = pending[--pendingUsed];
+}
+
+void UdpScanner::report(uint32_t ip, uint16_t port, UdpPortState state,
+                        const uint8_t *reply, size_t replyLen, UdpResultCallback callback)
+{
+    if (state != UdpPortState::OPEN_FILTERED)
+    {
+        rate.onAnswered();
+    }
+
+    switch (state)
+    {
+    case UdpPortState::OPEN:
+        openCount++;
+        break;
+    case UdpPortState::CLOSED:
+        closedCount++;
+        break;
+    case UdpPortState::FILTERED:
+        filteredCount++;
+        break;
+    default:
+        openFilteredCount++;
+        break;
+    }
+
+    UdpResult result;
+    strncpy(result.ip, IPAddress(ip).toString().c_str(), sizeof(result.ip) - 1);
+    result.ip[sizeof(result.ip) - 1] = '\0';
+    result.port = port;
+    result.state = state;
+    result.service = udpServiceName(port);
+    result.banner[0] = '\0';
+    if (reply && replyLen > 0)
+    {
+        extractPrintable(reply, replyLen, result.banner, sizeof(result.banner));
+    }
+
+    if (state == UdpPortState::OPEN)
+    {
+        Serial.printf("[UdpScan] %s:%d OPEN (%s) %s\n", result.ip, port, result.service, result.banner);
+    }
+
+    if (callback)
+    {
+        callback(result);
+    }
+}
+
+int UdpScanner::drainReplies(UdpResultCallback callback)
+{
+    int classified = 0;
+    uint8_t buf[256];
+    while (true)
+    {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int n = recvfrom(udpFd, buf, sizeof(buf), MSG_DONTWAIT, (struct sockaddr *)&from, &fromLen);
+        if (n < 0)
+        {
+            break;
+        }
+
+        int index = findPending(from.sin_addr.s_addr, ntohs(from.sin_port));
+        if (index < 0)
+        {
+            continue; // late reply or unsolicited
+        }
+        report(pending[index].ip, pending[index].port, UdpPortState::OPEN, buf, n, callback);
+        removePending(index);
+        classified++;
+    }
+    return classified;
+}
+
+int UdpScanner::drainIcmp(UdpResultCallback callback)
+{
+    if (icmpFd < 0)
+    {
+        return 0;
+    }
+
+    int classified = 0;
+    uint8_t packet[96];
+    while (true)
+    {
+        int n = recv(icmpFd, packet, sizeof(packet), MSG_DONTWAIT);
+        if (n <= 0)
+        {
+            break;
+        }
+
+        // Outer IP | ICMP type 3 | quoted IP header | quoted UDP ports
+        size_t outerLen = (size_t)(packet[0] & 0x0F) * 4;
+        if ((size_t)n < outerLen + 8 + 20 || packet[outerLen] != 3)
+        {
+            continue;
+        }
+        uint8_t code = packet[outerLen + 1];
+        const uint8_t *inner = packet + outerLen + 8;
+        size_t innerLen = (size_t)(inner[0] & 0x0F) * 4;
+        if (inner[9] != IPPROTO_UDP || (size_t)n < outerLen + 8 + innerLen + 4)
+        {
+            continue;
+        }
+
+        const uint8_t *udp = inner + innerLen;
+        uint16_t srcPort = (uint16_t)((udp[0] << 8) | udp[1]);
+        uint16_t dstPort = (uint16_t)((udp[2] << 8) | udp[3]);
+        uint32_t dstIp;
+        memcpy(&dstIp, inner + 16, 4);
+        if (srcPort != localPort)
+        {
+            continue;
+        }
+
+        int index = findPending(dstIp, dstPort);
+        if (index < 0)
+        {
+            continue;
+        }
+
+        UdpPortState state;
+        if (code == 3)
+        {
+            state = UdpPortState::CLOSED;
+        }
+        else if (code == 1 || code == 2 || code == 9 || code == 10 || code == 13)
+        {
+            state = UdpPortState::FILTERED;
+        }
+        else
+        {
+            continue;
+        }
+
+        report(dstIp, dstPort, state, nullptr, 0, callback);
+        removePending(index);
+        classified++;
+    }
+    return classified;
+}
+
+int UdpScanner::scan(const IPAddress *hosts, int hostCount,
+                     const uint16_t *ports, int portCount,
+                     UdpResultCallback callback,
+                     UdpProgressCallback progressCb)
+{
+    scanCancelled = false;
+    openCount = 0;
+    openFilteredCount = 0;
+    closedCount = 0;
+    filteredCount = 0;
+    pendingUsed = 0;
+    rate.begin(rateCeiling);
+
+    if (!ports)
+    {
+        ports = udpDefaultPorts(portCount);
+    }
+    if (hostCount <= 0 || portCount <= 0)
+    {
+        return 0;
+    }
+    if (!openSockets())
+    {
+        Serial.println("[UdpScan] Could not open UDP socket");
+        return 0;
+    }
+
+    int total = hostCount * portCount;
+    int nextProbe = 0;
+    int done = 0;
+    int lastReported = -1;
+
+    Serial.printf("[UdpScan] %d hosts x %d ports from local port %d\n", hostCount, portCount, localPort);
+
+    while ((nextProbe < total || pendingUsed > 0) && !scanCancelled)
+    {
+        // Port-major order: hosts take turns, so per-host ICMP rate limits
+        // see one probe at a time instead of a burst
+        while (pendingUsed < UDP_MAX_IN_FLIGHT && nextProbe < total && rate.tryAcquire())
+        {
+            uint32_t ip = (uint32_t)hosts[nextProbe % hostCount];
+            uint16_t port = ports[nextProbe / hostCount];
+            if (!transmit(ip, port))
+            {
+                rate.onLoss();
+                if (pendingUsed == 0)
+                {
+                    // Nothing will drain to free a pbuf - skip this probe
+                    report(ip, port, UdpPortState::OPEN_FILTERED, nullptr, 0, callback);
+                    nextProbe++;
+                    done++;
+                }
+                break;
+            }
+
+            Pending &entry = pending[pendingUsed++];
+            entry.ip = ip;
+            entry.port = port;
+            entry.attempt = 0;
+            entry.sentMs = millis();
+            nextProbe++;
+        }
+
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(udpFd, &readSet);
+        int maxFd = udpFd;
+        if (icmpFd >= 0)
+        {
+            FD_SET(icmpFd, &readSet);
+            if (icmpFd > maxFd)
+            {
+                maxFd = icmpFd;
+            }
+        }
+        uint32_t waitMs = ENRICH_POLL_MS;
+        if (nextProbe < total && pendingUsed < UDP_MAX_IN_FLIGHT)
+        {
+            uint32_t tokenWait = rate.msUntilToken();
+            if (tokenWait < waitMs)
+            {
+                waitMs = tokenWait;
+            }
+        }
+        struct timeval tv = {0, (long)(waitMs * 1000)};
+        if (select(maxFd + 1, &readSet, nullptr, nullptr, &tv) > 0)
+        {
+            done += drainReplies(callback);
+            done += drainIcmp(callback);
+        }
+
+        unsigned long now = millis();
+        for (int i = 0; i < pendingUsed;)
+        {
+            Pending &entry = pending[i];
+            if (now - entry.sentMs < UDP_PROBE_TIMEOUT_MS)
+            {
+                i++;
+                continue;
+            }
+            if (entry.attempt < UDP_RETRIES && transmit(entry.ip, entry.port))
+            {
+                entry.attempt++;
+                entry.sentMs = now;
+                i++;
+                continue;
+            }
+            report(entry.ip, entry.port, UdpPortState::OPEN_FILTERED, nullptr, 0, callback);
+            removePending(i);
+            done++;
+        }
+
+        int percent = (done * 100) / total;
+        if (progressCb && percent != lastReported)
+        {
+            lastReported = percent;
+            progressCb(done, total, openCount);
+        }
+
+        yield(); // Prevent watchdog timeout
+    }
+
+    closeSockets();
+    pendingUsed = 0;
+
+    Serial.printf("[UdpScan] Complete. open=%d open|filtered=%d closed=%d filtered=%d\n",
+                  openCount, openFilteredCount, closedCount, filteredCount);
+    return openCount;
+}
@@ -0,0 +1,106 @@
+#ifndef UDP_SCANNER_H
+#define UDP_SCANNER_H
+
+#include <WiFi.h>
+#include "config.h"
+#include "rate_controller.h"
+
+// ============================================================================
+// UDP Scanner - Protocol-aware UDP probes to many hosts from one socket
+// ============================================================================
+// Each port gets a payload its service will actually answer (an empty
+// datagram is ignored by most daemons). Replies are matched to probes by
+// source address and port; ICMP port-unreachable marks a port closed.
+// ============================================================================
+
+enum class UdpPortState : uint8_t
+{
+    OPEN,           // Service replied
+    OPEN_FILTERED,  // No reply after retries (open and silent, or dropped)
+    CLOSED,         // ICMP port unreachable
+    FILTERED        // ICMP host/admin unreachable
+};
+
+struct UdpResult
+{
+    char ip[16];
+    uint16_t port;
+    UdpPortState state;
+    const char *service;
+    char banner[UDP_BANNER_SIZE];  // Printable text from the reply
+};
+
+// Callback for every classified (host, port)
+typedef void (*UdpResultCallback)(const UdpResult &result);
+
+// Progress: probes classified, total probes, open so far
+typedef void (*UdpProgressCallback)(int done, int total, int openCount);
+
+// Ports that have a built-in payload, in probe order
+const uint16_t *udpDefaultPorts(int &count);
+
+// Service name for a UDP port, "unknown" when there is no payload for it
+const char *udpServiceName(uint16_t port);
+
+const char *udpStateName(UdpPortState state);
+
+class UdpScanner
+{
+public:
+    // Probe every port on every host. ports == nullptr uses udpDefaultPorts().
+    // Returns the number of open ports.
+    int scan(const IPAddress *hosts, int hostCount,
+             const uint16_t *ports, int portCount,
+             UdpResultCallback callback = nullptr,
+             UdpProgressCallback progressCb = nullptr);
+
+    void cancelScan() { scanCancelled = true; }
+
+    // Probe rate ceiling for the next scan (0 = default). Silence is the
+    // normal answer from open UDP ports, so only send errors slow it down.
+    void setRateCeiling(uint32_t pps) { rateCeiling = pps; }
+    uint32_t getCurrentRate() const { return rate.getRate(); }
+
+    int getOpenCount() const { return openCount; }
+    int getOpenFilteredCount() const { return openFilteredCount; }
+    int getClosedCount() const { return closedCount; }
+    int getFilteredCount() const { return filteredCount; }
+
+private:
+    struct Pending
+    {
+        uint32_t ip;
+        uint16_t port;
+        uint8_t attempt;
+        unsigned long sentMs;
+    };
+
+    Pending pending[UDP_MAX_IN_FLIGHT];
+    int pendingUsed = 0;
+
+    int udpFd = -1;
+    int icmpFd = -1;
+    uint16_t localPort = 0;
+    bool scanCancelled = false;
+    RateController rate;
+    uint32_t rateCeiling = 0;
+
+    int openCount = 0;
+    int openFilteredCount = 0;
+    int closedCount = 0;
+    int filteredCount = 0;
+
+    bool openSockets();
+    void closeSockets();
+    bool transmit(uint32_t ip, uint16_t port);
+    int findPending(uint32_t ip, uint16_t port) const;
+    void removePending(int index);
+    void report(uint32_t ip, uint16_t port, UdpPortState state,
+                const uint8_t *reply, size_t replyLen, UdpResultCallback callback);
+    int drainReplies(UdpResultCallback callback);
+    int drainIcmp(UdpResultCallback callback);
+};
+
+extern UdpScanner udpScanner;
+
+#endif // UDP_SCANNER_H
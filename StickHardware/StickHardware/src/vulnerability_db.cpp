@@ -1,4 +1,5 @@
 #include "vulnerability_db.h"
+#include "banner_matcher.h"
 #include <cstring>
 
 // Lightweight no-op vulnerability DB to save flash
@@ -80,10 +81,21 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
     if (!portResult.open)
         return 0;
 
+    return analyzeService(portResult.port, portResult.banner, callback);
+}
+
+int VulnerabilityDB::analyzeService(uint16_t port, const char *banner, VulnFoundCallback callback)
+{
+    if (!banner)
+        banner = "";
+
     int start = vulnCount;
 
+    // One pass over the banner; the checks below only test signature bits
+    SignatureSet sigs = scanBannerSignatures(banner, strlen(banner));
+
     // Check for Telnet (unencrypted remote access)
-    if (checkOpenTelnet(portResult.port))
+    if (checkOpenTelnet(port))
     {
         Vulnerability vuln = {
             "TELNET-EXPOSURE",
@@ -93,11 +105,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Unencrypted remote access - credentials transmitted in clear text",
             "Disable Telnet, use SSH instead"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
 
     // Check for FTP (unencrypted file transfer)
-    if (checkOpenFTP(portResult.port, portResult.banner))
+    if (checkOpenFTP(port, banner))
     {
         Vulnerability vuln = {
             "FTP-EXPOSURE",
@@ -107,11 +119,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Unencrypted file transfer protocol",
             "Use SFTP or FTPS instead"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
 
     // Check for exposed databases
-    if (portResult.port == 3306)
+    if (port == 3306)
     {
         Vulnerability vuln = {
             "MYSQL-EXPOSED",
@@ -121,9 +133,9 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Database port exposed to network",
             "Restrict access with firewall rules"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
-    else if (portResult.port == 5432)
+    else if (port == 5432)
     {
         Vulnerability vuln = {
             "POSTGRES-EXPOSED",
@@ -133,9 +145,9 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Database port exposed to network",
             "Restrict access with firewall rules"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
-    else if (portResult.port == 6379)
+    else if (port == 6379)
     {
         Vulnerability vuln = {
             "REDIS-EXPOSED",
@@ -145,9 +157,9 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Redis cache exposed - often lacks authentication",
             "Enable authentication and restrict access"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
-    else if (portResult.port == 27017)
+    else if (port == 27017)
     {
         Vulnerability vuln = {
             "MONGODB-EXPOSED",
@@ -157,11 +169,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Database exposed - may lack authentication",
             "Enable authentication and restrict access"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
 
     // Check for SMB/RDP
-    if (portResult.port == 445)
+    if (port == 445)
     {
         Vulnerability vuln = {
             "SMB-EXPOSED",
@@ -171,9 +183,9 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "SMB file sharing exposed - vulnerable to ransomware",
             "Restrict SMB access to trusted networks"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
-    else if (portResult.port == 3389)
+    else if (port == 3389)
     {
         Vulnerability vuln = {
             "RDP-EXPOSED",
@@ -183,11 +195,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "Remote Desktop exposed - brute force target",
             "Use VPN or disable public RDP access"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
 
     // Check for VNC
-    if (portResult.port >= 5900 && portResult.port <= 5999)
+    if (port >= 5900 && port <= 5999)
     {
         Vulnerability vuln = {
             "VNC-EXPOSED",
@@ -197,14 +209,14 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
             "VNC remote access exposed",
             "Use strong passwords and VPN access"
         };
-        addVuln(vuln, callback, portResult.port);
+        addVuln(vuln, callback, port);
     }
 
     // Check banners for version information
-    if (portResult.banner[0] != '\0')
+    if (sigs.any())
     {
         // Check for old SSH versions
-        if (strstr(portResult.banner, "SSH-1.") != nullptr)
+        if (sigs.has(SIG_SSH_V1))
         {
             Vulnerability vuln = {
                 "CVE-2001-0572",
@@ -214,11 +226,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
                 "SSH v1 protocol vulnerable to MITM attacks",
                 "Upgrade to SSH v2"
             };
-            addVuln(vuln, callback, portResult.port);
+            addVuln(vuln, callback, port);
         }
 
         // Check for Apache versions with known vulnerabilities
-        if (strstr(portResult.banner, "Apache/2.4.49") || strstr(portResult.banner, "Apache/2.4.50"))
+        if (sigs.has(SIG_APACHE_2_4_49) || sigs.has(SIG_APACHE_2_4_50))
         {
             Vulnerability vuln = {
                 "CVE-2021-41773",
@@ -228,11 +240,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
                 "Path traversal and RCE vulnerability",
                 "Upgrade to Apache 2.4.51 or later"
             };
-            addVuln(vuln, callback, portResult.port);
+            addVuln(vuln, callback, port);
         }
 
         // Check for older nginx versions
-        if (strstr(portResult.banner, "nginx/1.14") || strstr(portResult.banner, "nginx/1.15"))
+        if (sigs.has(SIG_NGINX_1_14) || sigs.has(SIG_NGINX_1_15))
         {
             Vulnerability vuln = {
                 "NGINX-OLD-VERSION",
@@ -242,11 +254,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
                 "Outdated nginx version - upgrade to latest stable",
                 "Update nginx packages"
             };
-            addVuln(vuln, callback, portResult.port);
+            addVuln(vuln, callback, port);
         }
 
         // Check for vsftpd backdoor
-        if (strstr(portResult.banner, "vsftpd 2.3.4"))
+        if (sigs.has(SIG_VSFTPD_2_3_4))
         {
             Vulnerability vuln = {
                 "CVE-2011-2523",
@@ -256,11 +268,11 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
                 "Backdoor in vsftpd 2.3.4 allows remote code execution",
                 "Upgrade vsftpd immediately"
             };
-            addVuln(vuln, callback, portResult.port);
+            addVuln(vuln, callback, port);
         }
 
         // Check for weak SSH versions
-        if (strstr(portResult.banner, "OpenSSH_5.") || strstr(portResult.banner, "OpenSSH_6.") || strstr(portResult.banner, "OpenSSH_7.2"))
+        if (sigs.has(SIG_OPENSSH_5) || sigs.has(SIG_OPENSSH_6) || sigs.has(SIG_OPENSSH_7_2))
         {
             Vulnerability vuln = {
                 "SSH-OLD-VERSION",
@@ -270,7 +282,7 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
                 "Outdated SSH version with known vulnerabilities",
                 "Upgrade OpenSSH to a supported release"
             };
-            addVuln(vuln, callback, portResult.port);
+            addVuln(vuln, callback, port);
         }
     }
 
@@ -280,9 +292,10 @@ int VulnerabilityDB::analyzeService(const PortResult &portResult, VulnFoundCallb
 int VulnerabilityDB::analyzeAllPorts(PortScanner &scanner, VulnFoundCallback callback)
 {
     int start = vulnCount;
-    for (int i = 0; i < scanner.getOpenPortCount(); ++i)
+    PortResultView res;
+    for (int i = 0; scanner.getResult(i, res); ++i)
     {
-        analyzeService(scanner.getResult(i), callback);
+        analyzeService(res.port, res.banner, callback);
     }
     return vulnCount - start;
 }
@@ -44,6 +44,7 @@ public:
     // Analyze port scan results for vulnerabilities
     // Returns number of vulnerabilities found
     int analyzeService(const PortResult &portResult, VulnFoundCallback callback = nullptr);
+    int analyzeService(uint16_t port, const char *banner, VulnFoundCallback callback = nullptr);
 
     // Analyze all open ports
     int analyzeAllPorts(PortScanner &scanner, VulnFoundCallback callback = nullptr);
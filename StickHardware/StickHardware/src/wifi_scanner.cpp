@@ -162,6 +162,9 @@ bool WiFiScanner::connectToNetwork(const char *ssid, const char *password, unsig
     Serial.printf("[WiFi] IP: %s\n", WiFi.localIP().toString().c_str());
     Serial.printf("[WiFi] Gateway: %s\n", WiFi.gatewayIP().toString().c_str());
 
+    // Wall-clock time for the device inventory; SNTP sets it in the background
+    configTime(0, 0, NTP_SERVER);
+
     return true;
 }
 
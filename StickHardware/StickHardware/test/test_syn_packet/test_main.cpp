@@ -0,0 +1,194 @@
+// ============================================================================
+// SYN Packet - classifySynReply() on replies recorded from the Linux stack
+// ============================================================================
+//   pio test -e native -f test_syn_packet
+// ============================================================================
+
+#include <unity.h>
+#include <string.h>
+#include "syn_packet.h"
+
+// Probes from 127.0.0.1:40000 with seq = synCookie(SECRET, 127.0.0.1, port)
+// to a listening port (8080) and a closed one (8081) on loopback; these are
+// the kernel's answers, IP header included
+static const uint32_t SECRET = 0x5EC12E75;
+static const uint16_t LOCAL_PORT = 40000;
+
+static const uint8_t SYN_ACK_8080[] = {
+    0x45, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x40, 0x00, 0x40, 0x06, 0x3c, 0xca,
+    0x7f, 0x00, 0x00, 0x01, 0x7f, 0x00, 0x00, 0x01, 0x1f, 0x90, 0x9c, 0x40,
+    0x13, 0x39, 0x54, 0x41, 0x36, 0xd9, 0xbf, 0x96, 0x60, 0x12, 0xff, 0xd7,
+    0xfe, 0x20, 0x00, 0x00, 0x02, 0x04, 0xff, 0xd7,
+};
+
+static const uint8_t RST_ACK_8081[] = {
+    0x45, 0x00, 0x00, 0x28, 0x00, 0x00, 0x40, 0x00, 0x40, 0x06, 0x3c, 0xce,
+    0x7f, 0x00, 0x00, 0x01, 0x7f, 0x00, 0x00, 0x01, 0x1f, 0x91, 0x9c, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xda, 0xd5, 0x46, 0x2f, 0x50, 0x14, 0x00, 0x00,
+    0xd4, 0xf7, 0x00, 0x00,
+};
+
+static const size_t IP_HEADER_SIZE = 20;
+static const size_t TCP_HEADER_SIZE = 20;
+
+static uint32_t loopback()
+{
+    static const uint8_t bytes[4] = {127, 0, 0, 1};
+    uint32_t ip;
+    memcpy(&ip, bytes, 4); // Network order, as IPAddress stores it
+    return ip;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_syn_ack_is_open()
+{
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::SYN_ACK,
+                      classifySynReply(SYN_ACK_8080, sizeof(SYN_ACK_8080), LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL(SynReplyKind::SYN_ACK, reply.kind);
+    TEST_ASSERT_EQUAL_HEX32(loopback(), reply.ip);
+    TEST_ASSERT_EQUAL_UINT16(8080, reply.port);
+}
+
+static void test_rst_is_closed()
+{
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::RST,
+                      classifySynReply(RST_ACK_8081, sizeof(RST_ACK_8081), LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL_HEX32(loopback(), reply.ip);
+    TEST_ASSERT_EQUAL_UINT16(8081, reply.port);
+}
+
+static void test_wrong_cookie_is_ignored()
+{
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(SYN_ACK_8080, sizeof(SYN_ACK_8080), LOCAL_PORT, SECRET + 1, reply));
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE, reply.kind);
+
+    // ACK of the cookie itself rather than cookie + 1
+    uint8_t packet[sizeof(SYN_ACK_8080)];
+    memcpy(packet, SYN_ACK_8080, sizeof(packet));
+    packet[IP_HEADER_SIZE + 11]--;
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+}
+
+static void test_wrong_port_is_ignored()
+{
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(SYN_ACK_8080, sizeof(SYN_ACK_8080), LOCAL_PORT + 1, SECRET, reply));
+
+    // Right destination, but the answer claims another source port, so the
+    // cookie (bound to the probed port) no longer matches
+    uint8_t packet[sizeof(RST_ACK_8081)];
+    memcpy(packet, RST_ACK_8081, sizeof(packet));
+    packet[IP_HEADER_SIZE + 1] = 0x90; // 8081 -> 8080
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+}
+
+static void test_truncated_header_is_ignored()
+{
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(SYN_ACK_8080, IP_HEADER_SIZE + TCP_HEADER_SIZE - 1, LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(SYN_ACK_8080, IP_HEADER_SIZE - 1, LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(SYN_ACK_8080, 0, LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(nullptr, sizeof(SYN_ACK_8080), LOCAL_PORT, SECRET, reply));
+
+    // The header claims 4 bytes of options, which pushes the TCP header
+    // past the end of the packet
+    uint8_t packet[IP_HEADER_SIZE + TCP_HEADER_SIZE];
+    memcpy(packet, RST_ACK_8081, sizeof(packet));
+    packet[0] = 0x46;
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+}
+
+static void test_ip_options_are_skipped()
+{
+    uint8_t packet[sizeof(SYN_ACK_8080) + 4];
+    memcpy(packet, SYN_ACK_8080, IP_HEADER_SIZE);
+    memset(packet + IP_HEADER_SIZE, 0x01, 4); // NOP options
+    memcpy(packet + IP_HEADER_SIZE + 4, SYN_ACK_8080 + IP_HEADER_SIZE, sizeof(SYN_ACK_8080) - IP_HEADER_SIZE);
+    packet[0] = 0x46;
+
+    SynReply reply;
+    TEST_ASSERT_EQUAL(SynReplyKind::SYN_ACK,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+    TEST_ASSERT_EQUAL_UINT16(8080, reply.port);
+}
+
+static void test_other_protocols_and_fragments_are_ignored()
+{
+    SynReply reply;
+    uint8_t packet[sizeof(SYN_ACK_8080)];
+
+    memcpy(packet, SYN_ACK_8080, sizeof(packet));
+    packet[9] = 17; // UDP
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+
+    memcpy(packet, SYN_ACK_8080, sizeof(packet));
+    packet[7] = 0x08; // Fragment offset 8
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+
+    memcpy(packet, SYN_ACK_8080, sizeof(packet));
+    packet[0] = 0x65; // IPv6 version nibble
+    TEST_ASSERT_EQUAL(SynReplyKind::NONE,
+                      classifySynReply(packet, sizeof(packet), LOCAL_PORT, SECRET, reply));
+}
+
+// What buildSynSegment() sends must carry a valid checksum and the cookie
+static void test_built_segment()
+{
+    uint32_t ip = loopback();
+    uint32_t seq = synCookie(SECRET, ip, 8080);
+    uint8_t segment[SYN_SEGMENT_SIZE];
+    TEST_ASSERT_EQUAL(0, buildSynSegment(segment, sizeof(segment) - 1, ip, ip, LOCAL_PORT, 8080, seq));
+    TEST_ASSERT_EQUAL(SYN_SEGMENT_SIZE, buildSynSegment(segment, sizeof(segment), ip, ip, LOCAL_PORT, 8080, seq));
+
+    TEST_ASSERT_EQUAL_UINT16(LOCAL_PORT, (segment[0] << 8) | segment[1]);
+    TEST_ASSERT_EQUAL_UINT16(8080, (segment[2] << 8) | segment[3]);
+    TEST_ASSERT_EQUAL_HEX32(seq, ((uint32_t)segment[4] << 24) | ((uint32_t)segment[5] << 16) |
+                                     ((uint32_t)segment[6] << 8) | segment[7]);
+
+    // Pseudo-header plus segment sums to 0xFFFF when the checksum is right
+    uint8_t pseudo[12] = {127, 0, 0, 1, 127, 0, 0, 1, 0, 6, 0, (uint8_t)SYN_SEGMENT_SIZE};
+    uint32_t sum = 0;
+    for (size_t i = 0; i < sizeof(pseudo); i += 2)
+    {
+        sum += (pseudo[i] << 8) | pseudo[i + 1];
+    }
+    for (size_t i = 0; i < SYN_SEGMENT_SIZE; i += 2)
+    {
+        sum += (segment[i] << 8) | segment[i + 1];
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, sum);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_syn_ack_is_open);
+    RUN_TEST(test_rst_is_closed);
+    RUN_TEST(test_wrong_cookie_is_ignored);
+    RUN_TEST(test_wrong_port_is_ignored);
+    RUN_TEST(test_truncated_header_is_ignored);
+    RUN_TEST(test_ip_options_are_skipped);
+    RUN_TEST(test_other_protocols_and_fragments_are_ignored);
+    RUN_TEST(test_built_segment);
+    return UNITY_END();
+}
@@ -0,0 +1,119 @@
+// ============================================================================
+// TLS Fingerprint - parseTlsFlight() / tlsFlightComplete() on recorded flights
+// ============================================================================
+//   pio test -e native -f test_tls_fingerprint
+// ============================================================================
+
+#include <unity.h>
+#include <string.h>
+#include "tls_fingerprint.h"
+#include "tls_flights.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Expected JA3S digests are MD5("version,cipher,extensions") worked out
+// from the captures independently of the parser
+static void test_tls12_full_flight()
+{
+    TlsFingerprint fp;
+    TEST_ASSERT_TRUE(tlsFlightComplete(TLS12_FLIGHT, sizeof(TLS12_FLIGHT)));
+    TEST_ASSERT_TRUE(parseTlsFlight(TLS12_FLIGHT, sizeof(TLS12_FLIGHT), fp));
+
+    TEST_ASSERT_TRUE(fp.serverHello);
+    TEST_ASSERT_EQUAL_HEX16(0x0303, fp.version);
+    TEST_ASSERT_EQUAL_HEX16(0xC02B, fp.cipher);
+    TEST_ASSERT_EQUAL_STRING("f9a66afdd1f499d415ca470974ec00c8", fp.ja3s); // 771,49195,65281-11
+    TEST_ASSERT_TRUE(fp.certificate);
+    TEST_ASSERT_EQUAL_STRING("router.example.lan", fp.subject);
+    TEST_ASSERT_EQUAL_STRING("NetStick Test Root", fp.issuer);
+    TEST_ASSERT_EQUAL_STRING("2031-10-16", fp.notAfter);
+    TEST_ASSERT_EQUAL_UINT8(0, fp.alert);
+}
+
+static void test_tls12_every_prefix_short_of_done_is_incomplete()
+{
+    // The ServerHelloDone record is the last 9 bytes
+    for (size_t len = 1; len < sizeof(TLS12_FLIGHT) - 8; len++)
+    {
+        TEST_ASSERT_FALSE(tlsFlightComplete(TLS12_FLIGHT, len));
+    }
+}
+
+static void test_tls13_server_hello()
+{
+    TlsFingerprint fp;
+    TEST_ASSERT_TRUE(parseTlsFlight(TLS13_FLIGHT, sizeof(TLS13_FLIGHT), fp));
+
+    TEST_ASSERT_TRUE(fp.serverHello);
+    TEST_ASSERT_EQUAL_HEX16(0x0304, fp.version); // supported_versions, not legacy_version
+    TEST_ASSERT_EQUAL_HEX16(0x1301, fp.cipher);
+    TEST_ASSERT_EQUAL_STRING("f4febc55ea12b31ae17cfb7e614afda8", fp.ja3s); // 771,4865,43-51
+    TEST_ASSERT_FALSE(fp.certificate); // Encrypted in TLS 1.3
+    TEST_ASSERT_EQUAL_STRING("", fp.subject);
+
+    // Nothing readable follows the first encrypted record
+    TEST_ASSERT_TRUE(tlsFlightComplete(TLS13_FLIGHT, sizeof(TLS13_FLIGHT)));
+}
+
+static void test_tls12_cut_mid_certificate()
+{
+    TlsFingerprint fp;
+    TEST_ASSERT_FALSE(tlsFlightComplete(TLS12_FLIGHT, TLS12_CUT_IN_SUBJECT));
+    TEST_ASSERT_TRUE(parseTlsFlight(TLS12_FLIGHT, TLS12_CUT_IN_SUBJECT, fp));
+
+    TEST_ASSERT_TRUE(fp.serverHello);
+    TEST_ASSERT_EQUAL_STRING("f9a66afdd1f499d415ca470974ec00c8", fp.ja3s);
+    TEST_ASSERT_FALSE(fp.certificate);
+    TEST_ASSERT_EQUAL_STRING("", fp.subject); // Never a partial or lesser attribute
+
+    // Issuer and expiry come first in the certificate and were read whole
+    TEST_ASSERT_EQUAL_STRING("NetStick Test Root", fp.issuer);
+    TEST_ASSERT_EQUAL_STRING("2031-10-16", fp.notAfter);
+}
+
+static void test_alert_only()
+{
+    TlsFingerprint fp;
+    TEST_ASSERT_TRUE(tlsFlightComplete(TLS_ALERT_ONLY, sizeof(TLS_ALERT_ONLY)));
+    TEST_ASSERT_TRUE(parseTlsFlight(TLS_ALERT_ONLY, sizeof(TLS_ALERT_ONLY), fp));
+
+    TEST_ASSERT_FALSE(fp.serverHello);
+    TEST_ASSERT_EQUAL_UINT8(70, fp.alert); // protocol_version
+    TEST_ASSERT_EQUAL_STRING("", fp.ja3s);
+
+    char line[128];
+    formatTlsFingerprint(fp, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("TLS alert 70", line);
+}
+
+static void test_not_tls()
+{
+    const uint8_t *reply = (const uint8_t *)NOT_TLS_REPLY;
+    size_t len = strlen(NOT_TLS_REPLY);
+    TlsFingerprint fp;
+    TEST_ASSERT_TRUE(tlsFlightComplete(reply, len));
+    TEST_ASSERT_FALSE(parseTlsFlight(reply, len, fp));
+    TEST_ASSERT_FALSE(fp.serverHello);
+    TEST_ASSERT_EQUAL_UINT8(0, fp.alert);
+}
+
+static void test_empty_reply_is_incomplete()
+{
+    TlsFingerprint fp;
+    TEST_ASSERT_FALSE(tlsFlightComplete(TLS12_FLIGHT, 0));
+    TEST_ASSERT_FALSE(parseTlsFlight(TLS12_FLIGHT, 0, fp));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tls12_full_flight);
+    RUN_TEST(test_tls12_every_prefix_short_of_done_is_incomplete);
+    RUN_TEST(test_tls13_server_hello);
+    RUN_TEST(test_tls12_cut_mid_certificate);
+    RUN_TEST(test_alert_only);
+    RUN_TEST(test_not_tls);
+    RUN_TEST(test_empty_reply_is_incomplete);
+    return UNITY_END();
+}
@@ -0,0 +1,101 @@
+#ifndef TLS_FLIGHTS_H
+#define TLS_FLIGHTS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// TLS Flights - Server replies recorded for the parser tests
+// ============================================================================
+// Captured from `openssl s_server` (OpenSSL 3.0) on loopback. The leaf is an
+// EC P-256 certificate for "O=Example Org, CN=router.example.lan" signed by
+// "O=NetStick Test CA, CN=NetStick Test Root", valid until 2031-10-16.
+// ============================================================================
+
+// Answer to the TLSClientHello probe (-tls1_2): ServerHello (ECDHE-ECDSA-
+// AES128-GCM-SHA256, extensions renegotiation_info and ec_point_formats),
+// Certificate, ServerKeyExchange, ServerHelloDone
+static const uint8_t TLS12_FLIGHT[] = {
+    0x16, 0x03, 0x03, 0x00, 0x59, 0x02, 0x00, 0x00, 0x55, 0x03, 0x03, 0x27,
+    0x19, 0x9a, 0x81, 0xae, 0x28, 0x3f, 0x51, 0x6e, 0x94, 0xec, 0x90, 0x15,
+    0x13, 0xeb, 0x28, 0xbd, 0x76, 0x96, 0xcb, 0xb4, 0x0d, 0xe6, 0x88, 0x24,
+    0xda, 0x1d, 0xe0, 0x4c, 0xc5, 0x7c, 0x79, 0x20, 0x31, 0xdd, 0x5f, 0x46,
+    0x2a, 0xbb, 0x2f, 0x86, 0x8f, 0xea, 0x7a, 0xe2, 0x30, 0x8b, 0x48, 0xb9,
+    0x7b, 0x19, 0x2a, 0x99, 0x19, 0xb7, 0x8f, 0x25, 0x4d, 0x12, 0x02, 0x4e,
+    0xcb, 0x7d, 0x0d, 0x3e, 0xc0, 0x2b, 0x00, 0x00, 0x0d, 0xff, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x0b, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03,
+    0x03, 0x01, 0x62, 0x0b, 0x00, 0x01, 0x5e, 0x00, 0x01, 0x5b, 0x00, 0x01,
+    0x58, 0x30, 0x82, 0x01, 0x54, 0x30, 0x81, 0xfa, 0x02, 0x02, 0x12, 0x34,
+    0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02,
+    0x30, 0x38, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c,
+    0x10, 0x4e, 0x65, 0x74, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x20, 0x43, 0x41, 0x31, 0x1b, 0x30, 0x19, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x12, 0x4e, 0x65, 0x74, 0x53, 0x74, 0x69, 0x63, 0x6b,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x30, 0x1e,
+    0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x36, 0x31, 0x36, 0x32, 0x31,
+    0x34, 0x35, 0x5a, 0x17, 0x0d, 0x33, 0x31, 0x31, 0x30, 0x31, 0x36, 0x31,
+    0x36, 0x32, 0x31, 0x34, 0x35, 0x5a, 0x30, 0x33, 0x31, 0x14, 0x30, 0x12,
+    0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x0b, 0x45, 0x78, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x20, 0x4f, 0x72, 0x67, 0x31, 0x1b, 0x30, 0x19, 0x06, 0x03,
+    0x55, 0x04, 0x03, 0x0c, 0x12, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x2e,
+    0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x6c, 0x61, 0x6e, 0x30,
+    0x59, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x02, 0x01,
+    0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07, 0x03, 0x42,
+    0x00, 0x04, 0xae, 0x62, 0x9f, 0xf2, 0x54, 0x8b, 0x23, 0x76, 0x21, 0xbe,
+    0x4b, 0x1f, 0x9c, 0x45, 0x1f, 0xeb, 0x84, 0x19, 0x2b, 0xa5, 0x8d, 0xb9,
+    0xb4, 0xf3, 0xa8, 0xdc, 0xda, 0xbd, 0xd9, 0x04, 0x4c, 0x9d, 0xec, 0x4d,
+    0x74, 0x02, 0xb4, 0x40, 0xb9, 0x75, 0xc7, 0xd2, 0x36, 0x7c, 0x46, 0x7c,
+    0x7e, 0x86, 0x5f, 0xb3, 0xc0, 0x39, 0xb3, 0x57, 0x0e, 0xae, 0x57, 0x6b,
+    0x76, 0x98, 0xa7, 0x98, 0xe2, 0x14, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86,
+    0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x03, 0x49, 0x00, 0x30, 0x46, 0x02,
+    0x21, 0x00, 0xe6, 0x46, 0x89, 0x97, 0x0c, 0x6c, 0x4d, 0x66, 0x1c, 0xcf,
+    0xf7, 0x0e, 0x08, 0x10, 0xa1, 0x54, 0xd7, 0x5c, 0xc3, 0x85, 0x58, 0xe1,
+    0xd5, 0x46, 0x87, 0xab, 0x4a, 0x04, 0xa0, 0xcd, 0x16, 0x8b, 0x02, 0x21,
+    0x00, 0xdf, 0xc8, 0x5c, 0x91, 0x5d, 0x2a, 0xee, 0x88, 0xa3, 0x69, 0x39,
+    0x84, 0x9f, 0x22, 0x3a, 0xa8, 0xba, 0x1c, 0xcf, 0xf7, 0xd2, 0x2e, 0x45,
+    0x51, 0x5f, 0x3e, 0xfd, 0x34, 0x1f, 0x15, 0xf8, 0xc4, 0x16, 0x03, 0x03,
+    0x00, 0x72, 0x0c, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x1d, 0x20, 0x6e, 0xd0,
+    0xa6, 0x49, 0x3e, 0x08, 0xb4, 0xb6, 0xc8, 0xfc, 0x09, 0x6c, 0x30, 0x10,
+    0xac, 0x4c, 0xc2, 0xc8, 0xae, 0x9a, 0xf5, 0x78, 0x3d, 0x29, 0xe8, 0x09,
+    0x5c, 0x35, 0x31, 0x5b, 0x24, 0x57, 0x04, 0x03, 0x00, 0x46, 0x30, 0x44,
+    0x02, 0x20, 0x5b, 0xcc, 0x9d, 0x52, 0x56, 0xfa, 0xb7, 0xb4, 0x8c, 0x4f,
+    0xec, 0xec, 0x13, 0xbf, 0xbe, 0xf0, 0xe2, 0xc2, 0x66, 0xbe, 0xc6, 0x8f,
+    0x08, 0xf4, 0x9a, 0xd6, 0x38, 0x03, 0xec, 0x07, 0x01, 0xbe, 0x02, 0x20,
+    0x50, 0xc0, 0x2d, 0xb9, 0x42, 0x89, 0x03, 0xb1, 0x3f, 0x78, 0x11, 0x33,
+    0x9d, 0x21, 0x83, 0x55, 0xea, 0x8b, 0xbf, 0x00, 0x6c, 0xa1, 0xdc, 0xdd,
+    0x0f, 0x82, 0xe1, 0xba, 0x3d, 0xd8, 0x65, 0x05, 0x16, 0x03, 0x03, 0x00,
+    0x04, 0x0e, 0x00, 0x00, 0x00,
+};
+
+// Inside the leaf's subject Name (it starts at 222): the issuer is read by
+// then, the subject not
+static const size_t TLS12_CUT_IN_SUBJECT = 230;
+
+// Answer to a TLS 1.3 ClientHello (-tls1_3): ServerHello (TLS_AES_128_GCM_
+// SHA256, supported_versions 0x0304, key_share), ChangeCipherSpec and the
+// first encrypted record; the rest of the flight is cut off
+static const uint8_t TLS13_FLIGHT[] = {
+    0x16, 0x03, 0x03, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x76, 0x03, 0x03, 0xe6,
+    0x40, 0xb1, 0xa6, 0xe4, 0x29, 0xbd, 0xae, 0x14, 0x0d, 0x34, 0x87, 0xd9,
+    0x56, 0xed, 0x9d, 0xe5, 0xe6, 0xb7, 0x1b, 0xde, 0xcc, 0x40, 0x3c, 0x40,
+    0xcb, 0x93, 0x35, 0x42, 0x31, 0x0f, 0xa6, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x2b, 0x00,
+    0x02, 0x03, 0x04, 0x00, 0x33, 0x00, 0x24, 0x00, 0x1d, 0x00, 0x20, 0x4c,
+    0x2b, 0x52, 0x1e, 0x94, 0xaf, 0x33, 0x6a, 0x9a, 0x1f, 0x93, 0xd3, 0xc5,
+    0xe1, 0x54, 0xb7, 0xf2, 0x8f, 0x64, 0x07, 0x8e, 0xb1, 0x24, 0x43, 0x0c,
+    0x2f, 0x86, 0xec, 0x1a, 0x77, 0xbd, 0x69, 0x14, 0x03, 0x03, 0x00, 0x01,
+    0x01, 0x17, 0x03, 0x03, 0x00, 0x17, 0x40, 0xbc, 0x35, 0xa5, 0x18, 0x01,
+    0xd0, 0x02, 0x66, 0x09, 0x2c, 0x56, 0x23, 0x40, 0xcc, 0x4b, 0x99, 0x0d,
+    0x8b, 0xcd, 0x83, 0x58, 0xf6,
+};
+
+// A -tls1_3 server refusing the TLS 1.2 probe: protocol_version alert
+static const uint8_t TLS_ALERT_ONLY[] = {
+    0x15, 0x03, 0x03, 0x00, 0x02, 0x02, 0x46,
+};
+
+static const char NOT_TLS_REPLY[] = "SSH-2.0-OpenSSH_9.6p1 Ubuntu-3ubuntu13\r\n";
+
+#endif // TLS_FLIGHTS_H